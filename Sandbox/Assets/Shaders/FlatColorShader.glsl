@@ -5,7 +5,9 @@
 
 layout (location = 0) in vec3 VertexPosition;
 
-uniform mat4 u_ViewProjectionMatrix;
+layout (std140, binding = 0) uniform Frame {
+    mat4 u_ViewProjectionMatrix;
+};
 uniform mat4 u_Transform;
 
 void main() {
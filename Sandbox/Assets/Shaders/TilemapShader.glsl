@@ -0,0 +1,56 @@
+#type vertex
+#version 460
+
+layout (location = 0) in vec3  VertexPosition;
+layout (location = 1) in vec4  Color;
+layout (location = 2) in vec2  TexCoord;
+layout (location = 3) in float TexIndex;
+layout (location = 4) in float TilingFactor;
+
+out vec4 v_Color;
+out vec2 v_TexCoord;
+
+layout (std140, binding = 0) uniform Frame {
+    mat4 u_ViewProjectionMatrix;
+};
+
+void main() {
+    v_Color     = Color;
+    v_TexCoord  = TexCoord;
+    gl_Position = u_ViewProjectionMatrix * vec4(VertexPosition, 1.0);
+}
+
+#type fragment
+#version 460
+
+in vec4 v_Color;
+in vec2 v_TexCoord;
+
+uniform usampler2D u_Tiles;
+uniform sampler2D  u_Tileset;
+uniform vec2       u_TilesetGrid;
+
+layout (location = 0) out vec4 FragColor;
+
+void main() {
+    ivec2 mapSize = textureSize(u_Tiles, 0);
+    vec2  coord   = v_TexCoord * vec2(mapSize);
+    uint  tile    = texelFetch(u_Tiles, clamp(ivec2(coord), ivec2(0), mapSize - 1), 0).r;
+
+    if (tile == 0u)
+        discard;
+
+    // Cells are counted row by row from the bottom left corner of the tileset
+    float cell      = float(tile - 1u);
+    vec2  origin    = vec2(mod(cell, u_TilesetGrid.x), floor(cell / u_TilesetGrid.x));
+
+    // Samples stay half a texel inside the cell, so the neighbour cells don't bleed in
+    vec2  halfTexel = 0.5 * u_TilesetGrid / vec2(textureSize(u_Tileset, 0));
+    vec2  local     = clamp(fract(coord), halfTexel, 1.0 - halfTexel);
+
+    // Gradients of the continuous coordinate, the wrap at the cell borders would pick the smallest level
+    vec2  gradientX = dFdx(coord) / u_TilesetGrid;
+    vec2  gradientY = dFdy(coord) / u_TilesetGrid;
+
+    FragColor = textureGrad(u_Tileset, (origin + local) / u_TilesetGrid, gradientX, gradientY) * v_Color;
+}
\ No newline at end of file
@@ -1,15 +1,15 @@
 #pragma once
 
-#include <Ziben/Renderer/VertexArray.hpp>
+#include <Ziben/Renderer/MeshQueue.hpp>
 
 class TriangleMesh {
 public:
     TriangleMesh();
     virtual ~TriangleMesh() = default;
 
-    void OnRender() const;
+    void OnRender(const Ziben::Ref<Ziben::Shader>& shader, const glm::mat4& transform) const;
 
 protected:
-    Ziben::Ref<Ziben::VertexArray> m_VertexArray;
+    Ziben::MeshQueue::MeshId m_Mesh;
 
 }; // TriangleMesh
\ No newline at end of file
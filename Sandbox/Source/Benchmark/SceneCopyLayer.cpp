@@ -0,0 +1,95 @@
+#include "SceneCopyLayer.hpp"
+
+#include <chrono>
+#include <limits>
+#include <algorithm>
+
+#include <imgui.h>
+
+#include <Ziben/System/Log.hpp>
+#include <Ziben/Scene/Entity.hpp>
+#include <Ziben/Scene/Component.hpp>
+
+namespace Sandbox {
+
+    SceneCopyLayer::SceneCopyLayer()
+        : Ziben::Layer("SceneCopyLayer") {}
+
+    void SceneCopyLayer::OnAttach() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        FillScene();
+        RunBenchmark();
+    }
+
+    void SceneCopyLayer::OnDetach() {
+        m_Scene = nullptr;
+    }
+
+    void SceneCopyLayer::OnImGuiRender() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        ImGui::Begin("Scene Copy");
+        ImGui::Text("Entities: %d", s_EntityCount);
+        ImGui::Text("Min: %.3f ms",     m_Result.MinMilliseconds);
+        ImGui::Text("Average: %.3f ms", m_Result.AverageMilliseconds);
+        ImGui::Text("Max: %.3f ms",     m_Result.MaxMilliseconds);
+
+        if (ImGui::Button("Run"))
+            RunBenchmark();
+
+        ImGui::End();
+    }
+
+    void SceneCopyLayer::FillScene() {
+        m_Scene = Ziben::CreateRef<Ziben::Scene>("SceneCopy");
+
+        // A grid instead of random positions, so every run copies the same scene
+        static constexpr int s_Columns = 316;
+
+        for (int i = 0; i < s_EntityCount; ++i) {
+            auto entity = m_Scene->CreateEntity("Sprite");
+
+            float x = static_cast<float>(i % s_Columns);
+            float y = static_cast<float>(i / s_Columns);
+
+            entity.GetComponent<Ziben::TransformComponent>().SetTranslation({ x, y, 0.0f });
+
+            // Every tenth sprite is static, every hundredth entity has a mesh
+            entity.PushComponent<Ziben::SpriteRendererComponent>(glm::vec4(x / s_Columns, 0.4f, 0.6f, 1.0f), i % 10 == 0);
+
+            if (i % 100 == 0)
+                entity.PushComponent<Ziben::MeshComponent>();
+        }
+    }
+
+    void SceneCopyLayer::RunBenchmark() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        using Clock = std::chrono::steady_clock;
+
+        m_Result = { std::numeric_limits<double>::max(), 0.0, 0.0 };
+
+        for (int i = 0; i < s_RunCount; ++i) {
+            auto begin = Clock::now();
+            auto copy  = Ziben::Scene::Copy(m_Scene);
+            auto end   = Clock::now();
+
+            double milliseconds = std::chrono::duration<double, std::milli>(end - begin).count();
+
+            m_Result.MinMilliseconds      = std::min(m_Result.MinMilliseconds, milliseconds);
+            m_Result.MaxMilliseconds      = std::max(m_Result.MaxMilliseconds, milliseconds);
+            m_Result.AverageMilliseconds += milliseconds / s_RunCount;
+        }
+
+        ZIBEN_INFO(
+            "Scene::Copy of {0} entities: min {1:.3f} ms, average {2:.3f} ms, max {3:.3f} ms over {4} runs",
+            s_EntityCount,
+            m_Result.MinMilliseconds,
+            m_Result.AverageMilliseconds,
+            m_Result.MaxMilliseconds,
+            s_RunCount
+        );
+    }
+
+} // namespace Sandbox
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <Ziben/Scene/Layer.hpp>
+#include <Ziben/Scene/Scene.hpp>
+
+namespace Sandbox {
+
+    // Times Scene::Copy, the copy made on every play, on a scene filled with the same entities every run
+    class SceneCopyLayer : public Ziben::Layer {
+    public:
+        SceneCopyLayer();
+        ~SceneCopyLayer() noexcept override = default;
+
+        void OnAttach() override;
+        void OnDetach() override;
+        void OnImGuiRender() override;
+
+    private:
+        struct Result {
+            double MinMilliseconds     = 0.0;
+            double AverageMilliseconds = 0.0;
+            double MaxMilliseconds     = 0.0;
+        };
+
+    private:
+        static constexpr int s_EntityCount = 100'000;
+        static constexpr int s_RunCount    = 10;
+
+    private:
+        void FillScene();
+        void RunBenchmark();
+
+    private:
+        Ziben::Ref<Ziben::Scene> m_Scene;
+        Result                   m_Result;
+
+    }; // class SceneCopyLayer
+
+} // namespace Sandbox
\ No newline at end of file
@@ -3,17 +3,10 @@
 namespace Diffuse {
 
     TriangleMesh::TriangleMesh()
-        : m_VertexArray(Ziben::VertexArray::Create()) {}
+        : m_Mesh(0) {}
 
-    void TriangleMesh::OnRender() const {
-        Ziben::VertexArray::Bind(m_VertexArray);
-
-        glDrawElements(
-            GL_TRIANGLES,
-            static_cast<GLsizei>(m_VertexArray->GetIndexBuffer()->GetCount()),
-            GL_UNSIGNED_INT,
-            nullptr
-        );
+    void TriangleMesh::OnRender(const Ziben::Ref<Ziben::Shader>& shader, const glm::mat4& transform) const {
+        Ziben::MeshQueue::Submit(shader, m_Mesh, transform);
     }
 
 }
\ No newline at end of file
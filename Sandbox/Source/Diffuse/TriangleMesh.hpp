@@ -1,6 +1,6 @@
 #pragma once
 
-#include <Ziben/Renderer/VertexArray.hpp>
+#include <Ziben/Renderer/MeshQueue.hpp>
 
 namespace Diffuse {
 
@@ -9,10 +9,10 @@ namespace Diffuse {
         TriangleMesh();
         virtual ~TriangleMesh() = default;
 
-        void OnRender() const;
+        void OnRender(const Ziben::Ref<Ziben::Shader>& shader, const glm::mat4& transform) const;
 
     protected:
-        Ziben::Ref<Ziben::VertexArray> m_VertexArray;
+        Ziben::MeshQueue::MeshId m_Mesh;
 
     }; // TriangleMesh
 
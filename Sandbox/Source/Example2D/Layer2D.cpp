@@ -11,6 +11,7 @@
 #include <Ziben/Window/KeyEvent.hpp>
 #include "Ziben/Renderer/RenderCommand.hpp"
 #include <Ziben/Renderer/Renderer.hpp>
+#include <Ziben/Renderer/AssetManager.hpp>
 
 #include "Application.hpp"
 
@@ -78,10 +79,10 @@ Layer2D::Layer2D()
     m_SquareVertexArray->PushVertexBuffer(squareVertexBuffer);
     m_SquareVertexArray->SetIndexBuffer(squareIndexBuffer);
 
-    Ziben::Texture2D::Bind(m_CheckerBoardTexture = Ziben::Texture2D::Create("Assets/Textures/CheckerBoard.png"));
+    Ziben::Texture2D::Bind(m_CheckerBoardTexture = Ziben::AssetManager::LoadTexture("Assets/Textures/CheckerBoard.png"));
     m_Shader->SetUniform("u_Texture", 0);
 
-    Ziben::Texture2D::Bind(m_ChernoTexture = Ziben::Texture2D::Create("Assets/Textures/ChernoLogo.png"));
+    Ziben::Texture2D::Bind(m_ChernoTexture = Ziben::AssetManager::LoadTexture("Assets/Textures/ChernoLogo.png"));
     m_Shader->SetUniform("u_Texture", 0);
 }
 
@@ -10,12 +10,14 @@
 #include <Ziben/Window/KeyEvent.hpp>
 #include <Ziben/Renderer/RenderCommand.hpp>
 #include <Ziben/Renderer/Renderer2D.hpp>
+#include <Ziben/Renderer/AssetManager.hpp>
 
 #include "Application.hpp"
 
 Sandbox2D::Sandbox2D()
     : Ziben::Layer("Sandbox2D")
     , m_CameraController(1280.0f / 720.0f)
+    , m_IsTextureAtlasUsed(true)
     , m_SquareColor(0.2f, 0.3f, 0.8f, 0.9f)
     , m_SquareAngle(0.0f)
     , m_ColorDirection(1.0f)
@@ -25,9 +27,23 @@ void Sandbox2D::OnAttach() {
     ZIBEN_PROFILE_FUNCTION();
 
     // Init Texture
-    m_CheckerBoardTexture        = Ziben::Texture2D::Create("Assets/Textures/CheckerBoard.png");
-    m_SpriteSheetTexture         = Ziben::Texture2D::Create("Assets/Textures/SpriteSheet.png");
+    m_CheckerBoardTexture        = Ziben::AssetManager::LoadTexture("Assets/Textures/CheckerBoard.png");
+    m_SpriteSheetTexture         = Ziben::AssetManager::LoadTexture("Assets/Textures/SpriteSheet.png");
+    m_LogoTexture                = Ziben::AssetManager::LoadTexture("Assets/Textures/ChernoLogo.png");
     m_Tree                       = Ziben::SubTexture2D::CreateFromCoords(m_SpriteSheetTexture, { 0, 1 }, { 128, 128 }, { 1, 2 });
+    m_Logo                       = Ziben::CreateRef<Ziben::SubTexture2D>(m_LogoTexture, glm::vec2(0.0f), glm::vec2(1.0f));
+
+    // Init Atlas, the page fits the 2560x1664 sheet and the logo next to it
+    m_TextureAtlas               = Ziben::TextureAtlas::Create(4096);
+
+    auto regions                 = m_TextureAtlas->Build({ "Assets/Textures/SpriteSheet.png", "Assets/Textures/ChernoLogo.png" });
+
+    if (regions[0] && regions[1]) {
+        m_AtlasTree              = Ziben::SubTexture2D::CreateFromCoords(regions[0], { 0, 1 }, { 128, 128 }, { 1, 2 });
+        m_AtlasLogo              = regions[1];
+    } else {
+        m_IsTextureAtlasUsed     = false;
+    }
 
     // Init Particle
     m_Particle.ColorBegin        = { 254 / 255.0f, 212 / 255.0f, 123 / 255.0f, 1.0f };
@@ -104,7 +120,9 @@ void Sandbox2D::OnUpdate(const Ziben::TimeStep& ts) {
             }
         }
 
-        Ziben::Renderer2D::DrawQuad({ -2.0f, 2.0f, 0.1f }, { 1.0f, 2.0f }, m_Tree);
+        // Without the atlas the tree and the logo take a texture slot each
+        Ziben::Renderer2D::DrawQuad({ -2.0f, 2.0f, 0.1f }, { 1.0f, 2.0f }, m_IsTextureAtlasUsed ? m_AtlasTree : m_Tree);
+        Ziben::Renderer2D::DrawQuad({ 2.0f, 2.0f, 0.1f }, { 1.0f, 1.0f }, m_IsTextureAtlasUsed ? m_AtlasLogo : m_Logo);
 
         Ziben::Renderer2D::EndScene();
     }
@@ -147,6 +165,10 @@ void Sandbox2D::OnImGuiRender() {
         ImGui::Text("Quad Count: %d",   statistics.QuadCount);
         ImGui::Text("Vertex Count: %d", statistics.QuadCount * 4);
         ImGui::Text("Index Count: %d",  statistics.QuadCount * 6);
+        ImGui::Text("Texture Slot Flushes: %d", statistics.TextureSlotFlushes);
+
+        if (m_AtlasTree)
+            ImGui::Checkbox("Texture Atlas", &m_IsTextureAtlasUsed);
 
         ImGui::ColorEdit4("SquareColor", glm::value_ptr(m_SquareColor));
         ImGui::ColorEdit4("ParticleBeginColor", glm::value_ptr(m_Particle.ColorBegin));
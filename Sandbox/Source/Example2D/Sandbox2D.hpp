@@ -6,6 +6,7 @@
 #include <Ziben/Renderer/VertexArray.hpp>
 #include <Ziben/Renderer/Texture.hpp>
 #include <Ziben/Renderer/SubTexture2D.hpp>
+#include <Ziben/Renderer/TextureAtlas.hpp>
 #include <Ziben/Renderer/FrameBuffer.hpp>
 
 #include "ParticleSystem.hpp"
@@ -24,9 +25,17 @@ private:
     Ziben::OrthographicCameraController                       m_CameraController;
     Ziben::Ref<Ziben::Texture2D>                              m_CheckerBoardTexture;
     Ziben::Ref<Ziben::Texture2D>                              m_SpriteSheetTexture;
+    Ziben::Ref<Ziben::Texture2D>                              m_LogoTexture;
 
     Ziben::Ref<Ziben::SubTexture2D>                           m_Bush;
     Ziben::Ref<Ziben::SubTexture2D>                           m_Tree;
+    Ziben::Ref<Ziben::SubTexture2D>                           m_Logo;
+
+    // Same sprites cut from the atlas, the sheet and the logo share one page
+    Ziben::Ref<Ziben::TextureAtlas>                           m_TextureAtlas;
+    Ziben::Ref<Ziben::SubTexture2D>                           m_AtlasTree;
+    Ziben::Ref<Ziben::SubTexture2D>                           m_AtlasLogo;
+    bool                                                      m_IsTextureAtlasUsed;
 
     glm::vec4                                                 m_SquareColor;
     float                                                     m_SquareAngle;
@@ -7,7 +7,6 @@
 
 #include <Ziben/Window/EventDispatcher.hpp>
 #include <Ziben/Window/Input.hpp>
-#include <Ziben/Renderer/RenderCommand.hpp>
 #include <Ziben/Renderer/Renderer2D.hpp>
 
 #include "Application.hpp"
@@ -25,7 +24,9 @@ namespace Sandbox {
 
     SortLayer::SortLayer()
         : Ziben::Layer("SortLayer")
+        , m_ViewportTexture(Ziben::RenderGraph::s_NullTexture)
         , m_ViewportSize(0)
+        , m_RenderedViewportSize(0)
         , m_ViewportBounds({ glm::vec2(0.0f), glm::vec2(0.0f) })
         , m_Camera(
             0,
@@ -45,19 +46,6 @@ namespace Sandbox {
     void SortLayer::OnAttach() {
         ZIBEN_PROFILE_FUNCTION();
 
-        // Init FrameBuffer
-        Ziben::FrameBufferSpecification specification;
-
-        specification.Attachments = {
-            { Ziben::FrameBufferTextureFormat::RGBA8 },
-            { Ziben::FrameBufferTextureFormat::Depth }
-        };
-
-        specification.Width  = 1080;
-        specification.Height = 720;
-
-        m_FrameBuffer = Ziben::FrameBuffer::Create(std::move(specification));
-
         // Init ParticleSystem
         m_ParticleSystem.SetMaxParticleCount(40'000);
 
@@ -108,6 +96,8 @@ namespace Sandbox {
 
         for (auto& [type, algorithm] : m_SortAlgorithms)
             delete algorithm;
+
+        m_RenderGraph.ReleaseResources();
     }
 
     void SortLayer::OnEvent(Ziben::Event& event) {
@@ -120,15 +110,9 @@ namespace Sandbox {
     void SortLayer::OnUpdate(const Ziben::TimeStep& ts) {
         ZIBEN_PROFILE_FUNCTION();
 
-        // Resize
-        if (auto specification = m_FrameBuffer->GetSpecification();
-            m_ViewportSize.x > 0 &&
-            m_ViewportSize.y > 0 && (
-                specification.Width  != m_ViewportSize.x ||
-                specification.Height != m_ViewportSize.y
-            )
-        ) {
-            m_FrameBuffer->Resize(m_ViewportSize.x, m_ViewportSize.y);
+        // Resize, the render graph allocates the attachments of the new size itself
+        if (m_ViewportSize.x > 0 && m_ViewportSize.y > 0 && m_ViewportSize != m_RenderedViewportSize) {
+            m_RenderedViewportSize = m_ViewportSize;
 
             // Update CameraProjection
             m_Camera.SetProjection(0, static_cast<float>(m_ViewportSize.x), static_cast<float>(m_ViewportSize.y), 0);
@@ -159,25 +143,40 @@ namespace Sandbox {
 
         Ziben::Renderer2D::ResetStatistics();
 
-        Ziben::FrameBuffer::Bind(m_FrameBuffer);
-        {
-            Ziben::RenderCommand::SetClearColor({ 0.1f, 0.1f, 0.1f, 1.0f });
-            Ziben::RenderCommand::Clear();
+        if (m_ViewportSize.x == 0 || m_ViewportSize.y == 0)
+            return;
 
-            Ziben::Renderer2D::BeginScene(m_Camera);
-            {
-                for (const auto& quad : m_Quads) {
-                    ZIBEN_PROFILE_SCOPE("RectRender!");
+        Ziben::RenderGraph::TextureDescription description = { m_ViewportSize.x, m_ViewportSize.y, Ziben::FrameBufferTextureFormat::RGBA8 };
+
+        m_ViewportTexture = m_RenderGraph.CreateTexture(description);
+
+        description.Format = Ziben::FrameBufferTextureFormat::Depth;
+        Ziben::RenderGraph::TextureId depthTexture = m_RenderGraph.CreateTexture(description);
 
-                    Ziben::Renderer2D::DrawQuad(quad.Position, quad.Size, quad.Color);
+        m_RenderGraph.AddPass(
+            "Sort",
+            [&](Ziben::RenderGraph::PassBuilder& builder) {
+                builder.Write(m_ViewportTexture, glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
+                builder.WriteDepth(depthTexture, 1.0f);
+            },
+            [this] {
+                Ziben::Renderer2D::BeginScene(m_Camera);
+                {
+                    for (const auto& quad : m_Quads) {
+                        ZIBEN_PROFILE_SCOPE("RectRender!");
+
+                        Ziben::Renderer2D::DrawQuad(quad.Position, quad.Size, quad.Color);
+                    }
                 }
+                Ziben::Renderer2D::EndScene();
+
+                // ParticleSystem Render
+                m_ParticleSystem.OnRender(m_Camera);
             }
-            Ziben::Renderer2D::EndScene();
+        );
 
-            // ParticleSystem Render
-            m_ParticleSystem.OnRender(m_Camera);
-        }
-        Ziben::FrameBuffer::Unbind();
+        m_RenderGraph.Export(m_ViewportTexture);
+        m_RenderGraph.Execute();
     }
 
     void SortLayer::OnImGuiRender() {
@@ -249,11 +248,20 @@ namespace Sandbox {
                 auto viewportPanelSize = ImGui::GetContentRegionAvail();
                 m_ViewportSize = { viewportPanelSize.x, viewportPanelSize.y };
 
+                Ziben::HandleType viewportTexture = 0;
+                glm::vec2         viewportScale   = glm::vec2(1.0f);
+
+                // Only the corner of the bucket sized texture is rendered
+                if (m_ViewportTexture != Ziben::RenderGraph::s_NullTexture) {
+                    viewportTexture = m_RenderGraph.GetTextureHandle(m_ViewportTexture);
+                    viewportScale   = m_RenderGraph.GetTextureScale(m_ViewportTexture);
+                }
+
                 ImGui::Image(
-                    reinterpret_cast<void*>(m_FrameBuffer->GetColorAttachmentHandle()),
+                    reinterpret_cast<void*>(viewportTexture),
                     viewportPanelSize,
-                    ImVec2(0, 1),
-                    ImVec2(1, 0)
+                    ImVec2(0, viewportScale.y),
+                    ImVec2(viewportScale.x, 0)
                 );
 
                 auto viewportMinRegion = ImGui::GetWindowContentRegionMin();
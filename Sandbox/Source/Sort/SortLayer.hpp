@@ -6,7 +6,7 @@
 #include <Ziben/Window/WindowEvent.hpp>
 #include <Ziben/Scene/Layer.hpp>
 #include <Ziben/Renderer/OrthographicCamera.hpp>
-#include <Ziben/Renderer/FrameBuffer.hpp>
+#include <Ziben/Renderer/RenderGraph.hpp>
 
 #include "ParticleSystem.hpp"
 #include "ControllableAlgorithm.hpp"
@@ -77,8 +77,10 @@ namespace Sandbox {
 
     private:
         Ziben::OrthographicCamera      m_Camera;
-        Ziben::Ref<Ziben::FrameBuffer> m_FrameBuffer;
+        Ziben::RenderGraph             m_RenderGraph;
+        Ziben::RenderGraph::TextureId  m_ViewportTexture;
         glm::vec<2, uint32_t>          m_ViewportSize;
+        glm::vec<2, uint32_t>          m_RenderedViewportSize;
         std::array<glm::vec2, 2>       m_ViewportBounds;
 
         ShuffleAlgorithmContainer      m_ShuffleAlgorithms;
@@ -14,7 +14,9 @@ out flat float v_TexIndex;
 out      float v_TilingFactor;
 out flat int   v_EntityHandle;
 
-uniform mat4 u_ViewProjectionMatrix;
+layout (std140, binding = 0) uniform Frame {
+    mat4 u_ViewProjectionMatrix;
+};
 
 void main() {
     v_Color        = Color;
@@ -34,12 +36,21 @@ in      float v_TexIndex;
 in      float v_TilingFactor;
 in flat int   v_EntityHandle;
 
-uniform sampler2D u_Textures[32];
+uniform sampler2D      u_Textures[31];
+uniform sampler2DArray u_TextureArray;
+uniform float          u_MipBias;
 
 layout (location = 0) out vec4 FragColor1;
 layout (location = 1) out int  FragColor2;
 
 void main() {
-    FragColor1 = texture(u_Textures[int(v_TexIndex)], v_TexCoord * v_TilingFactor) * v_Color;
+    vec2 texCoord = v_TexCoord * v_TilingFactor;
+
+    // Negative indices are the layers of the texture array
+    if (v_TexIndex < 0.0)
+        FragColor1 = texture(u_TextureArray, vec3(texCoord, -v_TexIndex - 1.0), u_MipBias) * v_Color;
+    else
+        FragColor1 = texture(u_Textures[int(v_TexIndex)], texCoord, u_MipBias) * v_Color;
+
     FragColor2 = v_EntityHandle;
 }
\ No newline at end of file
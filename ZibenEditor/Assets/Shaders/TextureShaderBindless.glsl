@@ -0,0 +1,61 @@
+#type vertex
+#version 460
+
+layout (location = 0) in vec3  VertexPosition;
+layout (location = 1) in vec4  Color;
+layout (location = 2) in vec2  TexCoord;
+layout (location = 3) in float TexIndex;
+layout (location = 4) in float TilingFactor;
+layout (location = 5) in int   EntityHandle;
+
+out      vec4  v_Color;
+out      vec2  v_TexCoord;
+out flat float v_TexIndex;
+out      float v_TilingFactor;
+out flat int   v_EntityHandle;
+
+layout (std140, binding = 0) uniform Frame {
+    mat4 u_ViewProjectionMatrix;
+};
+
+void main() {
+    v_Color        = Color;
+    v_TexCoord     = TexCoord;
+    v_TexIndex     = TexIndex;
+    v_TilingFactor = TilingFactor;
+    v_EntityHandle = EntityHandle;
+    gl_Position   = u_ViewProjectionMatrix * vec4(VertexPosition, 1.0);
+}
+
+#type fragment
+#version 460
+#extension GL_ARB_bindless_texture : require
+
+in      vec4  v_Color;
+in      vec2  v_TexCoord;
+in      float v_TexIndex;
+in      float v_TilingFactor;
+in flat int   v_EntityHandle;
+
+// Bindless handles of the batch textures, indexed by TexIndex
+layout (std430, binding = 0) readonly buffer TextureHandles {
+    uvec2 u_TextureHandles[];
+};
+
+uniform sampler2DArray u_TextureArray;
+uniform float          u_MipBias;
+
+layout (location = 0) out vec4 FragColor1;
+layout (location = 1) out int  FragColor2;
+
+void main() {
+    vec2 texCoord = v_TexCoord * v_TilingFactor;
+
+    // Negative indices are the layers of the texture array
+    if (v_TexIndex < 0.0)
+        FragColor1 = texture(u_TextureArray, vec3(texCoord, -v_TexIndex - 1.0), u_MipBias) * v_Color;
+    else
+        FragColor1 = texture(sampler2D(u_TextureHandles[int(v_TexIndex)]), texCoord, u_MipBias) * v_Color;
+
+    FragColor2 = v_EntityHandle;
+}
\ No newline at end of file
@@ -9,8 +9,12 @@
 
 #include <Ziben/Window/Input.hpp>
 #include <Ziben/Window/EventDispatcher.hpp>
-#include <Ziben/Renderer/RenderCommand.hpp>
 #include <Ziben/Renderer/Renderer2D.hpp>
+#include <Ziben/Renderer/MeshQueue.hpp>
+#include <Ziben/Renderer/TextureLoader.hpp>
+#include <Ziben/Renderer/AssetManager.hpp>
+#include <Ziben/Renderer/ShaderReloader.hpp>
+#include <Ziben/Renderer/RenderState.hpp>
 #include <Ziben/Scene/Component.hpp>
 #include <Ziben/Scene/SceneSerializer.hpp>
 #include <Ziben/System/FileDialogs.hpp>
@@ -94,8 +98,14 @@ namespace Ziben {
 
     EditorLayer::EditorLayer()
         : Layer("EditorLayer")
+        , m_ViewportTexture(RenderGraph::s_NullTexture)
+        , m_SceneState(SceneState::Edit)
+        , m_IsPickRequested(false)
+        , m_IsBoxSelecting(false)
+        , m_BoxSelectionStart(0.0f)
         , m_EditorCamera(30.0f, 1.778f, 0.1f, 1000.0f)
         , m_ViewportSize(0.0f)
+        , m_RenderedViewportSize(0.0f)
         , m_IsViewportFocused(false)
         , m_IsViewportHovered(false)
         , m_GuizmoType(-1) {}
@@ -103,19 +113,6 @@ namespace Ziben {
     void EditorLayer::OnAttach() {
         ZIBEN_PROFILE_FUNCTION();
 
-        // Init FrameBuffer
-        FrameBufferSpecification specification;
-
-        specification.Attachments = {
-            { FrameBufferTextureFormat::RGBA8      },
-            { FrameBufferTextureFormat::RedInteger },
-            { FrameBufferTextureFormat::Depth      }
-        };
-
-        specification.Width  = 1280;
-        specification.Height = 720;
-
-        m_FrameBuffer = FrameBuffer::Create(std::move(specification));
         m_ActiveScene = CreateRef<Scene>("ActiveScene");
 
 #if 0
@@ -154,12 +151,12 @@ namespace Ziben {
             }
         };
 
-        m_CameraA.PushComponent<NativeScriptComponent>().Bind<CameraController>();
+        m_CameraA.PushComponent<NativeScriptComponent>().Bind<CameraController>("CameraController");
 #endif
     }
 
     void EditorLayer::OnDetach() {
-
+        m_RenderGraph.ReleaseResources();
     }
 
     void EditorLayer::OnEvent(Event& event) {
@@ -175,47 +172,85 @@ namespace Ziben {
     void EditorLayer::OnUpdate(const TimeStep& ts) {
         ZIBEN_PROFILE_FUNCTION();
 
-        // Resize
-        if (auto specification = m_FrameBuffer->GetSpecification();
-            m_ViewportSize.x > 0 &&
-            m_ViewportSize.y > 0 && (
-                specification.Width  != m_ViewportSize.x ||
-                specification.Height != m_ViewportSize.y
-            )
-        ) {
-            m_FrameBuffer->Resize(m_ViewportSize.x, m_ViewportSize.y);
+        // Scene that is loaded in the background replaces the active one once it's ready
+        if (m_SceneLoader.IsLoading())
+            if (auto scene = m_SceneLoader.Poll(std::chrono::milliseconds(2)))
+                SetActiveScene(scene, m_SceneLoader.GetFilepath());
+
+        // Resize, the render graph allocates the attachments of the new size itself
+        if (m_ViewportSize.x > 0 && m_ViewportSize.y > 0 && m_ViewportSize != m_RenderedViewportSize) {
+            m_RenderedViewportSize = m_ViewportSize;
+
             m_EditorCamera.SetViewportSize(static_cast<float>(m_ViewportSize.x), static_cast<float>(m_ViewportSize.y));
             m_ActiveScene->OnViewportResize(m_ViewportSize.x, m_ViewportSize.y);
         }
 
-        m_EditorCamera.OnUpdate(ts);
-
-        m_ActiveScene->OnUpdateEditor(ts, m_EditorCamera);
+        switch (m_SceneState) {
+            case SceneState::Edit: {
+                m_EditorCamera.OnUpdate(ts);
+                m_ActiveScene->OnUpdateEditor(ts, m_EditorCamera);
 
-        // Render
-        Renderer2D::ResetStatistics();
-        FrameBuffer::Bind(m_FrameBuffer);
-        RenderCommand::SetClearColor({ 0.16f, 0.16f, 0.16f, 0.9f });
-        RenderCommand::Clear();
-
-        // Clear entity Id attachment to -1
-        m_FrameBuffer->ClearColorAttachment(1, -1);
-
-        m_ActiveScene->OnRenderEditor(m_EditorCamera);
-
-        auto [mouseX, mouseY] = ImGui::GetMousePos();
-        mouseX -= m_ViewportBounds[0].x;
-        mouseY  = static_cast<float>(m_ViewportSize.y) - (mouseY - m_ViewportBounds[0].y);
+                break;
+            }
 
-        glm::vec2 viewportSize = { m_ViewportBounds[1] - m_ViewportBounds[0] };
+            case SceneState::Play: {
+                m_ActiveScene->OnUpdateRuntime(ts);
 
-        if (mouseX >= 0.0f && mouseY >= 0.0f && mouseX < viewportSize.x && mouseY < viewportSize.y) {
-            int pixelData = m_FrameBuffer->ReadPixel(1, static_cast<int>(mouseX), static_cast<int>(mouseY));
+                break;
+            }
+        }
 
-            m_HoveredEntity = pixelData == -1 ? Entity::Null : Entity((entt::entity)pixelData, m_ActiveScene.get());
+        // Render
+        Renderer2D::ResetStatistics();
+        MeshQueue::ResetStatistics();
+
+        // Minimized, the last frame stays on the viewport
+        if (m_ViewportSize.x == 0 || m_ViewportSize.y == 0)
+            return;
+
+        RenderGraph::TextureDescription description = { m_ViewportSize.x, m_ViewportSize.y, FrameBufferTextureFormat::RGBA8 };
+
+        m_ViewportTexture = m_RenderGraph.CreateTexture(description);
+
+        description.Format = FrameBufferTextureFormat::RedInteger;
+        RenderGraph::TextureId entityTexture = m_RenderGraph.CreateTexture(description);
+
+        description.Format = FrameBufferTextureFormat::Depth;
+        RenderGraph::TextureId depthTexture = m_RenderGraph.CreateTexture(description);
+
+        // The entity id attachment is left out and never cleared unless a click is picked this frame
+        m_RenderGraph.AddPass(
+            "Scene",
+            [&](RenderGraph::PassBuilder& builder) {
+                builder.Write(m_ViewportTexture, glm::vec4(0.16f, 0.16f, 0.16f, 0.9f));
+                builder.Write(entityTexture, -1);
+                builder.WriteDepth(depthTexture, 1.0f);
+            },
+            [this] {
+                switch (m_SceneState) {
+                    case SceneState::Edit: m_ActiveScene->OnRenderEditor(m_EditorCamera); break;
+                    case SceneState::Play: m_ActiveScene->OnRenderRuntime();              break;
+                }
+            }
+        );
+
+        if (m_IsPickRequested) {
+            m_RenderGraph.AddPass(
+                "Picking",
+                [&](RenderGraph::PassBuilder& builder) {
+                    builder.Read(entityTexture);
+                    builder.SetSideEffect();
+                },
+                [this, entityTexture] { PickEntity(entityTexture); }
+            );
+
+            m_IsPickRequested = false;
         }
 
-        FrameBuffer::Unbind();
+        m_RenderGraph.Export(m_ViewportTexture);
+        m_RenderGraph.Execute();
+
+        UpdateHoveredEntity();
     }
 
     void EditorLayer::OnImGuiRender() {
@@ -288,6 +323,9 @@ namespace Ziben {
                     if (ImGui::MenuItem("Open...", "Ctrl+O"))
                         OpenScene();
 
+                    if (ImGui::MenuItem("Save", "Ctrl+S"))
+                        SaveScene();
+
                     if (ImGui::MenuItem("Save As...", "Ctrl+Shift+S"))
                         SaveSceneAs();
 
@@ -297,6 +335,16 @@ namespace Ziben {
                     ImGui::EndMenu();
                 }
 
+                if (ImGui::BeginMenu("Scene")) {
+                    if (ImGui::MenuItem("Play", "F5", false, m_SceneState == SceneState::Edit))
+                        OnScenePlay();
+
+                    if (ImGui::MenuItem("Stop", "Shift+F5", false, m_SceneState == SceneState::Play))
+                        OnSceneStop();
+
+                    ImGui::EndMenu();
+                }
+
                 ImGui::EndMenuBar();
             }
 
@@ -311,12 +359,104 @@ namespace Ziben {
                 std::string name = m_HoveredEntity ? m_HoveredEntity.GetComponent<TagComponent>().Tag : "None";
                 ImGui::Text("Hovered Entity: %s", name.c_str());
 
+                if (m_SceneLoader.IsLoading()) {
+                    ImGui::Text("Loading: %s", m_SceneLoader.GetFilepath().c_str());
+                    ImGui::ProgressBar(m_SceneLoader.GetProgress());
+                }
+
                 ImGui::Separator();
                 ImGui::Text("Renderer2D Statistics: ");
                 ImGui::Text("Draw Calls: %d",   statistics.DrawCalls);
                 ImGui::Text("Quad Count: %d",   statistics.QuadCount);
                 ImGui::Text("Vertex Count: %d", statistics.QuadCount * 4);
                 ImGui::Text("Index Count: %d",  statistics.QuadCount * 6);
+                ImGui::Text("Submitted Quads: %d", statistics.SubmittedQuadCount);
+                ImGui::Text("Culled Quads: %d",    statistics.CulledQuadCount);
+                ImGui::Text("Static Quads: %d",    statistics.StaticQuadCount);
+                ImGui::Text("Static Chunk Uploads: %d", statistics.StaticChunkUploads);
+                ImGui::Text("Tilemaps: %d", statistics.TilemapCount);
+                ImGui::Text("Tilemap Chunk Uploads: %d", statistics.TilemapChunkUploads);
+                ImGui::Text("Texture Mode: %s", Renderer2D::GetTextureModeName(statistics.CurrentTextureMode));
+                ImGui::Text("Texture Slot Flushes: %d", statistics.TextureSlotFlushes);
+
+                if (float mipBias = Renderer2D::GetMipBias(); ImGui::DragFloat("Sprite Mip Bias", &mipBias, 0.05f, -2.0f, 4.0f))
+                    Renderer2D::SetMipBias(mipBias);
+
+                const auto& meshStatistics = MeshQueue::GetStatistics();
+
+                ImGui::Separator();
+                ImGui::Text("MeshQueue Statistics: ");
+                ImGui::Text("Draw Calls: %d",        meshStatistics.DrawCalls);
+                ImGui::Text("Indirect Commands: %d", meshStatistics.CommandCount);
+                ImGui::Text("Objects: %d",           meshStatistics.ObjectCount);
+                ImGui::Text("Triangles: %d",         meshStatistics.TriangleCount);
+                ImGui::Text("Culled Objects: %d",    meshStatistics.CulledCount);
+                ImGui::Text("Meshes: %d",            meshStatistics.MeshCount);
+                ImGui::Text("Vertex Count: %d",      meshStatistics.VertexCount);
+                ImGui::Text("Index Count: %d",       meshStatistics.IndexCount);
+
+                const auto& loaderStatistics = TextureLoader::GetStatistics();
+
+                ImGui::Separator();
+                ImGui::Text("TextureLoader Statistics: ");
+                ImGui::Text("Pending Textures: %d", loaderStatistics.PendingCount);
+                ImGui::Text("Loaded Textures: %d",  loaderStatistics.LoadedCount);
+                ImGui::Text("Failed Textures: %d",  loaderStatistics.FailedCount);
+                ImGui::Text("Frame Upload: %0.2f MB", static_cast<float>(loaderStatistics.FrameUploadedBytes) / (1024.0f * 1024.0f));
+                ImGui::Text("Staging Stalls: %d", loaderStatistics.StagingStalls);
+                ImGui::Text("Last Batch: %d textures in %0.1f ms", loaderStatistics.BatchTextureCount, loaderStatistics.BatchMilliseconds);
+                ImGui::Text("Last Batch Throughput: %0.1f MB/s", loaderStatistics.BatchThroughput);
+
+                const auto assetStatistics = AssetManager::GetStatistics();
+
+                ImGui::Separator();
+                ImGui::Text("AssetManager Statistics: ");
+                ImGui::Text("Textures: %d", assetStatistics.TextureCount);
+                ImGui::Text("Shaders: %d",  assetStatistics.ShaderCount);
+                ImGui::Text("Meshes: %d",   assetStatistics.MeshCount);
+                ImGui::Text("Path Hits: %d",    assetStatistics.PathHits);
+                ImGui::Text("Content Hits: %d", assetStatistics.ContentHits);
+                ImGui::Text("Decode Cache Hits: %d",   assetStatistics.DecodeCacheHits);
+                ImGui::Text("Decode Cache Misses: %d", assetStatistics.DecodeCacheMisses);
+
+                const auto& shaderStatistics = Shader::GetStatistics();
+
+                ImGui::Separator();
+                ImGui::Text("Shader Statistics: ");
+                ImGui::Text("Compiled: %d in %0.1f ms", shaderStatistics.CompiledCount, shaderStatistics.CompileMilliseconds);
+                ImGui::Text("From Binary Cache: %d in %0.1f ms", shaderStatistics.CachedCount, shaderStatistics.CacheMilliseconds);
+                ImGui::Text("Rejected Binaries: %d", shaderStatistics.RejectedCount);
+
+                const auto& reloaderStatistics = ShaderReloader::GetStatistics();
+
+                ImGui::Separator();
+                ImGui::Text("ShaderReloader Statistics: ");
+                ImGui::Text("Parallel Compile: %s", reloaderStatistics.IsParallel ? "Yes" : "No");
+                ImGui::Text("Watched Files: %d",  reloaderStatistics.WatchedCount);
+                ImGui::Text("Pending Builds: %d", reloaderStatistics.PendingCount);
+                ImGui::Text("Reloaded: %d",       reloaderStatistics.ReloadedCount);
+                ImGui::Text("Failed: %d",         reloaderStatistics.FailedCount);
+                ImGui::Text("Last Reload: %0.1f ms", reloaderStatistics.LastReloadMilliseconds);
+
+                const auto& renderGraphStatistics = m_RenderGraph.GetStatistics();
+
+                ImGui::Separator();
+                ImGui::Text("RenderGraph Statistics: ");
+                ImGui::Text("Passes: %d",              renderGraphStatistics.PassCount);
+                ImGui::Text("Culled Passes: %d",       renderGraphStatistics.CulledPassCount);
+                ImGui::Text("Culled Attachments: %d",  renderGraphStatistics.CulledAttachments);
+                ImGui::Text("Clears: %d",              renderGraphStatistics.Clears);
+                ImGui::Text("Allocated Textures: %d",  renderGraphStatistics.AllocatedTextures);
+                ImGui::Text("Aliased Textures: %d",    renderGraphStatistics.AliasedTextures);
+                ImGui::Text("Pooled Textures: %d",     renderGraphStatistics.TextureCount);
+                ImGui::Text("Pooled FrameBuffers: %d", renderGraphStatistics.FrameBufferCount);
+
+                const auto& renderStateStatistics = RenderState::GetStatistics();
+
+                ImGui::Separator();
+                ImGui::Text("RenderState Statistics: ");
+                ImGui::Text("State Calls: %d",   renderStateStatistics.Calls);
+                ImGui::Text("Skipped Calls: %d", renderStateStatistics.SkippedCalls);
 
                 ImGui::Separator();
                 ImGui::Text("Application");
@@ -350,16 +490,27 @@ namespace Ziben {
                 auto viewportPanelSize = ImGui::GetContentRegionAvail();
                 m_ViewportSize = { viewportPanelSize.x, viewportPanelSize.y };
 
+                HandleType viewportTexture = 0;
+                glm::vec2  viewportScale   = glm::vec2(1.0f);
+
+                // Only the corner of the bucket sized texture is rendered
+                if (m_ViewportTexture != RenderGraph::s_NullTexture) {
+                    viewportTexture = m_RenderGraph.GetTextureHandle(m_ViewportTexture);
+                    viewportScale   = m_RenderGraph.GetTextureScale(m_ViewportTexture);
+                }
+
                 ImGui::Image(
-                    reinterpret_cast<void*>(m_FrameBuffer->GetColorAttachmentHandle(0)),
+                    reinterpret_cast<void*>(viewportTexture),
                     viewportPanelSize,
-                    ImVec2(0, 1),
-                    ImVec2(1, 0)
+                    ImVec2(0, viewportScale.y),
+                    ImVec2(viewportScale.x, 0)
                 );
 
+                UpdateBoxSelection();
+
                 // Gizmos
                 if (Entity selectedEntity = m_SceneHierarchyPanel.GetSelectedEntity();
-                    selectedEntity && m_GuizmoType != -1
+                    selectedEntity && m_GuizmoType != -1 && m_SceneState == SceneState::Edit
                 ) {
                     ImGuizmo::SetOrthographic(false);
                     ImGuizmo::SetDrawlist();
@@ -417,9 +568,11 @@ namespace Ziben {
 
                         glm::vec3 deltaRotation = rotation - entityTransformComponent.GetRotation();
 
-                        entityTransformComponent.SetTranslation(translation);
-                        entityTransformComponent.SetRotation(entityTransformComponent.GetRotation() + deltaRotation);
-                        entityTransformComponent.SetScale(scale);
+                        selectedEntity.PatchComponent<TransformComponent>([&](TransformComponent& component) {
+                            component.SetTranslation(translation);
+                            component.SetRotation(component.GetRotation() + deltaRotation);
+                            component.SetScale(scale);
+                        });
                     }
                 }
             }
@@ -454,6 +607,17 @@ namespace Ziben {
             case Key::S: {
                 if (control && shift)
                     SaveSceneAs();
+                else if (control)
+                    SaveScene();
+
+                break;
+            }
+
+            case Key::F5: {
+                if (shift)
+                    OnSceneStop();
+                else
+                    OnScenePlay();
 
                 break;
             }
@@ -471,9 +635,10 @@ namespace Ziben {
     }
 
     bool EditorLayer::OnMouseButtonPressed(MouseButtonPressedEvent& event) {
-        if (event.GetButtonCode() == Button::Left)
-            if (CanPick())
-                m_SceneHierarchyPanel.SetSelectedEntity(m_HoveredEntity);
+        // Shift starts a box selection instead
+        // The entity is read back from the next rendered frame
+        if (event.GetButtonCode() == Button::Left && !Input::IsKeyPressed({ Key::LeftShift, Key::RightShift }))
+            m_IsPickRequested = CanPick();
 
         return false;
     }
@@ -488,34 +653,185 @@ namespace Ziben {
         return m_IsViewportHovered && !ImGuizmo::IsOver() && !m_EditorCamera.IsActive();
     }
 
-    void EditorLayer::NewScene() {
-        m_ActiveScene = CreateRef<Scene>("New");
-        m_ActiveScene->OnViewportResize(m_ViewportSize.x, m_ViewportSize.y);
+    bool EditorLayer::GetViewProjectionMatrix(glm::mat4& viewProjection) {
+        if (m_SceneState == SceneState::Edit) {
+            viewProjection = m_EditorCamera.GetViewProjectionMatrix();
+            return true;
+        }
 
-        m_SceneHierarchyPanel.SetScene(m_ActiveScene);
+        Entity cameraEntity = m_ActiveScene->GetPrimaryCameraEntity();
+
+        if (!cameraEntity)
+            return false;
+
+        const auto& cameraComponent    = cameraEntity.GetComponent<CameraComponent>();
+        const auto& transformComponent = cameraEntity.GetComponent<TransformComponent>();
+
+        viewProjection = cameraComponent.Camera.GetProjectionMatrix() * glm::inverse(transformComponent.GetTransform());
+
+        return true;
+    }
+
+    glm::vec2 EditorLayer::GetViewportNdc(const glm::vec2& position) const {
+        glm::vec2 viewportSize = glm::max(m_ViewportBounds[1] - m_ViewportBounds[0], glm::vec2(1.0f));
+        glm::vec2 uv           = (position - m_ViewportBounds[0]) / viewportSize;
+
+        return { uv.x * 2.0f - 1.0f, 1.0f - uv.y * 2.0f };
+    }
+
+    void EditorLayer::UpdateHoveredEntity() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto [mouseX, mouseY] = ImGui::GetMousePos();
+        glm::vec2 ndc         = GetViewportNdc({ mouseX, mouseY });
+        glm::mat4 viewProjection;
+
+        if (glm::any(glm::greaterThan(glm::abs(ndc), glm::vec2(1.0f))) || !GetViewProjectionMatrix(viewProjection)) {
+            m_HoveredEntity = Entity::Null;
+            return;
+        }
+
+        // Ray through the mouse from the near to the far plane is traced on the CPU,
+        // the entity id attachment isn't read back every frame
+        glm::mat4 inverseViewProjection = glm::inverse(viewProjection);
+        glm::vec4 nearPoint             = inverseViewProjection * glm::vec4(ndc, -1.0f, 1.0f);
+        glm::vec4 farPoint              = inverseViewProjection * glm::vec4(ndc,  1.0f, 1.0f);
+
+        glm::vec3 origin    = glm::vec3(nearPoint) / nearPoint.w;
+        glm::vec3 direction = glm::vec3(farPoint) / farPoint.w - origin;
+
+        m_HoveredEntity = m_ActiveScene->Raycast(origin, direction, 1.0f);
+    }
+
+    void EditorLayer::PickEntity(RenderGraph::TextureId entityTexture) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto [mouseX, mouseY] = ImGui::GetMousePos();
+
+        // The attachment rows go bottom up
+        int x = static_cast<int>(mouseX - m_ViewportBounds[0].x);
+        int y = static_cast<int>(m_ViewportSize.y) - 1 - static_cast<int>(mouseY - m_ViewportBounds[0].y);
+
+        if (x < 0 || y < 0 || x >= static_cast<int>(m_ViewportSize.x) || y >= static_cast<int>(m_ViewportSize.y))
+            return;
+
+        int entityHandle = m_RenderGraph.ReadPixel(entityTexture, x, y);
+
+        m_SceneHierarchyPanel.SetSelectedEntity(
+            entityHandle == -1 ? Entity::Null : Entity(static_cast<entt::entity>(entityHandle), m_ActiveScene.get())
+        );
+    }
+
+    void EditorLayer::UpdateBoxSelection() {
+        auto [mouseX, mouseY] = ImGui::GetMousePos();
+        glm::vec2 mouse       = { mouseX, mouseY };
+
+        if (!m_IsBoxSelecting) {
+            m_IsBoxSelecting = ImGui::IsMouseClicked(ImGuiMouseButton_Left)
+                && Input::IsKeyPressed({ Key::LeftShift, Key::RightShift })
+                && CanPick();
+
+            m_BoxSelectionStart = mouse;
+
+            return;
+        }
+
+        glm::vec2 min = glm::min(m_BoxSelectionStart, mouse);
+        glm::vec2 max = glm::max(m_BoxSelectionStart, mouse);
+
+        ImGui::GetWindowDrawList()->AddRectFilled({ min.x, min.y }, { max.x, max.y }, IM_COL32(70, 130, 220, 40));
+        ImGui::GetWindowDrawList()->AddRect({ min.x, min.y }, { max.x, max.y }, IM_COL32(70, 130, 220, 200));
+
+        if (!ImGui::IsMouseReleased(ImGuiMouseButton_Left))
+            return;
+
+        m_IsBoxSelecting = false;
+
+        // Screen y goes down, so the corners swap in the normalized device coordinates
+        glm::vec2 ndcMin = GetViewportNdc({ min.x, max.y });
+        glm::vec2 ndcMax = GetViewportNdc({ max.x, min.y });
+        glm::mat4 viewProjection;
+
+        if (GetViewProjectionMatrix(viewProjection))
+            m_SceneHierarchyPanel.SetSelectedEntities(m_ActiveScene->QueryFrustum(Frustum(viewProjection, ndcMin, ndcMax)));
+    }
+
+    void EditorLayer::NewScene() {
+        SetActiveScene(CreateRef<Scene>("New"), {});
     }
 
     void EditorLayer::OpenScene() {
         std::string filepath = FileDialogs::OpenFile("Ziben Scene (*.ziben)\0*.ziben\0");
 
-        if (!filepath.empty()) {
-            m_ActiveScene = CreateRef<Scene>("New");
-            m_ActiveScene->OnViewportResize(m_ViewportSize.x, m_ViewportSize.y);
+        // The current scene stays active until the new one is loaded
+        if (!filepath.empty())
+            m_SceneLoader.Load(filepath);
+    }
 
-            m_SceneHierarchyPanel.SetScene(m_ActiveScene);
+    void EditorLayer::SaveScene() {
+        if (m_ActiveScenePath.empty())
+            return SaveSceneAs();
 
-            SceneSerializer serializer(m_ActiveScene);
-            serializer.Deserialize(filepath);
-        }
+        // Only entities changed since the last save are written
+        SceneSerializer serializer(GetEditorScene());
+        serializer.SerializeIncremental(m_ActiveScenePath);
     }
 
     void EditorLayer::SaveSceneAs() {
         std::string filepath = FileDialogs::SaveFile("Ziben Scene (*.ziben)\0*.ziben\0");
 
         if (!filepath.empty()) {
-            SceneSerializer serializer(m_ActiveScene);
-            serializer.Serialize(filepath);
+            SceneSerializer serializer(GetEditorScene());
+
+            if (serializer.Serialize(filepath))
+                m_ActiveScenePath = filepath;
         }
     }
 
+    void EditorLayer::SetActiveScene(const Ref<Scene>& scene, const std::string& filepath) {
+        OnSceneStop();
+
+        m_ActiveScene     = scene;
+        m_ActiveScenePath = filepath;
+        m_HoveredEntity   = Entity::Null;
+
+        m_ActiveScene->OnViewportResize(m_ViewportSize.x, m_ViewportSize.y);
+        m_SceneHierarchyPanel.SetScene(m_ActiveScene);
+
+        // Assets of the previous scene are freed with it
+        AssetManager::CollectGarbage();
+    }
+
+    const Ref<Scene>& EditorLayer::GetEditorScene() const {
+        // Saving during play writes the authored scene, the runtime copy keeps running
+        return m_SceneState == SceneState::Play ? m_EditorScene : m_ActiveScene;
+    }
+
+    void EditorLayer::OnScenePlay() {
+        if (m_SceneState == SceneState::Play)
+            return;
+
+        // Runtime works on a copy, the authored scene is restored on stop
+        m_EditorScene = m_ActiveScene;
+        m_ActiveScene = Scene::Copy(m_EditorScene);
+        m_SceneState  = SceneState::Play;
+
+        m_ActiveScene->OnViewportResize(m_ViewportSize.x, m_ViewportSize.y);
+        m_SceneHierarchyPanel.SetScene(m_ActiveScene);
+    }
+
+    void EditorLayer::OnSceneStop() {
+        if (m_SceneState == SceneState::Edit)
+            return;
+
+        m_ActiveScene->OnRuntimeStop();
+
+        m_ActiveScene   = std::move(m_EditorScene);
+        m_SceneState    = SceneState::Edit;
+        m_HoveredEntity = Entity::Null;
+
+        m_ActiveScene->OnViewportResize(m_ViewportSize.x, m_ViewportSize.y);
+        m_SceneHierarchyPanel.SetScene(m_ActiveScene);
+    }
+
 } // namespace Ziben
\ No newline at end of file
@@ -3,12 +3,13 @@
 #include <glm/glm.hpp>
 
 #include <Ziben/Scene/Layer.hpp>
-#include <Ziben/Renderer/FrameBuffer.hpp>
+#include <Ziben/Renderer/RenderGraph.hpp>
 #include <Ziben/Window/KeyEvent.hpp>
 #include <Ziben/Window/WindowEvent.hpp>
 #include <Ziben/Window/MouseEvent.hpp>
 #include <Ziben/Scene/Scene.hpp>
 #include <Ziben/Scene/Entity.hpp>
+#include <Ziben/Scene/SceneLoader.hpp>
 #include <Ziben/Renderer/EditorCamera.hpp>
 
 #include "Panels/SceneHierarchyPanel.hpp"
@@ -16,6 +17,9 @@
 namespace Ziben {
 
     class EditorLayer : public Layer {
+    public:
+        enum class SceneState : uint8_t { Edit = 0, Play = 1 };
+
     public:
         EditorLayer();
 
@@ -32,19 +36,48 @@ namespace Ziben {
 
         bool CanPick();
 
+        // Camera that the viewport is rendered with, false if the running scene has no primary camera
+        bool GetViewProjectionMatrix(glm::mat4& viewProjection);
+
+        // Viewport position in screen space to [-1, 1]
+        [[nodiscard]] glm::vec2 GetViewportNdc(const glm::vec2& position) const;
+
+        void UpdateHoveredEntity();
+
+        // Reads the entity under the mouse back from the entity id attachment
+        void PickEntity(RenderGraph::TextureId entityTexture);
+        void UpdateBoxSelection();
+
         void NewScene();
         void OpenScene();
+        void SaveScene();
         void SaveSceneAs();
+        void SetActiveScene(const Ref<Scene>& scene, const std::string& filepath);
+
+        // The authored scene, during play the active one is its runtime copy
+        [[nodiscard]] const Ref<Scene>& GetEditorScene() const;
+
+        void OnScenePlay();
+        void OnSceneStop();
 
     private:
-        Ref<FrameBuffer>             m_FrameBuffer;
+        RenderGraph                  m_RenderGraph;
+        RenderGraph::TextureId       m_ViewportTexture;
         Ref<Scene>                   m_ActiveScene;
+        Ref<Scene>                   m_EditorScene;
+        std::string                  m_ActiveScenePath;
+        SceneState                   m_SceneState;
+        SceneLoader                  m_SceneLoader;
 
         Entity                       m_HoveredEntity;
+        bool                         m_IsPickRequested;
+        bool                         m_IsBoxSelecting;
+        glm::vec2                    m_BoxSelectionStart;
 
         EditorCamera                 m_EditorCamera;
 
         glm::vec<2, uint32_t>        m_ViewportSize;
+        glm::vec<2, uint32_t>        m_RenderedViewportSize;
         std::array<glm::vec2, 2>     m_ViewportBounds;
         bool                         m_IsViewportFocused;
         bool                         m_IsViewportHovered;
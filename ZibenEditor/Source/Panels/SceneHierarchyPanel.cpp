@@ -14,13 +14,28 @@ namespace Ziben {
 
     }
 
+    bool SceneHierarchyPanel::IsSelected(const Entity& entity) const {
+        return std::find(m_SelectedEntities.begin(), m_SelectedEntities.end(), entity) != m_SelectedEntities.end();
+    }
+
     void SceneHierarchyPanel::SetSelectedEntity(const Entity& entity) {
         m_SelectedEntity = entity;
+
+        m_SelectedEntities.clear();
+
+        if (entity)
+            m_SelectedEntities.push_back(entity);
+    }
+
+    void SceneHierarchyPanel::SetSelectedEntities(std::vector<Entity> entities) {
+        m_SelectedEntities = std::move(entities);
+        m_SelectedEntity   = m_SelectedEntities.empty() ? Entity::Null : m_SelectedEntities.front();
     }
 
     void SceneHierarchyPanel::SetScene(const Ref<Scene>& scene) {
-        m_Scene          = scene;
-        m_SelectedEntity = Entity::Null;
+        m_Scene = scene;
+
+        SetSelectedEntity(Entity::Null);
     }
 
     void SceneHierarchyPanel::OnImGuiRender() {
@@ -32,7 +47,7 @@ namespace Ziben {
                 });
 
                 if (ImGui::IsMouseDown(0) && ImGui::IsWindowHovered())
-                    m_SelectedEntity = Entity::Null;
+                    SetSelectedEntity(Entity::Null);
 
                 // Right-click on blank space
                 if (ImGui::BeginPopupContextWindow(nullptr, ImGuiMouseButton_Right, false)) {
@@ -56,7 +71,7 @@ namespace Ziben {
     void SceneHierarchyPanel::DrawEntityNode(const Entity& entity) {
         auto& tag = entity.GetComponent<TagComponent>().Tag;
 
-        ImGuiTreeNodeFlags flags = (m_SelectedEntity == entity ? ImGuiTreeNodeFlags_Selected : 0) | ImGuiTreeNodeFlags_OpenOnArrow;
+        ImGuiTreeNodeFlags flags = (IsSelected(entity) ? ImGuiTreeNodeFlags_Selected : 0) | ImGuiTreeNodeFlags_OpenOnArrow;
 
         flags |= ImGuiTreeNodeFlags_SpanAvailWidth;
 
@@ -66,7 +81,7 @@ namespace Ziben {
         }
 
         if (ImGui::IsItemClicked(ImGuiMouseButton_Left))
-            m_SelectedEntity = entity;
+            SetSelectedEntity(entity);
 
         bool isEntityDeleted = false;
 
@@ -78,8 +93,10 @@ namespace Ziben {
         }
 
         if (isEntityDeleted) {
-            if (m_SelectedEntity == entity)
-                m_SelectedEntity = Entity::Null;
+            if (IsSelected(entity)) {
+                std::erase(m_SelectedEntities, entity);
+                SetSelectedEntities(std::move(m_SelectedEntities));
+            }
 
             m_Scene->DestroyEntity(entity);
         }
@@ -97,7 +114,7 @@ namespace Ziben {
             ImGui::PushItemWidth(ImGui::GetContentRegionAvailWidth() - 150.0f);
 
             if (ImGui::InputText("##Tag", buffer, sizeof(buffer)))
-                tag = buffer;
+                m_SelectedEntity.PatchComponent<TagComponent>([&](TagComponent& tagComponent) { tagComponent.Tag = buffer; });
 
             ImGui::PopItemWidth();
             ImGui::SameLine();
@@ -117,6 +134,21 @@ namespace Ziben {
                     ImGui::CloseCurrentPopup();
                 }
 
+                if (ImGui::MenuItem("TilemapComponent")) {
+                    m_SelectedEntity.PushComponent<TilemapComponent>(TilemapComponent::ChunkSize, TilemapComponent::ChunkSize);
+                    ImGui::CloseCurrentPopup();
+                }
+
+                if (ImGui::MenuItem("MeshComponent")) {
+                    m_SelectedEntity.PushComponent<MeshComponent>();
+                    ImGui::CloseCurrentPopup();
+                }
+
+                if (ImGui::MenuItem("MaterialComponent")) {
+                    m_SelectedEntity.PushComponent<MaterialComponent>();
+                    ImGui::CloseCurrentPopup();
+                }
+
                 ImGui::EndPopup();
             }
 
@@ -124,20 +156,29 @@ namespace Ziben {
         }
 
         DrawComponent<TransformComponent>("TransformComponent", false, [&](TransformComponent& component) {
-            if (auto translation = component.GetTranslation(); ImGui::DragFloat3("Translation", glm::value_ptr(translation), 0.1f))
+            bool isChanged = false;
+
+            if (auto translation = component.GetTranslation(); ImGui::DragFloat3("Translation", glm::value_ptr(translation), 0.1f)) {
                 component.SetTranslation(translation);
+                isChanged = true;
+            }
 
-            if (auto rotation = glm::degrees(component.GetRotation()); ImGui::DragFloat3("Rotation", glm::value_ptr(rotation), 0.1f))
+            if (auto rotation = glm::degrees(component.GetRotation()); ImGui::DragFloat3("Rotation", glm::value_ptr(rotation), 0.1f)) {
                 component.SetRotation(glm::radians(rotation));
+                isChanged = true;
+            }
 
-            if (auto scale = component.GetScale(); ImGui::DragFloat3("Scale", glm::value_ptr(scale), 0.1f))
+            if (auto scale = component.GetScale(); ImGui::DragFloat3("Scale", glm::value_ptr(scale), 0.1f)) {
                 component.SetScale(scale);
+                isChanged = true;
+            }
+
+            return isChanged;
         });
 
         DrawComponent<CameraComponent>("CameraComponent", true, [&](CameraComponent& component) {
-            auto& camera = component.Camera;
-
-            ImGui::Checkbox("Primary", &component.IsPrimary);
+            auto& camera    = component.Camera;
+            bool  isChanged = ImGui::Checkbox("Primary", &component.IsPrimary);
 
             const char* projectionTypeStrings[] = { "Perspective", "Orthographic" };
             const char* currentProjectionTypeString = projectionTypeStrings[static_cast<int8_t>(camera.GetProjectionType())];
@@ -149,6 +190,7 @@ namespace Ziben {
                     if (ImGui::Selectable(projectionTypeStrings[i], isSelected)) {
                         currentProjectionTypeString = projectionTypeStrings[i];
                         camera.SetProjectionType(static_cast<SceneCamera::ProjectionType>(i));
+                        isChanged = true;
                     }
 
                     if (isSelected)
@@ -164,14 +206,20 @@ namespace Ziben {
                     float near = camera.GetPerspectiveProps().Near;
                     float far  = camera.GetPerspectiveProps().Far;
 
-                    if (ImGui::DragFloat("Fov", &fov, 0.1f))
+                    if (ImGui::DragFloat("Fov", &fov, 0.1f)) {
                         camera.SetPerspectiveFov(glm::radians(fov));
+                        isChanged = true;
+                    }
 
-                    if (ImGui::DragFloat("Near", &near, 0.1f))
+                    if (ImGui::DragFloat("Near", &near, 0.1f)) {
                         camera.SetPerspectiveNear(near);
+                        isChanged = true;
+                    }
 
-                    if (ImGui::DragFloat("Far", &far, 0.1f))
+                    if (ImGui::DragFloat("Far", &far, 0.1f)) {
                         camera.SetPerspectiveFar(far);
+                        isChanged = true;
+                    }
 
                     break;
                 }
@@ -181,26 +229,99 @@ namespace Ziben {
                     float near                = camera.GetOrthographicProps().Near;
                     float far                 = camera.GetOrthographicProps().Far;
 
-                    if (ImGui::DragFloat("Size", &size, 0.1f))
+                    if (ImGui::DragFloat("Size", &size, 0.1f)) {
                         camera.SetOrthographicSize(size);
+                        isChanged = true;
+                    }
 
-                    if (ImGui::DragFloat("Near", &near, 0.1f))
+                    if (ImGui::DragFloat("Near", &near, 0.1f)) {
                         camera.SetOrthographicNear(near);
+                        isChanged = true;
+                    }
 
-                    if (ImGui::DragFloat("Far", &far, 0.1f))
+                    if (ImGui::DragFloat("Far", &far, 0.1f)) {
                         camera.SetOrthographicFar(far);
+                        isChanged = true;
+                    }
 
-                    ImGui::Checkbox("Fixes Aspect Ratio", &component.HasFixedAspectRatio);
+                    isChanged |= ImGui::Checkbox("Fixes Aspect Ratio", &component.HasFixedAspectRatio);
 
                     break;
                 }
             }
+
+            return isChanged;
         });
 
         DrawComponent<SpriteRendererComponent>("SpriteRendererComponent", true, [&](SpriteRendererComponent& component) {
-            auto& color = component.Color;
+            auto& color     = component.Color;
+            bool  isChanged = ImGui::ColorEdit4("Color", glm::value_ptr(color));
+
+            if (ImGui::Checkbox("Static", &component.IsStatic))
+                isChanged = true;
+
+            return isChanged;
+        });
+
+        DrawComponent<TilemapComponent>("TilemapComponent", true, [&](TilemapComponent& component) {
+            bool isChanged = false;
+
+            if (int size[2] = { static_cast<int>(component.GetWidth()), static_cast<int>(component.GetHeight()) }; ImGui::DragInt2("Size", size, 1.0f, 0, TilemapComponent::MaxSize)) {
+                component.Resize(static_cast<uint32_t>(std::max(size[0], 0)), static_cast<uint32_t>(std::max(size[1], 0)));
+                isChanged = true;
+            }
+
+            char buffer[256] = { 0 };
+            strcpy_s(buffer, sizeof(buffer), component.TilesetPath.c_str());
+
+            if (ImGui::InputText("Tileset", buffer, sizeof(buffer), ImGuiInputTextFlags_EnterReturnsTrue)) {
+                component.TilesetPath = buffer;
+                isChanged             = true;
+            }
+
+            isChanged |= ImGui::DragFloat2("Cell Size", glm::value_ptr(component.TilesetCellSize), 1.0f, 1.0f, 4096.0f);
+            isChanged |= ImGui::ColorEdit4("Color", glm::value_ptr(component.Color));
+
+            // Whole map fill, single tiles are edited from scripts through SetTile
+            static int fillTile = 1;
+
+            ImGui::DragInt("##FillTile", &fillTile, 1.0f, 0, std::numeric_limits<TilemapComponent::TileType>::max());
+            ImGui::SameLine();
+
+            if (ImGui::Button("Fill")) {
+                component.Fill(0, 0, component.GetWidth(), component.GetHeight(), static_cast<TilemapComponent::TileType>(fillTile));
+                isChanged = true;
+            }
+
+            return isChanged;
+        });
+
+        DrawComponent<MeshComponent>("MeshComponent", true, [&](MeshComponent& component) {
+            char buffer[256] = { 0 };
+            strcpy_s(buffer, sizeof(buffer), component.MeshPath.c_str());
+
+            if (ImGui::InputText("Mesh", buffer, sizeof(buffer), ImGuiInputTextFlags_EnterReturnsTrue)) {
+                component.MeshPath = buffer;
+                return true;
+            }
+
+            return false;
+        });
+
+        DrawComponent<MaterialComponent>("MaterialComponent", true, [&](MaterialComponent& component) {
+            bool isChanged = false;
+
+            char buffer[256] = { 0 };
+            strcpy_s(buffer, sizeof(buffer), component.ShaderPath.c_str());
+
+            if (ImGui::InputText("Shader", buffer, sizeof(buffer), ImGuiInputTextFlags_EnterReturnsTrue)) {
+                component.ShaderPath = buffer;
+                isChanged            = true;
+            }
+
+            isChanged |= ImGui::ColorEdit4("Color", glm::value_ptr(component.Color));
 
-            ImGui::ColorEdit4("Color", glm::value_ptr(color));
+            return isChanged;
         });
     }
 
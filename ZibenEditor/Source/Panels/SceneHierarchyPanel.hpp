@@ -16,9 +16,14 @@ namespace Ziben {
 
     public:
         [[nodiscard]] inline const Entity& GetSelectedEntity() const { return m_SelectedEntity; }
+        [[nodiscard]] inline const std::vector<Entity>& GetSelectedEntities() const { return m_SelectedEntities; }
+        [[nodiscard]] bool IsSelected(const Entity& entity) const;
 
         void SetSelectedEntity(const Entity& entity);
 
+        // The first entity becomes the primary selection shown in the properties panel
+        void SetSelectedEntities(std::vector<Entity> entities);
+
         void SetScene(const Ref<Scene>& scene);
         void OnImGuiRender();
 
@@ -30,8 +35,9 @@ namespace Ziben {
         void DrawComponent(const char* name, bool canBeDeleted, const Function& function);
 
     private:
-        Ref<Scene> m_Scene;
-        Entity     m_SelectedEntity;
+        Ref<Scene>          m_Scene;
+        Entity              m_SelectedEntity;
+        std::vector<Entity> m_SelectedEntities;
 
     }; // class SceneHierarchyPanel
 
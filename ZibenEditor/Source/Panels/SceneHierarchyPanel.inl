@@ -26,7 +26,9 @@ namespace Ziben {
                     ImGui::EndPopup();
                 }
 
-                function(component);
+                // Function returns whether the component was edited
+                if (function(component))
+                    m_SelectedEntity.PatchComponent<Component>();
 
                 ImGui::TreePop();
             }
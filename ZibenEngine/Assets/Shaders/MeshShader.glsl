@@ -0,0 +1,54 @@
+// Mesh shader of the MeshQueue
+
+#type vertex
+#version 460
+
+layout (location = 0) in vec3 a_Position;
+layout (location = 1) in vec3 a_Normal;
+layout (location = 2) in vec2 a_TexCoord;
+
+layout (std140, binding = 0) uniform Frame {
+    mat4 u_ViewProjectionMatrix;
+};
+
+struct Instance {
+    mat4 Transform;
+    vec4 Color;
+    int  EntityHandle;
+};
+
+// Queued objects, the instances of a draw command start at its base instance
+layout (std430, binding = 1) readonly buffer Instances {
+    Instance u_Instances[];
+};
+
+out vec3 v_Normal;
+out vec2 v_TexCoord;
+out vec4 v_Color;
+
+void main() {
+    Instance instance = u_Instances[gl_BaseInstance + gl_InstanceID];
+
+    v_Normal    = transpose(inverse(mat3(instance.Transform))) * a_Normal;
+    v_TexCoord  = a_TexCoord;
+    v_Color     = instance.Color;
+    gl_Position = u_ViewProjectionMatrix * instance.Transform * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 460
+
+in vec3 v_Normal;
+in vec2 v_TexCoord;
+in vec4 v_Color;
+
+layout (location = 0) out vec4 FragColor;
+
+const vec3 c_LightDirection = normalize(vec3(0.4, 1.0, 0.6));
+const vec3 c_Ambient        = vec3(0.2);
+
+void main() {
+    float diffuse = max(dot(normalize(v_Normal), c_LightDirection), 0.0);
+
+    FragColor = vec4((c_Ambient + vec3(diffuse) * 0.8) * v_Color.rgb, v_Color.a);
+}
\ No newline at end of file
@@ -12,7 +12,9 @@ out vec2  v_TexCoord;
 out float v_TexIndex;
 out float v_TilingFactor;
 
-uniform mat4 u_ViewProjectionMatrix;
+layout (std140, binding = 0) uniform Frame {
+    mat4 u_ViewProjectionMatrix;
+};
 
 void main() {
     v_Color        = Color;
@@ -30,10 +32,18 @@ in vec2  v_TexCoord;
 in float v_TexIndex;
 in float v_TilingFactor;
 
-uniform sampler2D u_Textures[32];
+uniform sampler2D      u_Textures[31];
+uniform sampler2DArray u_TextureArray;
+uniform float          u_MipBias;
 
 layout (location = 0) out vec4 FragColor;
 
 void main() {
-    FragColor = texture(u_Textures[int(v_TexIndex)], v_TexCoord * v_TilingFactor) * v_Color;
+    vec2 texCoord = v_TexCoord * v_TilingFactor;
+
+    // Negative indices are the layers of the texture array
+    if (v_TexIndex < 0.0)
+        FragColor = texture(u_TextureArray, vec3(texCoord, -v_TexIndex - 1.0), u_MipBias) * v_Color;
+    else
+        FragColor = texture(u_Textures[int(v_TexIndex)], texCoord, u_MipBias) * v_Color;
 }
\ No newline at end of file
@@ -2,4 +2,16 @@
 
 #include "Ziben/Renderer/GraphicsContext.hpp"
 #include "Ziben/Renderer/Renderer.hpp"
-#include "Ziben/Renderer/Texture.hpp"
\ No newline at end of file
+#include "Ziben/Renderer/MeshQueue.hpp"
+#include "Ziben/Renderer/Mesh.hpp"
+#include "Ziben/Renderer/MeshGenerator.hpp"
+#include "Ziben/Renderer/MeshLoader.hpp"
+#include "Ziben/Renderer/MeshOptimizer.hpp"
+#include "Ziben/Renderer/MeshSimplifier.hpp"
+#include "Ziben/Renderer/Texture.hpp"
+#include "Ziben/Renderer/AssetManager.hpp"
+#include "Ziben/Renderer/TextureLoader.hpp"
+#include "Ziben/Renderer/TextureCompressor.hpp"
+#include "Ziben/Renderer/ShaderReloader.hpp"
+#include "Ziben/Renderer/RenderState.hpp"
+#include "Ziben/Renderer/RenderGraph.hpp"
\ No newline at end of file
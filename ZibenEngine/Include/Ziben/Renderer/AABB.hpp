@@ -0,0 +1,34 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace Ziben {
+
+    struct AABB {
+        glm::vec3 Min = glm::vec3(0.0f);
+        glm::vec3 Max = glm::vec3(0.0f);
+
+        [[nodiscard]] inline glm::vec3 GetCenter() const { return (Min + Max) * 0.5f; }
+        [[nodiscard]] inline glm::vec3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+        [[nodiscard]] float GetSurfaceArea() const;
+        [[nodiscard]] float GetDistanceSquared(const glm::vec3& point) const;
+
+        [[nodiscard]] bool Contains(const AABB& other) const;
+        [[nodiscard]] bool Overlaps(const AABB& other) const;
+
+        // Distance along the ray to the entry point, negative if the ray misses the box
+        [[nodiscard]] float Raycast(const glm::vec3& origin, const glm::vec3& inverseDirection, float maxDistance) const;
+
+        [[nodiscard]] AABB Expand(float margin) const;
+
+        // Bounds of the box after the transform, a bit larger than the box itself when it's rotated
+        [[nodiscard]] AABB Transform(const glm::mat4& transform) const;
+
+        static AABB Merge(const AABB& lhs, const AABB& rhs);
+
+        // Bounds of the [-0.5, 0.5] quad in the xy plane that is used by Renderer2D
+        static AABB FromQuad(const glm::mat4& transform);
+    };
+
+} // namespace Ziben
\ No newline at end of file
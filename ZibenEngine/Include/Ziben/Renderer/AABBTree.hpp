@@ -0,0 +1,85 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "Frustum.hpp"
+
+namespace Ziben {
+
+    // Dynamic bounding volume hierarchy. Leaves store fattened bounds, so objects that move
+    // a little stay in place, and the tree is kept balanced with AVL style rotations.
+    class AABBTree {
+    public:
+        static constexpr int32_t NullNode  = -1;
+        static constexpr float   FatMargin = 0.1f;
+
+    public:
+        AABBTree();
+        ~AABBTree() = default;
+
+    public:
+        [[nodiscard]] inline uint32_t GetUserData(int32_t proxy) const { return m_Nodes[proxy].UserData; }
+        [[nodiscard]] inline const AABB& GetFatBounds(int32_t proxy) const { return m_Nodes[proxy].Bounds; }
+        [[nodiscard]] inline std::size_t GetLeafCount() const { return m_LeafCount; }
+        [[nodiscard]] int32_t GetHeight() const;
+
+        int32_t Insert(const AABB& bounds, uint32_t userData);
+        void Remove(int32_t proxy);
+
+        // Returns true if the leaf was reinserted, bounds that still fit into the fat bounds are ignored
+        bool Move(int32_t proxy, const AABB& bounds);
+
+        void Clear();
+
+        // function(userData) for every leaf that overlaps the region / intersects the frustum
+        template <typename Function>
+        void QueryRegion(const AABB& region, Function&& function) const;
+
+        template <typename Function>
+        void QueryFrustum(const Frustum& frustum, Function&& function) const;
+
+        // function(userData, maxDistance) returns the exact hit distance or a negative value on miss,
+        // subtrees further than the closest hit so far are skipped
+        template <typename Function>
+        void QueryRay(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, Function&& function) const;
+
+        // function(userData) returns the exact squared distance, the closest leaf is returned
+        template <typename Function>
+        int32_t QueryNearest(const glm::vec3& point, float maxDistanceSquared, Function&& function) const;
+
+    private:
+        struct Node {
+            AABB     Bounds;
+            uint32_t UserData = 0;
+            int32_t  Parent   = NullNode; // Next free node while the node is in the free list
+            int32_t  Left     = NullNode;
+            int32_t  Right    = NullNode;
+            int32_t  Height   = -1;       // 0 for leaves, -1 for free nodes
+
+            [[nodiscard]] inline bool IsLeaf() const { return Left == NullNode; }
+        };
+
+    private:
+        int32_t AllocateNode();
+        void FreeNode(int32_t index);
+
+        void InsertLeaf(int32_t leaf);
+        void RemoveLeaf(int32_t leaf);
+
+        // Refits bounds and heights from the index up to the root
+        void Refit(int32_t index);
+        int32_t Balance(int32_t index);
+
+    private:
+        std::vector<Node> m_Nodes;
+        int32_t           m_Root;
+        int32_t           m_FreeList;
+        std::size_t       m_LeafCount;
+
+        // Traversal stack shared by the queries
+        mutable std::vector<int32_t> m_Stack;
+
+    }; // class AABBTree
+
+} // namespace Ziben
+
+#include "AABBTree.inl"
\ No newline at end of file
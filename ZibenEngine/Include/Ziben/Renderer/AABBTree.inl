@@ -0,0 +1,116 @@
+namespace Ziben {
+
+    template <typename Function>
+    void AABBTree::QueryRegion(const AABB& region, Function&& function) const {
+        if (m_Root == NullNode)
+            return;
+
+        m_Stack.clear();
+        m_Stack.push_back(m_Root);
+
+        while (!m_Stack.empty()) {
+            const auto& node = m_Nodes[m_Stack.back()];
+            m_Stack.pop_back();
+
+            if (!node.Bounds.Overlaps(region))
+                continue;
+
+            if (node.IsLeaf()) {
+                function(node.UserData);
+            } else {
+                m_Stack.push_back(node.Left);
+                m_Stack.push_back(node.Right);
+            }
+        }
+    }
+
+    template <typename Function>
+    void AABBTree::QueryFrustum(const Frustum& frustum, Function&& function) const {
+        if (m_Root == NullNode)
+            return;
+
+        m_Stack.clear();
+        m_Stack.push_back(m_Root);
+
+        while (!m_Stack.empty()) {
+            const auto& node = m_Nodes[m_Stack.back()];
+            m_Stack.pop_back();
+
+            if (!frustum.Intersects(node.Bounds.GetCenter(), node.Bounds.GetExtents()))
+                continue;
+
+            if (node.IsLeaf()) {
+                function(node.UserData);
+            } else {
+                m_Stack.push_back(node.Left);
+                m_Stack.push_back(node.Right);
+            }
+        }
+    }
+
+    template <typename Function>
+    void AABBTree::QueryRay(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, Function&& function) const {
+        if (m_Root == NullNode)
+            return;
+
+        glm::vec3 inverseDirection = 1.0f / direction;
+
+        m_Stack.clear();
+        m_Stack.push_back(m_Root);
+
+        while (!m_Stack.empty()) {
+            const auto& node = m_Nodes[m_Stack.back()];
+            m_Stack.pop_back();
+
+            if (node.Bounds.Raycast(origin, inverseDirection, maxDistance) < 0.0f)
+                continue;
+
+            if (node.IsLeaf()) {
+                if (float distance = function(node.UserData, maxDistance); distance >= 0.0f && distance < maxDistance)
+                    maxDistance = distance;
+            } else {
+                m_Stack.push_back(node.Left);
+                m_Stack.push_back(node.Right);
+            }
+        }
+    }
+
+    template <typename Function>
+    int32_t AABBTree::QueryNearest(const glm::vec3& point, float maxDistanceSquared, Function&& function) const {
+        using Entry = std::pair<float, int32_t>;
+
+        if (m_Root == NullNode)
+            return NullNode;
+
+        // Best first search ordered by the distance to the node bounds
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+        int32_t                                                      nearest = NullNode;
+
+        queue.emplace(m_Nodes[m_Root].Bounds.GetDistanceSquared(point), m_Root);
+
+        while (!queue.empty()) {
+            auto [distanceSquared, index] = queue.top();
+            queue.pop();
+
+            if (distanceSquared > maxDistanceSquared)
+                break;
+
+            const auto& node = m_Nodes[index];
+
+            if (node.IsLeaf()) {
+                if (float exact = function(node.UserData); exact >= 0.0f && exact <= maxDistanceSquared) {
+                    maxDistanceSquared = exact;
+                    nearest            = index;
+                }
+
+                continue;
+            }
+
+            queue.emplace(m_Nodes[node.Left].Bounds.GetDistanceSquared(point), node.Left);
+            queue.emplace(m_Nodes[node.Right].Bounds.GetDistanceSquared(point), node.Right);
+        }
+
+        return nearest;
+    }
+
+} // namespace Ziben
\ No newline at end of file
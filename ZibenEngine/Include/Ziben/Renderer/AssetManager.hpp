@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Texture.hpp"
+#include "Shader.hpp"
+#include "Mesh.hpp"
+
+namespace Ziben {
+
+    // Central registry of the loaded textures, shaders and meshes. Assets are deduplicated by their path and
+    // textures also by the hash of the file content, the registry only keeps weak references, so unused assets are freed.
+    // Decoded and processed data is cached on disk under the content hash, an unchanged image is never
+    // decoded twice, an edited one gets a new key
+    class AssetManager {
+    public:
+        using Hash = uint64_t;
+
+        struct Statistics {
+            uint32_t TextureCount      = 0;
+            uint32_t ShaderCount       = 0;
+            uint32_t MeshCount         = 0;
+            uint32_t PathHits          = 0;
+            uint32_t ContentHits       = 0;
+            uint32_t DecodeCacheHits   = 0;
+            uint32_t DecodeCacheMisses = 0;
+        };
+
+    public:
+        // Render thread only. Shaders are deduplicated by the path alone, since the ShaderReloader
+        // recompiles a program in place when its file changes
+        static Ref<Texture2D> LoadTexture(const std::string& filepath);
+        static Ref<Shader> LoadShader(const std::string& filepath);
+
+        // Textures created outside of LoadTexture, like the ones streamed by the TextureLoader, share the registry
+        // through these, so an image is never uploaded twice. Render thread only
+        static Ref<Texture2D> FindTexture(const std::string& filepath);
+        static Ref<Texture2D> FindTexture(Hash hash);
+        static void RegisterTexture(const std::string& filepath, Hash hash, const Ref<Texture2D>& texture);
+
+        // Built-in meshes or OBJ files. The geometry is optimized for the vertex caches and simplified into
+        // the levels of detail once per file content and cached on disk. Meshes are never freed,
+        // their geometry can't be taken out of the MeshQueue anyway
+        static Ref<Mesh> LoadMesh(const std::string& filepath);
+
+        // RGBA8 pixels of the image from the decode cache, the image is decoded and cached on a miss.
+        // Can be called from any thread
+        static bool LoadPixels(const std::string& filepath, std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height);
+        static bool LoadPixels(const std::string& filepath, std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height, Hash& hash);
+
+        // Not cryptographic, but wide enough to key the cache
+        static Hash HashData(const void* data, std::size_t size);
+        static bool HashFile(const std::string& filepath, Hash& hash);
+
+        // Where the results processed from the content with the hash are cached
+        static std::string GetCachePath(Hash hash, std::string_view extension);
+
+        // The entry is written into a temporary file by the function and renamed into place,
+        // so concurrent readers never see a partial entry
+        static bool WriteCache(const std::string& cachePath, const std::function<bool(const std::string&)>& write);
+
+        // Drops the registry entries of the freed assets
+        static void CollectGarbage();
+
+        static Statistics GetStatistics();
+
+    public:
+        static constexpr std::string_view CubeMeshPath   = "Primitives/Cube";
+        static constexpr std::string_view PlaneMeshPath  = "Primitives/Plane";
+        static constexpr std::string_view SphereMeshPath = "Primitives/Sphere";
+        static constexpr std::string_view TorusMeshPath  = "Primitives/Torus";
+
+    private:
+        static constexpr std::string_view s_CacheDirectory    = "Cache/Assets";
+        static constexpr uint32_t         s_PixelCacheMagic   = 0x5a524741; // "AGRZ"
+        static constexpr uint32_t         s_PixelCacheVersion = 1;
+        static constexpr uint32_t         s_MeshCacheMagic    = 0x48534d5a; // "ZMSH"
+        static constexpr uint32_t         s_MeshCacheVersion  = 2;
+
+    private:
+        template <typename T>
+        struct Registry {
+            std::unordered_map<std::string, std::weak_ptr<T>> Paths;
+            std::unordered_map<Hash, std::weak_ptr<T>>        Contents;
+        };
+
+        struct Data {
+            Registry<Texture2D>                                    Textures;
+            std::unordered_map<std::string, std::weak_ptr<Shader>> Shaders;
+            std::unordered_map<std::string, Ref<Mesh>>             Meshes;
+
+            std::atomic<uint32_t>                                  PathHits          = 0;
+            std::atomic<uint32_t>                                  ContentHits       = 0;
+            std::atomic<uint32_t>                                  DecodeCacheHits   = 0;
+            std::atomic<uint32_t>                                  DecodeCacheMisses = 0;
+        };
+
+    private:
+        static Data& GetData();
+
+        static bool ReadFile(const std::string& filepath, std::vector<uint8_t>& data);
+        static bool LoadPixels(Hash hash, const std::vector<uint8_t>& fileData, std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height);
+        static bool LoadMeshData(Hash hash, const std::vector<uint8_t>& fileData, const std::string& filepath, MeshData& meshData);
+
+        template <typename Key, typename T>
+        static Ref<T> Find(const std::unordered_map<Key, std::weak_ptr<T>>& assets, const Key& key);
+
+    }; // class AssetManager
+
+} // namespace Ziben
\ No newline at end of file
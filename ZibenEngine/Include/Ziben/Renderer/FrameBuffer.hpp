@@ -48,9 +48,14 @@ namespace Ziben {
     public:
         static Ref<FrameBuffer> Create(FrameBufferSpecification&& specification);
 
+        // Binds with the viewport over the specified size, the part of the attachments that is rendered
         static void Bind(const Ref<FrameBuffer>& frameBuffer);
         static void Unbind();
 
+        // Attachments are allocated in steps of a quarter of the power of two below the size, so they are
+        // at most 25% larger and a resize within the step doesn't reallocate them
+        [[nodiscard]] static uint32_t GetBucketSize(uint32_t size);
+
     public:
         explicit FrameBuffer(FrameBufferSpecification&& specification);
         ~FrameBuffer();
@@ -60,6 +65,10 @@ namespace Ziben {
 
         [[nodiscard]] HandleType GetColorAttachmentHandle(std::size_t index = 0) const;
 
+        // Size of the attachments, the specified size is the rendered corner of them
+        [[nodiscard]] inline uint32_t GetAllocatedWidth() const { return m_AllocatedWidth; }
+        [[nodiscard]] inline uint32_t GetAllocatedHeight() const { return m_AllocatedHeight; }
+
         void Invalidate();
         void Resize(uint32_t width, uint32_t height);
         void ClearColorAttachment(std::size_t index, int value);
@@ -71,10 +80,13 @@ namespace Ziben {
 
     private:
         static inline constexpr uint32_t s_MaxFrameBufferSize = 8192;
+        static inline constexpr uint32_t s_MinBucketStep      = 16;
 
     private:
         HandleType                                   m_Handle;
         FrameBufferSpecification                     m_Specification;
+        uint32_t                                     m_AllocatedWidth;
+        uint32_t                                     m_AllocatedHeight;
 
         std::vector<FrameBufferTextureSpecification> m_ColorAttachmentSpecification;
         FrameBufferTextureSpecification              m_DepthAttachmentSpecification;
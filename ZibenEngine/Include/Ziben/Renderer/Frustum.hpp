@@ -0,0 +1,41 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace Ziben {
+
+    // World-space bounds of up to Capacity boxes in structure of arrays layout,
+    // so the plane tests below compile into plain vector loops
+    struct AABBBatch {
+        static constexpr std::size_t Capacity = 64;
+
+        std::array<float, Capacity> CenterX;
+        std::array<float, Capacity> CenterY;
+        std::array<float, Capacity> CenterZ;
+        std::array<float, Capacity> ExtentX;
+        std::array<float, Capacity> ExtentY;
+        std::array<float, Capacity> ExtentZ;
+    };
+
+    class Frustum {
+    public:
+        Frustum();
+        explicit Frustum(const glm::mat4& viewProjection);
+
+        // Part of the view frustum that projects into the [ndcMin, ndcMax] rectangle, used for box selection
+        Frustum(const glm::mat4& viewProjection, const glm::vec2& ndcMin, const glm::vec2& ndcMax);
+        ~Frustum() = default;
+
+    public:
+        [[nodiscard]] bool Intersects(const glm::vec3& center, const glm::vec3& extents) const;
+
+        // Writes 1 to isVisible for every box of the batch that intersects the frustum, returns the visible count
+        uint32_t Cull(const AABBBatch& batch, std::size_t count, uint8_t* isVisible) const;
+
+    private:
+        // Left, right, bottom, top, near, far. Normals point inside
+        std::array<glm::vec4, 6> m_Planes;
+
+    }; // class Frustum
+
+} // namespace Ziben
\ No newline at end of file
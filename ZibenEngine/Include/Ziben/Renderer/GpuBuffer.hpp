@@ -0,0 +1,45 @@
+#pragma once
+
+#include "GraphicsCore.hpp"
+#include "Ziben/Utility/Reference.hpp"
+
+namespace Ziben {
+
+    // Buffer object created and updated through DSA, it's never bound to be edited. The vertex, index,
+    // uniform and storage buffers are built on it. The persistent mapping is coherent, writes are seen by
+    // the GPU without flushes, the caller has to fence the ranges the GPU may still read
+    class GpuBuffer {
+    public:
+        static Ref<GpuBuffer> Create(std::size_t size, BufferStorage storage = BufferStorage::Immutable);
+        static Ref<GpuBuffer> Create(const void* data, std::size_t size, BufferStorage storage = BufferStorage::Immutable);
+
+        static void Bind(const Ref<GpuBuffer>& buffer, GLenum target);
+        static void Unbind(GLenum target);
+
+    public:
+        GpuBuffer(const void* data, std::size_t size, BufferStorage storage, BufferUsage usage = BufferUsage::Static);
+        ~GpuBuffer();
+
+        GpuBuffer(const GpuBuffer&) = delete;
+        GpuBuffer& operator =(const GpuBuffer&) = delete;
+
+        [[nodiscard]] inline HandleType GetHandle() const { return m_Handle; }
+        [[nodiscard]] inline std::size_t GetSize() const { return m_Size; }
+        [[nodiscard]] inline BufferStorage GetStorage() const { return m_Storage; }
+        [[nodiscard]] inline BufferUsage GetUsage() const { return m_Usage; }
+
+        // Only persistent buffers are mapped
+        [[nodiscard]] inline uint8_t* GetMappedData() const { return m_MappedData; }
+
+        void SetData(const void* data, std::size_t size, std::size_t offset = 0) const;
+
+    private:
+        HandleType    m_Handle;
+        std::size_t   m_Size;
+        BufferStorage m_Storage;
+        BufferUsage   m_Usage;
+        uint8_t*      m_MappedData;
+
+    }; // class GpuBuffer
+
+} // namespace Ziben
\ No newline at end of file
@@ -13,4 +13,11 @@ namespace Ziben {
         Stream  = GL_STREAM_DRAW
     };
 
+    // How the memory of a GpuBuffer is allocated, the usage is only a hint for the mutable storage
+    enum class BufferStorage : uint8_t {
+        Mutable = 0, // Can be respecified, the driver decides where it lives by the usage
+        Immutable,   // Fixed size, updated with SetData
+        Persistent   // Immutable and mapped for writing while the buffer lives
+    };
+
 } // namespace Ziben
\ No newline at end of file
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "GraphicsCore.hpp"
+#include "GpuBuffer.hpp"
 #include "Ziben/Utility/Reference.hpp"
 
 namespace Ziben {
@@ -18,15 +18,17 @@ namespace Ziben {
 
     public:
         IndexBuffer(const IndexType* indices, std::size_t count, BufferUsage usage);
-        ~IndexBuffer();
 
+        [[nodiscard]] inline HandleType GetHandle() const { return m_Buffer.GetHandle(); }
         [[nodiscard]] inline std::size_t GetCount() const { return m_Count; }
-        [[nodiscard]] inline BufferUsage GetUsage() const { return m_Usage; }
+        [[nodiscard]] inline BufferUsage GetUsage() const { return m_Buffer.GetUsage(); }
+
+        // Count and offset are in indices
+        void SetData(const IndexType* indices, std::size_t count, std::size_t offset = 0) const;
 
     private:
-        HandleType  m_Handle;
+        GpuBuffer   m_Buffer;
         std::size_t m_Count;
-        BufferUsage m_Usage;
 
     }; // class IndexBuffer
 
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "MeshQueue.hpp"
+#include "AABB.hpp"
+
+namespace Ziben {
+
+    // Coarser index list over the vertices of the full detail mesh, produced by MeshSimplifier
+    struct MeshLodData {
+        std::vector<IndexType> Indices;
+
+        // Largest distance the simplification moved the surface, relative to the radius of the mesh bounds
+        float                  Error = 0.0f;
+    };
+
+    // Geometry on the CPU side, produced by MeshGenerator and MeshLoader
+    struct MeshData {
+        std::vector<MeshQueue::Vertex> Vertices;
+        std::vector<IndexType>         Indices;
+        std::vector<MeshLodData>       Lods;
+    };
+
+    // Geometry registered in the MeshQueue together with its local bounds. Entities share meshes
+    // through AssetManager::LoadMesh, the geometry stays in the queue buffers until its shutdown.
+    // The levels of detail share the vertices of the mesh, every level is a separate queue mesh
+    class Mesh {
+    public:
+        using Vertex = MeshQueue::Vertex;
+
+        struct Lod {
+            MeshQueue::MeshId Id         = 0;
+            uint32_t          IndexCount = 0;
+
+            // The level is detailed enough while the mesh covers less of the viewport height
+            float             ScreenSize = std::numeric_limits<float>::max();
+        };
+
+        static Ref<Mesh> Create(const MeshData& data);
+
+        // Fraction of the viewport height covered by the sphere, the view matrix must not scale
+        [[nodiscard]] static float GetScreenSize(const glm::mat4& viewProjectionMatrix, const glm::vec3& center, float radius);
+
+    public:
+        // The simplification error may cover about a pixel of a 1080p viewport
+        static constexpr float MaxScreenError = 1.0f / 1080.0f;
+
+        // Fraction the screen size has to move past a threshold before the level changes, stops the popping
+        // of the objects that sit right at the threshold
+        static constexpr float LodHysteresis  = 0.15f;
+
+    public:
+        Mesh(std::vector<Lod> lods, uint32_t vertexCount, const AABB& bounds);
+        ~Mesh() = default;
+
+    public:
+        [[nodiscard]] inline MeshQueue::MeshId GetId() const { return m_Lods.front().Id; }
+        [[nodiscard]] inline uint32_t GetVertexCount() const { return m_VertexCount; }
+        [[nodiscard]] inline uint32_t GetIndexCount() const { return m_Lods.front().IndexCount; }
+        [[nodiscard]] inline const AABB& GetBounds() const { return m_Bounds; }
+
+        [[nodiscard]] inline uint32_t GetLodCount() const { return static_cast<uint32_t>(m_Lods.size()); }
+        [[nodiscard]] inline const Lod& GetLod(uint32_t index) const { return m_Lods[index]; }
+
+        // Coarsest level for the screen size, the current level is kept inside the hysteresis band
+        [[nodiscard]] uint32_t SelectLod(float screenSize, uint32_t currentLod) const;
+
+    private:
+        std::vector<Lod> m_Lods;
+        uint32_t         m_VertexCount;
+        AABB             m_Bounds;
+
+    }; // class Mesh
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Mesh.hpp"
+
+namespace Ziben {
+
+    // Procedural primitives with counter clockwise triangles seen from outside. The indices are
+    // emitted row by row, so the result is worth passing through MeshOptimizer before the upload
+    class MeshGenerator {
+    public:
+        // Centered at the origin, the faces don't share vertices, so the normals stay flat
+        static MeshData CreateCube(float size = 1.0f);
+
+        // In the xz plane facing +y
+        static MeshData CreatePlane(float size = 1.0f, uint32_t subdivisionCount = 1);
+
+        // Stacks go from the north pole along +y to the south one
+        static MeshData CreateSphere(float radius = 0.5f, uint32_t sectorCount = 32, uint32_t stackCount = 16);
+
+        // Ring in the xy plane around the z axis
+        static MeshData CreateTorus(float outerRadius, float innerRadius, uint32_t sideCount, uint32_t ringCount);
+
+    }; // class MeshGenerator
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Mesh.hpp"
+
+namespace Ziben {
+
+    // Wavefront OBJ reader for the positions, texture coordinates and normals of all the groups in the file.
+    // Polygons are triangulated as fans, faces without normals get the normals of the triangles averaged
+    class MeshLoader {
+    public:
+        static bool LoadObj(const std::string& filepath, MeshData& data);
+
+        // The file content without the file, the name is used in the messages only
+        static bool ParseObj(std::string_view source, std::string_view name, MeshData& data);
+
+    }; // class MeshLoader
+
+} // namespace Ziben
\ No newline at end of file
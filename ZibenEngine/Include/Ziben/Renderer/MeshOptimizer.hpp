@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Mesh.hpp"
+
+namespace Ziben {
+
+    // Reordering of the mesh data for the GPU caches. The triangles are reordered for the post-transform
+    // vertex cache first, then the vertices are laid out in the order the new indices fetch them
+    class MeshOptimizer {
+    public:
+        // Entries of the simulated FIFO cache, a conservative guess for the current hardware
+        static constexpr uint32_t DefaultCacheSize = 16;
+
+        struct Statistics {
+            float AcmrBefore = 0.0f;
+            float AcmrAfter  = 0.0f;
+        };
+
+    public:
+        // Both passes below, the ACMR is measured before and after
+        static Statistics Optimize(MeshData& data, uint32_t cacheSize = DefaultCacheSize);
+
+        // Tipsify by Sander, Nehab and Barczak: triangles are emitted in fans around the vertices that are
+        // still in the cache, linear in the triangle count
+        static void OptimizeVertexCache(std::vector<IndexType>& indices, uint32_t vertexCount, uint32_t cacheSize = DefaultCacheSize);
+
+        // Vertices in the order of their first use, unused vertices are dropped
+        static void OptimizeVertexFetch(MeshData& data);
+
+        // Average cache miss ratio, vertices transformed per triangle with a FIFO cache of the size.
+        // 0.5 is the limit for large regular grids, 3 means no reuse at all
+        [[nodiscard]] static float GetAcmr(const std::vector<IndexType>& indices, uint32_t vertexCount, uint32_t cacheSize = DefaultCacheSize);
+
+        // 16 bit indices halve the index data where the mesh is stored on its own
+        [[nodiscard]] static inline bool CanUseShortIndices(std::size_t vertexCount) { return vertexCount <= std::numeric_limits<uint16_t>::max() + 1; }
+
+    }; // class MeshOptimizer
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include "VertexArray.hpp"
+#include "Shader.hpp"
+#include "StorageBuffer.hpp"
+
+namespace Ziben {
+
+    // Queue of mesh instances drawn with indirect multi-draws. The geometry of every added mesh is packed
+    // into one shared vertex and index buffer, the transforms and colors of the submitted objects go into
+    // a storage buffer indexed by gl_BaseInstance + gl_InstanceID. On EndScene the objects are sorted by shader and
+    // mesh, every shader is drawn with one glMultiDrawElementsIndirect holding a command per distinct mesh
+    class MeshQueue {
+    public:
+        using MeshId = uint32_t;
+
+        struct Vertex {
+            glm::vec3 Position = glm::vec3(0.0f);
+            glm::vec3 Normal   = glm::vec3(0.0f);
+            glm::vec2 TexCoord = glm::vec2(0.0f);
+        };
+
+        struct Statistics {
+            uint32_t DrawCalls     = 0;
+            uint32_t CommandCount  = 0;
+            uint32_t ObjectCount   = 0;
+            uint32_t TriangleCount = 0;
+
+            // Filled by the scene, culled objects are never submitted
+            uint32_t CulledCount   = 0;
+
+            // Aren't reset, the geometry stays until Shutdown
+            uint32_t MeshCount     = 0;
+            uint32_t VertexCount   = 0;
+            uint32_t IndexCount    = 0;
+        };
+
+    public:
+        static void Init();
+        static void Shutdown();
+
+        // Indices are relative to the vertices of the mesh. The shared buffers grow when the mesh doesn't fit
+        static MeshId AddMesh(const std::vector<Vertex>& vertices, const std::vector<IndexType>& indices);
+
+        // Another index list over the vertices of the mesh, the levels of detail share the vertices this way
+        static MeshId AddMesh(MeshId mesh, const std::vector<IndexType>& indices);
+
+        static void BeginScene(const glm::mat4& viewProjectionMatrix);
+        static void EndScene();
+
+        // The shader reads the instances from the s_InstanceBufferBinding storage buffer, the entity handle
+        // is written into the second color attachment by the editor shaders
+        static void Submit(
+            const Ref<Shader>& shader,
+            MeshId             mesh,
+            const glm::mat4&   transform,
+            const glm::vec4&   color        = glm::vec4(1.0f),
+            int                entityHandle = -1
+        );
+
+        static void Flush();
+
+        // Lit with a fixed directional light, enough to look at the geometry
+        static const Ref<Shader>& GetDefaultShader();
+
+        static Statistics& GetStatistics();
+        static void ResetStatistics();
+
+    public:
+        static constexpr uint32_t s_InstanceBufferBinding = 1;
+
+    private:
+        static constexpr uint32_t s_MaxObjectCount      = 16'384;
+        static constexpr uint32_t s_InitialVertexCount  = 65'536;
+        static constexpr uint32_t s_InitialIndexCount   = 262'144;
+
+    private:
+        struct MeshRange {
+            uint32_t IndexCount = 0;
+            uint32_t FirstIndex = 0;
+            int32_t  BaseVertex = 0;
+        };
+
+        // Shader index in the high half, mesh in the low one, sorting groups both
+        struct Object {
+            uint64_t Key;
+            uint32_t InstanceIndex;
+        };
+
+        // Layout of the std430 instance array of the shaders
+        struct Instance {
+            glm::mat4 Transform;
+            glm::vec4 Color;
+            int32_t   EntityHandle;
+            int32_t   Padding[3];
+        };
+
+        // Layout of the GL indirect command
+        struct DrawCommand {
+            uint32_t IndexCount;
+            uint32_t InstanceCount;
+            uint32_t FirstIndex;
+            int32_t  BaseVertex;
+            uint32_t BaseInstance;
+        };
+
+        struct Data {
+            Ref<VertexArray>                            MeshVertexArray;
+            Ref<VertexBuffer>                           MeshVertexBuffer;
+            Ref<IndexBuffer>                            MeshIndexBuffer;
+            Ref<StorageBuffer>                          InstanceBuffer;
+            Ref<GpuBuffer>                              CommandBuffer;
+            Ref<Shader>                                 DefaultShader;
+
+            std::vector<MeshRange>                      Meshes;
+            uint32_t                                    VertexCount = 0;
+            uint32_t                                    IndexCount  = 0;
+
+            std::vector<Ref<Shader>>                    Shaders;
+            std::unordered_map<const Shader*, uint32_t> ShaderIndices;
+            std::vector<Object>                         Objects;
+            std::vector<Instance>                       Instances;
+            std::vector<Instance>                       SortedInstances;
+            std::vector<DrawCommand>                    Commands;
+        };
+
+    private:
+        static Data& GetData();
+
+        // Moves the geometry into larger buffers when the counts don't fit
+        static void Reserve(uint32_t vertexCount, uint32_t indexCount);
+
+    }; // class MeshQueue
+
+} // namespace Ziben
\ No newline at end of file
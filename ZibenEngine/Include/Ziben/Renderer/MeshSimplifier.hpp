@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Mesh.hpp"
+
+namespace Ziben {
+
+    // Edge collapse simplification driven by the quadric error metrics of Garland and Heckbert. A vertex is
+    // collapsed into one of its neighbours, so the result indexes the original vertices and the levels of detail
+    // share the vertex buffer. Vertices on UV or normal seams are kept, boundary vertices only slide along the boundary
+    class MeshSimplifier {
+    public:
+        // Levels after the full detail one
+        static constexpr uint32_t DefaultLodCount = 4;
+
+        // Triangle count of a level relative to the previous one
+        static constexpr float    DefaultLodRatio = 0.25f;
+
+    public:
+        // Collapses edges until the index count drops to the target or the cheapest collapse exceeds the error.
+        // The errors are relative to the radius of the mesh bounds, returns the largest error of the done collapses
+        static float Simplify(
+            const std::vector<MeshQueue::Vertex>& vertices,
+            std::vector<IndexType>&               indices,
+            uint32_t                              targetIndexCount,
+            float                                 targetError = 1.0f
+        );
+
+        // Fills data.Lods, every level is simplified from the previous one and optimized for the vertex cache.
+        // Stops early once the seams and the boundaries don't let a level get much smaller than the previous one
+        static void GenerateLods(MeshData& data, uint32_t lodCount = DefaultLodCount, float ratio = DefaultLodRatio);
+
+    private:
+        static constexpr float s_MaxLodIndexRatio = 0.8f;
+        static constexpr float s_BorderWeight     = 10.0f;
+
+    }; // class MeshSimplifier
+
+} // namespace Ziben
\ No newline at end of file
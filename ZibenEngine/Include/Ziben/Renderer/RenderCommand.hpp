@@ -16,6 +16,9 @@ namespace Ziben {
 
         static void DrawIndexed(const Ref<VertexArray>& vertexArray, std::size_t indexCount = 0);
 
+        // Commands are read from the bound GL_DRAW_INDIRECT_BUFFER, the offset is in commands
+        static void DrawIndexedIndirect(std::size_t commandCount, std::size_t commandOffset = 0);
+
     }; // class RenderCommand
 
 } // namespace RenderCommand
\ No newline at end of file
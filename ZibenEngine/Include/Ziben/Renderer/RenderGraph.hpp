@@ -0,0 +1,194 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include "FrameBuffer.hpp"
+
+namespace Ziben {
+
+    // Frame of render passes that declare the textures they write and read. The graph is rebuilt every frame:
+    // a pass that writes nothing a later pass reads or an exported texture needs is culled, an attachment
+    // nobody reads is left out of the pass and never cleared. Transient textures come from a pool owned by
+    // the graph, a texture whose last reader has run is handed to the next pass asking for the same format and size,
+    // so its content is undefined until the pass that writes it first clears it. The pooled textures are allocated
+    // in the size buckets of the FrameBuffer and the passes render into their corner, a resize within the bucket
+    // reuses them and the allocations of the other buckets stay pooled for a while
+    class RenderGraph {
+    public:
+        using TextureId = uint32_t;
+
+        static constexpr TextureId s_NullTexture = std::numeric_limits<TextureId>::max();
+
+        struct TextureDescription {
+            uint32_t                 Width  = 0;
+            uint32_t                 Height = 0;
+            FrameBufferTextureFormat Format = FrameBufferTextureFormat::None;
+
+            bool operator ==(const TextureDescription& other) const = default;
+        };
+
+        struct Statistics {
+            uint32_t PassCount         = 0;
+            uint32_t CulledPassCount   = 0;
+            uint32_t CulledAttachments = 0;
+            uint32_t Clears            = 0;
+
+            // Textures that were created this frame and the ones that another pass has released this frame
+            uint32_t AllocatedTextures = 0;
+            uint32_t AliasedTextures   = 0;
+
+            // Owned by the pool
+            uint32_t TextureCount      = 0;
+            uint32_t FrameBufferCount  = 0;
+        };
+
+    private:
+        enum class LoadOperation : uint8_t {
+            Load = 0,
+            Clear
+        };
+
+        // Integer and depth attachments are cleared to ClearValue.x
+        struct Attachment {
+            TextureId     Texture    = s_NullTexture;
+            LoadOperation Load       = LoadOperation::Load;
+            glm::vec4     ClearValue = glm::vec4(0.0f);
+        };
+
+        struct Pass {
+            std::string             Name;
+            std::function<void()>   Execute;
+
+            std::vector<Attachment> ColorAttachments;
+            Attachment              DepthAttachment;
+            std::vector<TextureId>  Reads;
+            bool                    HasSideEffect = false;
+
+            // Filled by Compile
+            bool                    IsCulled      = false;
+            std::vector<bool>       IsColorAttachmentUsed;
+        };
+
+    public:
+        class PassBuilder {
+        public:
+            // Color attachments are bound in the order they are written
+            void Write(TextureId texture);
+            void Write(TextureId texture, const glm::vec4& clearColor);
+            void Write(TextureId texture, int clearValue);
+
+            // Always attached while the pass runs, it doesn't keep the pass alive on its own
+            void WriteDepth(TextureId texture);
+            void WriteDepth(TextureId texture, float clearDepth);
+
+            void Read(TextureId texture);
+
+            // Readbacks and the like, the pass is never culled
+            void SetSideEffect();
+
+        private:
+            friend class RenderGraph;
+
+            explicit PassBuilder(Pass& pass);
+
+        private:
+            Pass& m_Pass;
+
+        }; // class PassBuilder
+
+        using SetupFunction   = std::function<void(PassBuilder&)>;
+        using ExecuteFunction = std::function<void()>;
+
+    public:
+        RenderGraph() = default;
+        ~RenderGraph();
+
+        RenderGraph(const RenderGraph&) = delete;
+        RenderGraph& operator =(const RenderGraph&) = delete;
+
+    public:
+        // Valid until the next frame begins
+        TextureId CreateTexture(const TextureDescription& description);
+
+        // The framebuffer of the attachments is bound with the viewport over them when the function runs
+        void AddPass(std::string name, const SetupFunction& setup, ExecuteFunction execute);
+
+        // The texture outlives Execute and stays untouched until the next frame begins
+        void Export(TextureId texture);
+
+        // Culls and runs the passes in the order they were added, the next CreateTexture or AddPass
+        // begins the next frame
+        void Execute();
+
+        // While the pass that reads the texture runs or after Execute for the exported ones
+        [[nodiscard]] HandleType GetTextureHandle(TextureId texture) const;
+
+        // Rendered part of the pooled texture in texture coordinates, the corner starts at zero
+        [[nodiscard]] glm::vec2 GetTextureScale(TextureId texture) const;
+
+        // The texture must be a single integer channel one
+        [[nodiscard]] int ReadPixel(TextureId texture, int x, int y) const;
+
+        // Deletes the pooled textures and framebuffers
+        void ReleaseResources();
+
+        [[nodiscard]] inline const Statistics& GetStatistics() const { return m_Statistics; }
+
+    private:
+        // Pooled objects that aren't used for that many frames are deleted, long enough
+        // to get the textures back when a dragged splitter returns to the previous bucket
+        static constexpr uint32_t s_MaxUnusedFrames     = 30;
+        static constexpr uint32_t s_MaxColorAttachments = 4;
+
+    private:
+        struct Texture {
+            TextureDescription Description;
+            bool               IsExported;
+
+            // Filled by Compile and Execute
+            uint32_t           FirstPass;
+            uint32_t           LastPass;
+            int32_t            PooledTexture;
+        };
+
+        // The description holds the bucket size
+        struct PooledTexture {
+            HandleType         Handle;
+            TextureDescription Description;
+            uint64_t           LastUsedFrame;
+            bool               IsInUse;
+        };
+
+        // Color attachments by slot then the depth one, zero for the left out ones
+        using FrameBufferKey = std::array<HandleType, s_MaxColorAttachments + 1>;
+
+        struct PooledFrameBuffer {
+            HandleType         Handle;
+            uint64_t           LastUsedFrame;
+        };
+
+    private:
+        void BeginFrame();
+        void Compile();
+        void ExecutePass(Pass& pass);
+
+        int32_t AcquireTexture(const TextureDescription& description);
+        HandleType AcquireFrameBuffer(const FrameBufferKey& key, std::size_t colorAttachmentCount);
+
+        void CollectGarbage();
+        void DeleteTexture(const PooledTexture& texture);
+
+    private:
+        std::vector<Pass>                           m_Passes;
+        std::vector<Texture>                        m_Textures;
+
+        std::vector<PooledTexture>                  m_TexturePool;
+        std::map<FrameBufferKey, PooledFrameBuffer> m_FrameBufferPool;
+
+        uint64_t                                    m_FrameIndex = 0;
+        bool                                        m_IsExecuted = false;
+        Statistics                                  m_Statistics;
+
+    }; // class RenderGraph
+
+} // namespace Ziben
\ No newline at end of file
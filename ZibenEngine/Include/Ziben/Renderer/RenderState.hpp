@@ -0,0 +1,99 @@
+#pragma once
+
+#include "GraphicsCore.hpp"
+
+namespace Ziben {
+
+    // Shadow copy of the GL binding state. All binds of the renderer go through it and the calls that
+    // wouldn't change anything are skipped. GL reuses the names of deleted objects, so deletions must be
+    // reported. Code that changes the state behind its back must call Invalidate
+    class RenderState {
+    public:
+        struct Statistics {
+            uint32_t Calls        = 0;
+            uint32_t SkippedCalls = 0;
+        };
+
+    public:
+        // Every cached value is unknown until it's set again
+        static void Invalidate();
+
+        static void UseProgram(HandleType program);
+        static void BindVertexArray(HandleType vertexArray);
+        static void BindBuffer(GLenum target, HandleType buffer);
+        static void BindBufferBase(GLenum target, uint32_t index, HandleType buffer);
+        static void BindTextureUnit(uint32_t unit, HandleType texture);
+        static void BindFrameBuffer(HandleType frameBuffer);
+
+        static void SetBlend(bool isEnabled);
+        static void SetBlendFunc(GLenum source, GLenum destination);
+        static void SetDepthTest(bool isEnabled);
+        static void SetViewport(int x, int y, int width, int height);
+
+        static void OnProgramDeleted(HandleType program);
+        static void OnVertexArrayDeleted(HandleType vertexArray);
+        static void OnBufferDeleted(HandleType buffer);
+        static void OnTextureDeleted(HandleType texture);
+        static void OnFrameBufferDeleted(HandleType frameBuffer);
+
+        // Counted since the last reset, the Application resets them every frame
+        static Statistics& GetStatistics();
+        static void ResetStatistics();
+
+    private:
+        static constexpr HandleType s_Unknown            = std::numeric_limits<HandleType>::max();
+        static constexpr uint32_t   s_MaxTextureUnits    = 32;
+        static constexpr uint32_t   s_MaxIndexedBindings = 16;
+
+        // Targets with a cached binding, the others are passed through. The element array binding
+        // belongs to the vertex array and is changed through DSA, so it isn't cached
+        static constexpr std::array<GLenum, 5> s_BufferTargets = {
+            GL_ARRAY_BUFFER,
+            GL_PIXEL_UNPACK_BUFFER,
+            GL_DRAW_INDIRECT_BUFFER,
+            GL_UNIFORM_BUFFER,
+            GL_SHADER_STORAGE_BUFFER
+        };
+
+        // Tri-state flags, the GL value isn't known after Invalidate
+        enum class Flag : uint8_t {
+            Unknown = 0,
+            Disabled,
+            Enabled
+        };
+
+    private:
+        using IndexedBindings = std::array<HandleType, s_MaxIndexedBindings>;
+
+        struct Data {
+            HandleType                                     Program;
+            HandleType                                     VertexArray;
+            HandleType                                     FrameBuffer;
+            std::array<HandleType, s_BufferTargets.size()> Buffers;
+            IndexedBindings                                UniformBuffers;
+            IndexedBindings                                StorageBuffers;
+            std::array<HandleType, s_MaxTextureUnits>      TextureUnits;
+
+            Flag                                           Blend;
+            std::array<GLenum, 2>                          BlendFunc;
+            Flag                                           DepthTest;
+            std::array<int, 4>                             Viewport;
+
+            Data() { Reset(); }
+            void Reset();
+        };
+
+    private:
+        static Data& GetData();
+
+        static IndexedBindings* GetIndexedBindings(GLenum target);
+        static HandleType* GetBuffer(GLenum target);
+
+        // Counts the call, returns true when it can be skipped
+        static bool IsRedundant(bool isSame);
+
+        static void SetFlag(Flag& flag, GLenum capability, bool isEnabled);
+
+    }; // class RenderState
+
+} // namespace Ziben
\ No newline at end of file
@@ -4,16 +4,28 @@
 #include "OrthographicCamera.hpp"
 #include "VertexArray.hpp"
 #include "Shader.hpp"
+#include "UniformBuffer.hpp"
 
 namespace Ziben {
 
     class Renderer {
+    public:
+        // Layout of the std140 Frame uniform block declared by the shaders
+        struct FrameUniforms {
+            glm::mat4 ViewProjectionMatrix = glm::mat4(1.0f);
+        };
+
+        static constexpr uint32_t s_FrameUniformBinding = 0;
+
     public:
         static void Init();
         static void Shutdown();
 
         static void OnWindowResized(int width, int height);
 
+        // One upload per scene, the buffer stays bound for all the shaders
+        static void SetFrameUniforms(const FrameUniforms& frameUniforms);
+
         static void BeginScene(const Camera& camera);
         static void BeginScene(const OrthographicCamera& camera);
         static void EndScene();
@@ -26,7 +38,8 @@ namespace Ziben {
 
     private:
         struct RendererStorage {
-            glm::mat4 ViewProjectionMatrix = glm::mat4(1.0f);
+            Ref<UniformBuffer> FrameUniformBuffer;
+            Uniform<glm::mat4> TransformUniform { "u_Transform" };
         };
 
     private:
@@ -5,7 +5,9 @@
 #include "VertexArray.hpp"
 #include "Shader.hpp"
 #include "Texture.hpp"
+#include "StorageBuffer.hpp"
 #include "SubTexture2D.hpp"
+#include "Frustum.hpp"
 
 namespace Ziben {
 
@@ -25,6 +27,15 @@ namespace Ziben {
             int       EntityHandle = -1;
         };
 
+        // How a batch references its textures, picked once in Init
+        enum class TextureMode : uint8_t {
+            // Sampler slots, a batch is split once all of them are taken
+            Slots = 0,
+
+            // ARB_bindless_texture handles in a storage buffer, thousands of textures per batch
+            Bindless
+        };
+
     public:
         static void Init();
         static void Shutdown();
@@ -70,6 +81,10 @@ namespace Ziben {
         static void DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tilingFactor);
             static void DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture,  const glm::vec4& tintColor, float tilingFactor, int entityHandle = -1);
 
+        // Layer of a texture array. The array has a slot of its own in both texture modes, so any number
+        // of equally sized sprites share a batch. Drawing from another array starts a new batch
+        static void DrawQuad(const glm::mat4& transform, const Ref<Texture2DArray>& textureArray, uint32_t layer, const glm::vec4& tintColor = glm::vec4(1.0f), int entityHandle = -1);
+
         static void DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float angle, const glm::vec4& color);
         static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float angle, const glm::vec4& color);
 
@@ -87,13 +102,57 @@ namespace Ziben {
 
         static void DrawSprite(const glm::mat4& transform, const SpriteRendererComponent& spriteRendererComponent, int entityHandle);
 
+        // Tests unit quads against the frustum of the current scene camera.
+        // isVisible receives 1 for every visible quad, returns the visible count
+        static uint32_t CullQuads(const glm::mat4* transforms, std::size_t count, uint8_t* isVisible);
+
+        static const Frustum& GetCameraFrustum();
+        static const glm::mat4& GetCameraViewProjectionMatrix();
+
+        // Added to the mip level the sprites are sampled at, positive values pick the smaller mips,
+        // so distant sprites fetch less texture data at the cost of some blur
+        static void SetMipBias(float mipBias);
+        static float GetMipBias();
+
+        // Retained quads. Vertices are built once into a persistent vertex buffer that shares
+        // the quad index buffer, so unchanged geometry is drawn without touching the CPU side.
+        // The vertex buffer may hold up to 20'000 quads
+        static void BuildQuadVertices(const glm::mat4& transform, const glm::vec4& color, int entityHandle, QuadVertex* vertices);
+        static Ref<VertexArray> CreateQuadVertexArray(const Ref<VertexBuffer>& vertexBuffer);
+        static void DrawQuadVertexArray(const Ref<VertexArray>& vertexArray, uint32_t quadCount);
+
+        // Whole tilemap in a single quad, tile indices are fetched per fragment from the R16UI tiles texture,
+        // so the cost depends on the covered pixels rather than the map size.
+        // transform maps the [-0.5, 0.5] quad onto the map, tilesetGrid is the cell count of the tileset
+        static void DrawTilemap(
+            const glm::mat4&      transform,
+            const Ref<Texture2D>& tiles,
+            const Ref<Texture2D>& tileset,
+            const glm::vec2&      tilesetGrid,
+            const glm::vec4&      color,
+            int                   entityHandle = -1
+        );
+
     public:
         struct Statistics {
-            uint32_t DrawCalls = 0;
-            uint32_t QuadCount = 0;
+            uint32_t DrawCalls           = 0;
+            uint32_t QuadCount           = 0;
+            uint32_t SubmittedQuadCount  = 0;
+            uint32_t CulledQuadCount     = 0;
+            uint32_t StaticQuadCount     = 0;
+            uint32_t StaticChunkUploads  = 0;
+            uint32_t TilemapCount        = 0;
+            uint32_t TilemapChunkUploads = 0;
+
+            // Batches that were flushed because all texture slots were taken, atlases bring it down
+            uint32_t TextureSlotFlushes  = 0;
+
+            // Isn't reset, stays the mode chosen in Init
+            TextureMode CurrentTextureMode = TextureMode::Slots;
         };
 
         static Statistics& GetStatistics();
+        static const char* GetTextureModeName(TextureMode textureMode);
 
         static void ResetStatistics();
 
@@ -102,6 +161,9 @@ namespace Ziben {
         static constexpr uint32_t                 s_MaxVertexCount      = s_MaxQuadCount * 4;
         static constexpr uint32_t                 s_MaxIndexCount       = s_MaxQuadCount * 6;
         static constexpr uint32_t                 s_MaxTextureSlots     = 32; // TODO: RenderCaps
+        static constexpr uint32_t                 s_TextureArraySlot    = s_MaxTextureSlots - 1;
+        static constexpr uint32_t                 s_MaxBindlessTextures = 4096;
+        static constexpr uint32_t                 s_HandleBufferBinding = 0;
 
         static constexpr std::array<glm::vec4, 4> s_QuadVertexPositions = {
             glm::vec4(-0.5f, -0.5f, 0.0f, 1.0f),
@@ -121,15 +183,35 @@ namespace Ziben {
         struct Data {
             Ref<VertexArray>                              QuadVertexArray;
             Ref<VertexBuffer>                             QuadVertexBuffer;
+            Ref<IndexBuffer>                              QuadIndexBuffer;
             Ref<Shader>                                   TextureShader;
             Ref<Texture2D>                                WhiteTexture;
 
+            Ref<VertexArray>                              TilemapVertexArray;
+            Ref<VertexBuffer>                             TilemapVertexBuffer;
+            Ref<Shader>                                   TilemapShader;
+            Uniform<glm::vec2>                            TilesetGridUniform      { "u_TilesetGrid" };
+            Uniform<float>                                MipBiasUniform          { "u_MipBias" };
+
             uint32_t                                      QuadIndexCount          = 0;
             QuadVertex*                                   QuadVertexBufferBase    = nullptr;
             QuadVertex*                                   QuadVertexBufferPointer = nullptr;
 
+            TextureMode                                   Mode                    = TextureMode::Slots;
+            float                                         MipBias                 = 0.0f;
+
             std::array<Ref<Texture2D>, s_MaxTextureSlots> TextureSlots            = { nullptr };
             uint32_t                                      TextureSlotIndex        = 1; // 0 - WhiteTexture
+            Ref<Texture2DArray>                           TextureArray;
+
+            // Bindless mode, the texture index is the index of the handle
+            Ref<StorageBuffer>                            TextureHandleBuffer;
+            std::vector<uint64_t>                         TextureHandles;
+            std::vector<Ref<Texture2D>>                   BindlessTextures;
+            std::unordered_map<HandleType, uint32_t>      BindlessTextureIndices;
+
+            Frustum                                       CameraFrustum;
+            glm::mat4                                     CameraViewProjectionMatrix = glm::mat4(1.0f);
         };
 
     private:
@@ -138,6 +220,9 @@ namespace Ziben {
         static void StartBatch();
         static void NextBatch();
 
+        // Slot of the texture in the current batch, starts a new batch when the slots are exhausted
+        static uint32_t GetTextureIndex(const Ref<Texture2D>& texture);
+
     }; // class Renderer2D
 
 } // namespace Ziben
\ No newline at end of file
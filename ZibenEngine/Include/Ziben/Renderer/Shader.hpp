@@ -86,48 +86,124 @@ namespace Ziben {
         Compute        = GL_COMPUTE_SHADER
     };
 
+    // Index of a uniform name, the same for every shader
+    using UniformId = uint32_t;
+
+    template <typename T>
+    class Uniform;
+
+    // Linked programs are kept in the asset cache as driver binaries keyed by the source and the driver,
+    // a program restored from the cache skips compilation and linking
     class Shader {
+    public:
+        struct Statistics {
+            uint32_t CompiledCount       = 0;
+            uint32_t CachedCount         = 0;
+            uint32_t RejectedCount       = 0; // Cache entries the driver refused
+            float    CompileMilliseconds = 0.0f;
+            float    CacheMilliseconds   = 0.0f;
+        };
+
     public:
         static Ref<Shader> Create(const std::string& filepath);
 
         static void Bind(const Ref<Shader>& shader);
         static void Unbind();
 
+        // Registers the name on the first call
+        static UniformId GetUniformId(std::string_view name);
+
+        // Splits the file into the stages by the #type directives, can be called from any thread
+        static bool PreProcess(const std::string& shaderSource, std::map<ShaderType, std::string>& sources);
+
+        static Statistics& GetStatistics();
+
     public:
         explicit Shader(const std::string& filepath);
         ~Shader();
 
         [[nodiscard]] inline const std::string& GetName() const { return m_Name; }
+        [[nodiscard]] inline const std::string& GetFilepath() const { return m_Filepath; }
 
         void Compile(const std::map<ShaderType, std::string>& sources);
 
         void BindAttribLocation(uint32_t location, const std::string& name) const;
         void BindFragDataLocation(uint32_t location, const std::string& name) const;
 
-        void SetUniform(const std::string& name, bool value);
-        void SetUniform(const std::string& name, int value);
-        void SetUniform(const std::string& name, int* values, uint32_t count);
-        void SetUniform(const std::string& name, float value);
-        void SetUniform(const std::string& name, float x, float y, float z);
-        void SetUniform(const std::string& name, const glm::vec3& vec3);
-        void SetUniform(const std::string& name, const glm::vec4& vec4);
-        void SetUniform(const std::string& name, const glm::mat3& mat3);
-        void SetUniform(const std::string& name, const glm::mat4& mat4);
+        // The program must be bound, uniforms the program doesn't use are ignored
+        template <typename T>
+        void SetUniform(const Uniform<T>& uniform, const T& value) const { SetUniform(uniform.GetId(), value); }
+
+        void SetUniform(UniformId id, bool value) const;
+        void SetUniform(UniformId id, int value) const;
+        void SetUniform(UniformId id, const int* values, uint32_t count) const;
+        void SetUniform(UniformId id, float value) const;
+        void SetUniform(UniformId id, const glm::vec2& vec2) const;
+        void SetUniform(UniformId id, const glm::vec3& vec3) const;
+        void SetUniform(UniformId id, const glm::vec4& vec4) const;
+        void SetUniform(UniformId id, const glm::mat3& mat3) const;
+        void SetUniform(UniformId id, const glm::mat4& mat4) const;
+
+        // Resolve the name on every call, prefer Uniform handles on hot paths
+        void SetUniform(const std::string& name, bool value) const;
+        void SetUniform(const std::string& name, int value) const;
+        void SetUniform(const std::string& name, const int* values, uint32_t count) const;
+        void SetUniform(const std::string& name, float value) const;
+        void SetUniform(const std::string& name, float x, float y, float z) const;
+        void SetUniform(const std::string& name, const glm::vec2& vec2) const;
+        void SetUniform(const std::string& name, const glm::vec3& vec3) const;
+        void SetUniform(const std::string& name, const glm::vec4& vec4) const;
+        void SetUniform(const std::string& name, const glm::mat3& mat3) const;
+        void SetUniform(const std::string& name, const glm::mat4& mat4) const;
 
     private:
-        int GetUniformLocation(const std::string& name);
+        [[nodiscard]] inline int GetUniformLocation(UniformId id) const {
+            return id < m_UniformLocations.size() ? m_UniformLocations[id] : -1;
+        }
 
         void Compile(ShaderType type, const std::string& source) const;
         void Link() const;
 
+        // Locations of the active uniforms by UniformId, must follow every link
+        void Reflect() const;
+
+        bool LoadBinary();
+        void SaveBinary() const;
+
+        // Takes over a linked program built from the source, the uniform values of the old program are kept
+        void Swap(HandleType program, const std::string& source);
+
+    private:
+        friend class ShaderReloader;
+
+    private:
+        static constexpr uint32_t s_BinaryCacheMagic   = 0x4e425a53; // "SZBN"
+        static constexpr uint32_t s_BinaryCacheVersion = 1;
+
     private:
         HandleType                 m_Handle;
         mutable bool               m_IsLinked;
-        std::map<std::string, int> m_UniformLocations;
+        uint64_t                   m_BinaryHash; // Zero when the driver can't give out program binaries
+        mutable std::vector<int>   m_UniformLocations;
         std::string                m_Name;
+        std::string                m_Filepath;
 
     }; // class Shader
 
+    // Uniform name resolved once, the type of the value is checked at compile time
+    template <typename T>
+    class Uniform {
+    public:
+        explicit Uniform(std::string_view name)
+            : m_Id(Shader::GetUniformId(name)) {}
+
+        [[nodiscard]] inline UniformId GetId() const { return m_Id; }
+
+    private:
+        UniformId m_Id;
+
+    }; // class Uniform
+
     class ShaderLibrary {
     public:
         ShaderLibrary() = default;
@@ -139,6 +215,7 @@ namespace Ziben {
         void Push(const Ref<Shader>& shader);
         void Push(const std::string& name, const Ref<Shader>& shader);
 
+        // Shaders come from the AssetManager, loading the same file under the same name again is free
         Ref<Shader> Load(const std::string& filepath);
         Ref<Shader> Load(const std::string& name, const std::string& filepath);
 
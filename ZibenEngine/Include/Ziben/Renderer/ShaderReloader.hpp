@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Shader.hpp"
+#include "Ziben/System/FileWatcher.hpp"
+
+namespace Ziben {
+
+    // Rebuilds the shaders whose sources change on disk. Sources are read and preprocessed on a worker
+    // thread, programs are compiled and linked on the render thread, in the background of the driver when
+    // KHR_parallel_shader_compile is there, and swapped into the Shader objects, so every holder of the
+    // shader gets the new program. A failed build is logged and the old program stays
+    class ShaderReloader {
+    public:
+        struct Statistics {
+            uint32_t WatchedCount           = 0;
+            uint32_t PendingCount           = 0;
+            uint32_t ReloadedCount          = 0;
+            uint32_t FailedCount            = 0;
+            float    LastReloadMilliseconds = 0.0f; // From the file change to the swap
+            bool     IsParallel             = false;
+        };
+
+    public:
+        static void Init();
+        static void Shutdown();
+
+        // Render thread only
+        static void Watch(const Ref<Shader>& shader);
+
+        // Must be called once per frame on the render thread
+        static void Update();
+
+        static Statistics& GetStatistics();
+
+    private:
+        struct Request {
+            std::string                           Filepath;
+            std::string                           Source;
+            std::map<ShaderType, std::string>     Sources;
+            bool                                  IsValid = false;
+            std::chrono::steady_clock::time_point Begin;
+        };
+
+        struct Build {
+            std::weak_ptr<Shader>                 Target;
+            std::string                           Filepath;
+            std::string                           Source;
+            HandleType                            Program = 0;
+            std::vector<HandleType>               Stages;
+            std::chrono::steady_clock::time_point Begin;
+        };
+
+        struct Data {
+            std::thread                                                         Worker;
+            std::mutex                                                          Mutex;
+            std::condition_variable                                             Condition;
+            std::queue<Request>                                                 ReadQueue;
+            std::queue<Request>                                                 ReadyQueue;
+            bool                                                                IsRunning  = false;
+
+            // Render thread only
+            FileWatcher                                                         Watcher;
+            std::unordered_map<std::string, std::vector<std::weak_ptr<Shader>>> Shaders;
+            std::vector<Build>                                                  Builds;
+            bool                                                                IsParallel = false;
+        };
+
+    private:
+        static Data& GetData();
+
+        static void RunWorker();
+
+        static void StartBuild(const Request& request, const Ref<Shader>& shader);
+
+        // Returns false while the driver still compiles the program
+        static bool FinishBuild(Build& build);
+
+    }; // class ShaderReloader
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace Ziben {
+
+    // Skyline bottom-left rectangle packer. The free space is kept as the top outline of the
+    // placed rectangles, every rectangle goes where its top edge ends up the lowest
+    class SkylinePacker {
+    public:
+        SkylinePacker(uint32_t width, uint32_t height);
+        ~SkylinePacker() = default;
+
+    public:
+        [[nodiscard]] inline uint32_t GetWidth() const { return m_Width; }
+        [[nodiscard]] inline uint32_t GetHeight() const { return m_Height; }
+        [[nodiscard]] inline uint64_t GetUsedArea() const { return m_UsedArea; }
+
+        // Used part of the area, in [0, 1]
+        [[nodiscard]] float GetOccupancy() const;
+
+        // Returns false if the rectangle doesn't fit anymore
+        bool Pack(uint32_t width, uint32_t height, glm::uvec2& position);
+
+        void Clear();
+
+    private:
+        struct Segment {
+            uint32_t X;
+            uint32_t Y;
+            uint32_t Width;
+        };
+
+    private:
+        // Bottom of the rectangle placed at the start of the segment, or false if it doesn't fit there
+        bool Fit(std::size_t segmentIndex, uint32_t width, uint32_t height, uint32_t& y) const;
+
+    private:
+        uint32_t             m_Width;
+        uint32_t             m_Height;
+        uint64_t             m_UsedArea;
+        std::vector<Segment> m_Skyline;
+
+    }; // class SkylinePacker
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "GpuBuffer.hpp"
+
+namespace Ziben {
+
+    // GL_SHADER_STORAGE_BUFFER, bound to an indexed binding point read by the shaders
+    class StorageBuffer {
+    public:
+        static Ref<StorageBuffer> Create(std::size_t size, BufferUsage usage = BufferUsage::Dynamic);
+
+        static void Bind(const Ref<StorageBuffer>& storageBuffer, uint32_t binding);
+        static void Unbind(uint32_t binding);
+
+    public:
+        StorageBuffer(std::size_t size, BufferUsage usage);
+
+        [[nodiscard]] inline HandleType GetHandle() const { return m_Buffer.GetHandle(); }
+        [[nodiscard]] inline std::size_t GetSize() const { return m_Buffer.GetSize(); }
+        [[nodiscard]] inline BufferUsage GetUsage() const { return m_Buffer.GetUsage(); }
+
+        void SetData(const void* data, std::size_t size, std::size_t offset = 0) const;
+
+    private:
+        GpuBuffer m_Buffer;
+
+    }; // class StorageBuffer
+
+} // namespace Ziben
\ No newline at end of file
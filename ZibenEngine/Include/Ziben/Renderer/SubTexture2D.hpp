@@ -15,6 +15,14 @@ namespace Ziben {
             const glm::vec2&      spriteSize = { 1, 1 }
         );
 
+        // Cell of a sheet that is itself a region, e.g. a sprite sheet packed into a TextureAtlas
+        static Ref<SubTexture2D> CreateFromCoords(
+            const Ref<SubTexture2D>& sheet,
+            const glm::vec2&         position,
+            const glm::vec2&         cellSize,
+            const glm::vec2&         spriteSize = { 1, 1 }
+        );
+
     public:
         SubTexture2D(const Ref<Texture2D>& texture, const glm::vec2& min, const glm::vec2& max);
 
@@ -22,7 +30,7 @@ namespace Ziben {
         [[nodiscard]] inline const glm::vec2* GetTexCoords() const { return m_TexCoords.data(); }
 
     private:
-        const Ref<Texture2D>&    m_Texture;
+        Ref<Texture2D>           m_Texture;
         std::array<glm::vec2, 4> m_TexCoords;
 
     }; // class SubTexture2D
@@ -5,6 +5,27 @@
 
 namespace Ziben {
 
+    enum class TextureFormat : uint8_t {
+        RGBA8 = 0,
+
+        // Unsigned integer indices, sampled with texelFetch through usampler2D
+        R16UI,
+
+        // Block compressed 4x4 texels: BC1 is 8 bytes per block with 1 bit alpha,
+        // BC3 and BC7 are 16 bytes per block with full alpha
+        BC1,
+        BC3,
+        BC7
+    };
+
+    // Block compressed image with its whole mip chain, as stored in a KTX2 file
+    struct CompressedImage {
+        TextureFormat                     Format = TextureFormat::BC3;
+        uint32_t                          Width  = 0;
+        uint32_t                          Height = 0;
+        std::vector<std::vector<uint8_t>> Levels; // Level 0 first
+    };
+
     class Texture {
     public:
 //        static Ref<Texture> Create(const std::string& filepath);
@@ -26,33 +47,102 @@ namespace Ziben {
     class Texture2D : public Texture {
     public:
         static Ref<Texture2D> Create(const std::string& filepath);
-        static Ref<Texture2D> Create(uint32_t width, uint32_t height);
+        static Ref<Texture2D> Create(uint32_t width, uint32_t height, TextureFormat format = TextureFormat::RGBA8, uint32_t levelCount = 1);
+        static Ref<Texture2D> Create(const CompressedImage& image);
 
         static void Bind(const Ref<Texture2D>& texture2D, uint32_t slot = 0);
         static void Unbind();
 
+        // Levels of the full mip chain down to 1x1
+        static uint32_t GetMipLevelCount(uint32_t width, uint32_t height);
+
+        // Decodes the image into RGBA8 pixels with the same orientation the textures are loaded with
+        static bool LoadPixels(const std::string& filepath, std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height);
+        static bool DecodePixels(const uint8_t* data, std::size_t size, std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height);
+
     public:
+        // Images get the full mip chain, *.ktx2 files are loaded as they are
         explicit Texture2D(const std::string& filepath);
-        Texture2D(uint32_t width, uint32_t height);
+        Texture2D(uint32_t width, uint32_t height, TextureFormat format = TextureFormat::RGBA8, uint32_t levelCount = 1);
+        explicit Texture2D(const CompressedImage& image);
         ~Texture2D() override;
 
         [[nodiscard]] uint32_t GetHandle() const { return m_Handle; }
         [[nodiscard]] uint32_t GetWidth() const override { return m_Width; }
         [[nodiscard]] uint32_t GetHeight() const override { return m_Height; }
+        [[nodiscard]] uint32_t GetLevelCount() const { return m_LevelCount; }
+
+        // VRAM taken by all levels
+        [[nodiscard]] std::size_t GetMemorySize() const { return m_MemorySize; }
+
+        // ARB_bindless_texture handle, made resident on the first call and kept resident
+        // for the lifetime of the texture. Sampler state can't be changed after that
+        [[nodiscard]] uint64_t GetBindlessHandle() const;
 
         void SetData(void* data, uint32_t size) override;
 
+        // Uploads the region of the image. rowLength is the width of the whole source image in texels,
+        // so a region can be copied straight out of a larger array
+        void SetData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t rowLength);
+
+        // Rebuilds the levels below 0 from level 0, doesn't work for compressed formats
+        void GenerateMipmaps();
+
     public:
         bool operator !=(const Texture2D& other) const;
         bool operator ==(const Texture2D& other) const;
 
+    private:
+        void StoreCompressed(const CompressedImage& image);
+        void StoreWhite();
+        void SetFilter();
+
+    private:
+        HandleType       m_Handle;
+        uint32_t         m_Width;
+        uint32_t         m_Height;
+        uint32_t         m_LevelCount;
+        uint32_t         m_InternalFormat;
+        uint32_t         m_DataFormat;
+        uint32_t         m_DataType;
+        std::size_t      m_MemorySize;
+        mutable uint64_t m_BindlessHandle;
+
+    }; // class Texture2D
+
+    // Layers of the same size and format, sampled through a single sampler2DArray
+    class Texture2DArray : public Texture {
+    public:
+        static Ref<Texture2DArray> Create(uint32_t width, uint32_t height, uint32_t layerCount);
+
+        static void Bind(const Ref<Texture2DArray>& texture2DArray, uint32_t slot = 0);
+
+    public:
+        Texture2DArray(uint32_t width, uint32_t height, uint32_t layerCount);
+        ~Texture2DArray() override;
+
+        [[nodiscard]] uint32_t GetHandle() const { return m_Handle; }
+        [[nodiscard]] uint32_t GetWidth() const override { return m_Width; }
+        [[nodiscard]] uint32_t GetHeight() const override { return m_Height; }
+        [[nodiscard]] uint32_t GetLayerCount() const { return m_LayerCount; }
+
+        // RGBA8 pixels of all layers
+        void SetData(void* data, uint32_t size) override;
+        void SetLayerData(uint32_t layer, const void* data);
+
+        // The image must have the size of the array
+        bool LoadLayer(uint32_t layer, const std::string& filepath);
+
+    public:
+        bool operator !=(const Texture2DArray& other) const;
+        bool operator ==(const Texture2DArray& other) const;
+
     private:
         HandleType m_Handle;
         uint32_t   m_Width;
         uint32_t   m_Height;
-        uint32_t   m_InternalFormat;
-        uint32_t   m_DataFormat;
+        uint32_t   m_LayerCount;
 
-    }; // class Texture2D
+    }; // class Texture2DArray
 
 } // namespace Ziben
\ No newline at end of file
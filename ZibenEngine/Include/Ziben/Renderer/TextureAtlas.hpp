@@ -0,0 +1,69 @@
+#pragma once
+
+#include "SubTexture2D.hpp"
+#include "SkylinePacker.hpp"
+
+namespace Ziben {
+
+    // Packs many small images into shared RGBA8 pages, so sprites that use them land in
+    // the same texture slot and batch together. Every region is surrounded by padding filled
+    // with its edge texels, which keeps linear filtering from picking up the neighbours.
+    // Images can be added one by one at runtime or built at once, which packs them tighter.
+    // Regions don't wrap, so they can't be drawn with a tiling factor
+    class TextureAtlas {
+    public:
+        struct Statistics {
+            uint32_t PageCount   = 0;
+            uint32_t RegionCount = 0;
+
+            // Texels of the images over the texels of the pages, in [0, 1]
+            float    Efficiency  = 0.0f;
+        };
+
+    public:
+        static Ref<TextureAtlas> Create(uint32_t pageSize = 2048, uint32_t padding = 1);
+
+    public:
+        explicit TextureAtlas(uint32_t pageSize = 2048, uint32_t padding = 1);
+        ~TextureAtlas() = default;
+
+    public:
+        [[nodiscard]] inline uint32_t GetPageSize() const { return m_PageSize; }
+        [[nodiscard]] inline std::size_t GetPageCount() const { return m_Pages.size(); }
+        [[nodiscard]] inline const Ref<Texture2D>& GetPage(std::size_t index) const { return m_Pages[index].Texture; }
+
+        [[nodiscard]] Statistics GetStatistics() const;
+
+        // Region of the image added under the name, nullptr if there is none
+        [[nodiscard]] Ref<SubTexture2D> Get(const std::string& name) const;
+
+        // Runtime packing, the name of an image loaded from a file is its path.
+        // Adding an existing name returns the region it already has
+        Ref<SubTexture2D> Add(const std::string& filepath);
+        Ref<SubTexture2D> Add(const std::string& name, const uint8_t* pixels, uint32_t width, uint32_t height);
+
+        // Loads all images first and packs them from the largest to the smallest
+        std::vector<Ref<SubTexture2D>> Build(const std::vector<std::string>& filepaths);
+
+        void Clear();
+
+    private:
+        struct Page {
+            Ref<Texture2D> Texture;
+            SkylinePacker  Packer;
+        };
+
+    private:
+        Ref<SubTexture2D> Pack(const std::string& name, const uint8_t* pixels, uint32_t width, uint32_t height);
+
+    private:
+        uint32_t                                           m_PageSize;
+        uint32_t                                           m_Padding;
+        uint64_t                                           m_ImageArea;
+        std::vector<Page>                                  m_Pages;
+        std::unordered_map<std::string, Ref<SubTexture2D>> m_Regions;
+        std::vector<uint8_t>                               m_PaddedPixels;
+
+    }; // class TextureAtlas
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Texture.hpp"
+
+namespace Ziben {
+
+    // Conversion of images into block compressed KTX2 files. The blocks are encoded by the GL driver
+    // once per image content, the result is kept in the asset cache and loaded straight into VRAM afterwards
+    class TextureCompressor {
+    public:
+        // Uses the cached conversion of the image content when there is one.
+        // Falls back to the uncompressed texture when the driver can't encode the format
+        static Ref<Texture2D> Load(const std::string& filepath, TextureFormat format = TextureFormat::BC3);
+
+        // Box filtered RGBA8 levels down to 1x1, level 0 is the image itself.
+        // Colors are weighted by alpha, so transparent texels don't darken the sprite edges
+        static void GenerateMipChain(
+            const std::vector<uint8_t>&        pixels,
+            uint32_t                           width,
+            uint32_t                           height,
+            std::vector<std::vector<uint8_t>>& levels
+        );
+
+        // Encodes RGBA8 levels, must be called on the render thread
+        static bool Compress(
+            const std::vector<std::vector<uint8_t>>& levels,
+            uint32_t                                 width,
+            uint32_t                                 height,
+            TextureFormat                            format,
+            CompressedImage&                         image
+        );
+
+        // Only BC1, BC3 and BC7 2D images without supercompression are supported
+        static bool ReadKtx2(const std::string& filepath, CompressedImage& image);
+        static bool WriteKtx2(const std::string& filepath, const CompressedImage& image);
+
+        [[nodiscard]] static bool IsCompressed(TextureFormat format);
+        [[nodiscard]] static uint32_t GetInternalFormat(TextureFormat format);
+
+        // Bytes per 4x4 block
+        [[nodiscard]] static uint32_t GetBlockSize(TextureFormat format);
+
+    }; // class TextureCompressor
+
+} // namespace Ziben
\ No newline at end of file
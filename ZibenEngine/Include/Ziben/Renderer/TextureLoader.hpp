@@ -0,0 +1,132 @@
+#pragma once
+
+#include "Texture.hpp"
+#include "GpuBuffer.hpp"
+
+namespace Ziben {
+
+    // Texture requested from the TextureLoader. It's drawn with the placeholder until the last row
+    // of the image is uploaded, so it can be used right after the request
+    class AsyncTexture2D {
+    public:
+        enum class State : uint8_t {
+            Decoding = 0,
+            Uploading,
+            Ready,
+            Failed
+        };
+
+    public:
+        explicit AsyncTexture2D(std::string filepath);
+        ~AsyncTexture2D() = default;
+
+    public:
+        [[nodiscard]] inline const std::string& GetFilepath() const { return m_Filepath; }
+        [[nodiscard]] inline State GetState() const { return m_State; }
+        [[nodiscard]] inline bool IsReady() const { return m_State == State::Ready; }
+        [[nodiscard]] inline bool IsFailed() const { return m_State == State::Failed; }
+
+        // The loaded texture or the placeholder
+        [[nodiscard]] const Ref<Texture2D>& GetTexture() const;
+
+    private:
+        friend class TextureLoader;
+
+    private:
+        std::string          m_Filepath;
+        std::atomic<State>   m_State;
+        Ref<Texture2D>       m_Texture;
+        std::vector<uint8_t> m_Pixels;
+        uint64_t             m_Hash;
+        uint32_t             m_Width;
+        uint32_t             m_Height;
+        uint32_t             m_UploadedRows;
+
+    }; // class AsyncTexture2D
+
+    // Images are decoded on worker threads and uploaded on the render thread through persistently
+    // mapped pixel unpack buffers. Update copies at most the byte budget per frame, large images are
+    // split by rows over several frames, so loading hundreds of textures doesn't stall a frame.
+    // The uploaded textures join the AssetManager registry, an image it already has isn't uploaded again
+    class TextureLoader {
+    public:
+        struct Statistics {
+            uint32_t PendingCount       = 0;
+            uint32_t LoadedCount        = 0;
+            uint32_t FailedCount        = 0;
+            uint64_t UploadedBytes      = 0;
+            uint64_t FrameUploadedBytes = 0;
+            uint32_t StagingStalls      = 0;
+
+            // From the first request to the last upload of the latest batch of requests
+            uint32_t BatchTextureCount  = 0;
+            uint64_t BatchBytes         = 0;
+            float    BatchMilliseconds  = 0.0f;
+            float    BatchThroughput    = 0.0f; // MB/s
+        };
+
+    public:
+        static constexpr std::size_t s_DefaultUploadBudget = 8 * 1024 * 1024;
+
+    public:
+        // workerCount 0 picks it from the hardware concurrency
+        static void Init(uint32_t workerCount = 0);
+        static void Shutdown();
+
+        // Requests of the same path share the texture while it's alive. Render thread only
+        static Ref<AsyncTexture2D> Load(const std::string& filepath);
+
+        // Uploads the decoded images, must be called once per frame on the render thread
+        static void Update(std::size_t uploadBudget = s_DefaultUploadBudget);
+
+        [[nodiscard]] static const Ref<Texture2D>& GetPlaceholder();
+
+        static Statistics& GetStatistics();
+
+    private:
+        static constexpr uint32_t    s_MaxWorkerCount     = 4;
+        static constexpr uint32_t    s_StagingBufferCount = 3;
+        static constexpr std::size_t s_StagingBufferSize  = s_DefaultUploadBudget;
+
+    private:
+        struct StagingBuffer {
+            Ref<GpuBuffer> Buffer;
+            GLsync         Fence = nullptr;
+        };
+
+        struct Data {
+            Ref<Texture2D>                                                 Placeholder;
+
+            std::vector<std::thread>                                       Workers;
+            std::mutex                                                     Mutex;
+            std::condition_variable                                        Condition;
+            std::queue<Ref<AsyncTexture2D>>                                DecodeQueue;
+            std::queue<Ref<AsyncTexture2D>>                                DecodedQueue;
+            bool                                                           IsRunning          = false;
+
+            // Render thread only
+            std::unordered_map<std::string, std::weak_ptr<AsyncTexture2D>> Textures;
+            std::queue<Ref<AsyncTexture2D>>                                UploadQueue;
+            std::array<StagingBuffer, s_StagingBufferCount>                StagingBuffers;
+            uint32_t                                                       StagingBufferIndex = 0;
+            std::chrono::steady_clock::time_point                          BatchBegin;
+            uint32_t                                                       BatchTextureCount  = 0;
+            uint64_t                                                       BatchBytes         = 0;
+        };
+
+    private:
+        static Data& GetData();
+
+        static void RunWorker();
+
+        // Returns the uploaded byte count
+        static std::size_t UploadRows(std::size_t uploadBudget);
+        static void FinishBatch();
+
+        // Registers the texture in the AssetManager and makes it ready, the loaded texture is either
+        // the uploaded one or the one the registry already had for the same image
+        static void FinishTexture(AsyncTexture2D& texture, Ref<Texture2D> loadedTexture);
+
+    }; // class TextureLoader
+
+} // namespace Ziben
\ No newline at end of file
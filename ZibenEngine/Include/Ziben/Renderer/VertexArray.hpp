@@ -18,12 +18,13 @@ namespace Ziben {
 
         [[nodiscard]] const Ref<IndexBuffer>& GetIndexBuffer() const { return m_IndexBuffer; }
 
+        // The buffer is read through its own binding, the attributes are numbered in the order of pushing
         void PushVertexBuffer(const Ref<VertexBuffer>& vertexBuffer);
         void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer);
 
     private:
         HandleType                     m_Handle;
-        std::size_t                    m_VertexBufferIndex;
+        uint32_t                       m_AttributeIndex;
         std::vector<Ref<VertexBuffer>> m_VertexBuffers;
         Ref<IndexBuffer>               m_IndexBuffer;
 
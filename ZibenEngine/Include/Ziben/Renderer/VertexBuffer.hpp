@@ -1,6 +1,6 @@
 #pragma once
 
-#include "GraphicsCore.hpp"
+#include "GpuBuffer.hpp"
 #include "VertexBufferLayout.hpp"
 
 namespace Ziben {
@@ -16,19 +16,17 @@ namespace Ziben {
     public:
         explicit VertexBuffer(std::size_t size);
         VertexBuffer(const void* data, std::size_t size, BufferUsage usage);
-        ~VertexBuffer();
 
-        [[nodiscard]] inline std::size_t GetSize() const { return m_Size; }
-        [[nodiscard]] inline BufferUsage GetUsage() const { return m_Usage; }
+        [[nodiscard]] inline HandleType GetHandle() const { return m_Buffer.GetHandle(); }
+        [[nodiscard]] inline std::size_t GetSize() const { return m_Buffer.GetSize(); }
+        [[nodiscard]] inline BufferUsage GetUsage() const { return m_Buffer.GetUsage(); }
         [[nodiscard]] inline const VertexBufferLayout& GetLayout() const { return m_Layout; }
 
         void SetLayout(const VertexBufferLayout& layout);
-        void SetData(const void* data, std::size_t size) const;
+        void SetData(const void* data, std::size_t size, std::size_t offset = 0) const;
 
     private:
-        HandleType         m_Handle;
-        std::size_t        m_Size;
-        BufferUsage        m_Usage;
+        GpuBuffer          m_Buffer;
         VertexBufferLayout m_Layout;
 
     }; // class VertexBuffer
@@ -24,10 +24,12 @@ namespace Ziben {
 
     public:
         VertexBufferLayout();
-        VertexBufferLayout(std::initializer_list<Element> elements);
+        // With the divisor 1 the attributes advance once per instance instead of once per vertex
+        VertexBufferLayout(std::initializer_list<Element> elements, uint32_t divisor = 0);
         ~VertexBufferLayout() = default;
 
         [[nodiscard]] inline std::size_t GetStride() const { return m_Stride; }
+        [[nodiscard]] inline uint32_t GetDivisor() const { return m_Divisor; }
 
         [[nodiscard]] ElementIterator Begin() { return m_Elements.begin(); }
         [[nodiscard]] ElementIterator End() { return m_Elements.end(); }
@@ -38,6 +40,7 @@ namespace Ziben {
     private:
         ElementContainer m_Elements;
         std::size_t      m_Stride;
+        uint32_t         m_Divisor;
 
     }; // class VertexBufferLayout
 
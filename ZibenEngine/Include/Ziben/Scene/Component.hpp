@@ -2,11 +2,16 @@
 
 #include <glm/glm.hpp>
 
+#include "UUID.hpp"
 #include "SceneCamera.hpp"
 #include "ScriptableEntity.hpp"
 
 namespace Ziben {
 
+    struct IDComponent {
+        UUID ID;
+    };
+
     struct TagComponent {
         std::string Tag = "EnTT";
 
@@ -35,7 +40,8 @@ namespace Ziben {
         [[nodiscard]] inline float GetScaleZ() const { return m_Scale.z; }
         [[nodiscard]] inline const glm::vec3& GetScale() const { return m_Scale; }
 
-        [[nodiscard]] glm::mat4 GetTransform() const;
+        // Cached, recalculated only after the component was changed
+        [[nodiscard]] const glm::mat4& GetTransform() const;
 
         void SetX(float x);
         void SetY(float y);
@@ -56,20 +62,94 @@ namespace Ziben {
         explicit operator glm::mat4 () const { return GetTransform(); }
 
     private:
-        glm::vec3 m_Translation;
-        glm::vec3 m_Rotation;
-        glm::vec3 m_Scale;
+        glm::vec3         m_Translation;
+        glm::vec3         m_Rotation;
+        glm::vec3         m_Scale;
+        mutable glm::mat4 m_Transform;
+        mutable bool      m_IsTransformDirty;
 
     }; // class TransformComponent
 
     struct SpriteRendererComponent {
     public:
-        glm::vec4 Color = glm::vec4(1.0f);
+        glm::vec4 Color    = glm::vec4(1.0f);
+
+        // Static sprites are baked into retained chunks and reuploaded only when they change
+        bool      IsStatic = false;
 
         inline explicit operator glm::vec4& () { return Color; }
         inline explicit operator const glm::vec4& () const { return Color; }
     };
 
+    // Mesh drawn through the MeshQueue, the entities showing the same mesh are instanced
+    struct MeshComponent {
+        // Path of the mesh asset or the name of a built-in mesh, see AssetManager::LoadMesh
+        std::string MeshPath = "Primitives/Cube";
+    };
+
+    // Entities with the same shader are drawn together. Without a shader path
+    // or the whole component the default MeshQueue shader is used
+    struct MaterialComponent {
+        std::string ShaderPath;
+        glm::vec4   Color = glm::vec4(1.0f);
+    };
+
+    // Dense grid of tile indices, one world unit per tile with the origin in the bottom left corner.
+    // Tile 0 is empty, tile i is the (i - 1)th cell of the tileset counted row by row from the bottom left
+    class TilemapComponent {
+    public:
+        using TileType = uint16_t;
+
+        static constexpr uint32_t ChunkSize = 64;
+        static constexpr uint32_t MaxSize   = 4096;
+        static constexpr TileType EmptyTile = 0;
+
+    public:
+        explicit TilemapComponent(uint32_t width = 0, uint32_t height = 0);
+        ~TilemapComponent() = default;
+
+    public:
+        [[nodiscard]] inline uint32_t GetWidth() const { return m_Width; }
+        [[nodiscard]] inline uint32_t GetHeight() const { return m_Height; }
+        [[nodiscard]] inline const std::vector<TileType>& GetTiles() const { return m_Tiles; }
+        [[nodiscard]] inline TileType GetTile(uint32_t x, uint32_t y) const { return m_Tiles[y * m_Width + x]; }
+
+        [[nodiscard]] inline uint32_t GetChunkCountX() const { return (m_Width + ChunkSize - 1) / ChunkSize; }
+        [[nodiscard]] inline uint32_t GetChunkCountY() const { return (m_Height + ChunkSize - 1) / ChunkSize; }
+
+        // Transform of the Renderer2D quad over the whole map, tile (x, y) covers [x, x + 1] x [y, y + 1] in the local space
+        [[nodiscard]] glm::mat4 GetQuadTransform() const;
+
+        // Incremented on every edit of the chunk, renderers compare it with the revision they uploaded
+        [[nodiscard]] inline uint32_t GetChunkRevision(uint32_t chunkX, uint32_t chunkY) const { return m_ChunkRevisions[chunkY * GetChunkCountX() + chunkX]; }
+
+        // Keeps the tiles of the overlapping area
+        void Resize(uint32_t width, uint32_t height);
+
+        void SetTile(uint32_t x, uint32_t y, TileType tile);
+        void Fill(uint32_t x, uint32_t y, uint32_t width, uint32_t height, TileType tile);
+
+        // Write tiles starting at the row major index, used by the serializer
+        void SetTiles(std::size_t offset, std::size_t count, TileType tile);
+        void SetTiles(std::size_t offset, const TileType* tiles, std::size_t count);
+
+    public:
+        std::string TilesetPath;
+        glm::vec2   TilesetCellSize = glm::vec2(128.0f);
+        glm::vec4   Color           = glm::vec4(1.0f);
+
+    private:
+        void MarkChunks(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+        void MarkChunks(std::size_t offset, std::size_t count);
+
+    private:
+        uint32_t              m_Width;
+        uint32_t              m_Height;
+        std::vector<TileType> m_Tiles;
+        std::vector<uint32_t> m_ChunkRevisions;
+
+    }; // class TilemapComponent
+
     struct CameraComponent {
         SceneCamera Camera;
         bool        IsPrimary           = false;
@@ -82,17 +162,26 @@ namespace Ziben {
         ~NativeScriptComponent() = default;
 
     public:
+        // The name is written to the snapshots, so it has to be the same in every build
         template <typename T>
-        void Bind();
+        void Bind(std::string_view scriptName);
+
+        // Binds the script that was bound before under the name, used to restore snapshots
+        bool Bind(std::string_view scriptName);
 
     public:
         using InstantiateScript = ScriptableEntity*(*)();
         using DestroyScript     = void(*)(NativeScriptComponent*);
 
+    private:
+        // Returns the registered copy of the name
+        static const char* RegisterBinding(std::string_view scriptName, InstantiateScript instantiateScript, DestroyScript destroyScript);
+
     public:
         ScriptableEntity*     m_Instance;
         InstantiateScript     m_InstantiateScript;
         DestroyScript         m_DestroyScript;
+        const char*           m_ScriptName;
 
     }; // class NativeScriptComponent
 
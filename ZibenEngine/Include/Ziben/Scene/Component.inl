@@ -1,13 +1,15 @@
 namespace Ziben {
 
     template <typename T>
-    void NativeScriptComponent::Bind() {
+    void NativeScriptComponent::Bind(std::string_view scriptName) {
         m_InstantiateScript = [] { return static_cast<ScriptableEntity*>(new T()); };
 
         m_DestroyScript = [](NativeScriptComponent* component) {
             delete component->m_Instance;
             component->m_Instance = nullptr;
         };
+
+        m_ScriptName = RegisterBinding(scriptName, m_InstantiateScript, m_DestroyScript);
     }
 
 } // namespace Ziben
\ No newline at end of file
@@ -29,9 +29,15 @@ namespace Ziben {
         template <typename Component, typename... Args>
         Component& PushComponent(Args&&... args);
 
+        // Modifies the component through the functions and notifies the scene about the change
+        template <typename Component, typename... Functions>
+        Component& PatchComponent(Functions&&... functions);
+
         template <typename Component>
         void PopComponent();
 
+        [[nodiscard]] UUID GetUUID() const;
+
     public:
         explicit inline operator bool() const { return m_Handle != entt::null; }
         explicit inline operator uint32_t() const { return static_cast<uint32_t>(m_Handle); }
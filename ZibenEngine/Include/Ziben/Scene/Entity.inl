@@ -28,6 +28,12 @@ namespace Ziben {
         return m_Scene->m_Registry.emplace<Component>(m_Handle, std::forward<Args>(args)...);
     }
 
+    template <typename Component, typename... Functions>
+    Component& Entity::PatchComponent(Functions&&... functions) {
+        assert(HasComponent<Component>());
+        return m_Scene->m_Registry.patch<Component>(m_Handle, std::forward<Functions>(functions)...);
+    }
+
     template <typename Component>
     void Entity::PopComponent() {
         assert(HasComponent<Component>());
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <entt/entt.hpp>
+
+#include "Ziben/Renderer/AssetManager.hpp"
+#include "Ziben/Renderer/Frustum.hpp"
+
+namespace Ziben {
+
+    // Meshes and shaders of the mesh entities resolved from their paths. The paths are compared every
+    // frame, the assets are looked up only after a change. Visible entities are submitted to the MeshQueue
+    // with the level of detail picked by their size on the screen, the level is remembered per entity
+    class MeshCache {
+    public:
+        MeshCache() = default;
+        ~MeshCache() = default;
+
+    public:
+        [[nodiscard]] inline std::size_t GetSize() const { return m_Entries.size(); }
+
+        void Remove(entt::entity handle);
+
+        // Resolves the mesh and the shader of the entity, Render does it on its own for the changed paths
+        inline void Prepare(const entt::registry& registry, entt::entity handle) { Resolve(registry, handle); }
+
+        // Null while the mesh of the entity is missing
+        [[nodiscard]] inline const Mesh* GetMesh(const entt::registry& registry, entt::entity handle) { return Resolve(registry, handle).Geometry.get(); }
+
+        // Culls and draws the meshes, must be called after the frame uniforms are set
+        void Render(const entt::registry& registry, const Frustum& frustum, const glm::mat4& viewProjectionMatrix);
+
+        void Clear();
+
+    private:
+        struct Entry {
+            Ref<Mesh>   Geometry;
+            std::string MeshPath;
+            Ref<Shader> MaterialShader;
+            std::string ShaderPath;
+            uint32_t    LodIndex = 0;
+        };
+
+    private:
+        Entry& Resolve(const entt::registry& registry, entt::entity handle);
+
+    private:
+        std::unordered_map<entt::entity, Entry> m_Entries;
+
+    }; // class MeshCache
+
+} // namespace Ziben
\ No newline at end of file
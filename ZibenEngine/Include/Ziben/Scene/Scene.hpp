@@ -4,6 +4,14 @@
 
 #include "Ziben/Window/TimeStep.hpp"
 #include "Ziben/Window/Event.hpp"
+#include "Ziben/Utility/Reference.hpp"
+#include "Ziben/Renderer/Frustum.hpp"
+
+#include "UUID.hpp"
+#include "SpatialIndex.hpp"
+#include "StaticSpriteCache.hpp"
+#include "TilemapCache.hpp"
+#include "MeshCache.hpp"
 
 namespace Ziben {
 
@@ -11,15 +19,32 @@ namespace Ziben {
     class EditorCamera;
 
     class Scene {
+    public:
+        // Duplicates the registry pool by pool, entity handles and UUIDs stay the same
+        static Ref<Scene> Copy(const Ref<Scene>& other);
+
     public:
         friend class Entity;
         friend class SceneSerializer;
+        friend class SceneLoader;
         friend class SceneHierarchyPanel;
 
     private:
         template <typename Component>
         void OnComponentPushed(entt::registry& registry, entt::entity handle);
 
+        template <typename Component>
+        void OnComponentChanged(entt::registry& registry, entt::entity handle);
+
+        template <typename... Components>
+        void TrackComponentChanges();
+
+        void OnSpriteChanged(entt::registry& registry, entt::entity handle);
+        void OnSpriteRemoved(entt::registry& registry, entt::entity handle);
+        void OnBoundsChanged(entt::registry& registry, entt::entity handle);
+        void OnTilemapRemoved(entt::registry& registry, entt::entity handle);
+        void OnMeshRemoved(entt::registry& registry, entt::entity handle);
+
     public:
         explicit Scene(std::string name);
         virtual ~Scene() = default;
@@ -30,19 +55,57 @@ namespace Ziben {
 
         void OnUpdateRuntime(const TimeStep& ts);
         void OnRenderRuntime();
+        void OnRuntimeStop();
 
         void OnViewportResize(uint32_t width, uint32_t height);
 
         Entity CreateEntity(const std::string& tag = "EnTT");
+        Entity CreateEntityWithUUID(UUID uuid, const std::string& tag = "EnTT");
         void DestroyEntity(const Entity& entity);
 
+        Entity GetEntityByUUID(UUID uuid);
         Entity GetPrimaryCameraEntity();
 
+        [[nodiscard]] bool HasUnsavedChanges() const;
+
+        // Spatial queries over the sprite, tilemap and mesh entities
+        std::vector<Entity> QueryRegion(const AABB& region);
+        std::vector<Entity> QueryFrustum(const Frustum& frustum);
+
+        // Closest entity hit by the ray, the sprite and tilemap quads are tested exactly in their local space, meshes by their bounds
+        Entity Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance = std::numeric_limits<float>::max());
+        Entity GetNearestEntity(const glm::vec3& point, float maxDistance = std::numeric_limits<float>::max());
+
+    private:
+        // Entities touched since the scene was last written to SaveState::Filepath
+        struct SaveState {
+            std::string              Filepath;
+            std::unordered_set<UUID> DirtyEntities;
+            std::unordered_set<UUID> DestroyedEntities;
+            std::size_t              AppendedRecordCount = 0;
+            bool                     IsTracking          = true;
+        };
+
+    private:
+        // Submits visible sprites and tilemaps to Renderer2D, must be called between BeginScene and EndScene
+        void RenderSprites();
+
+        // Draws the visible meshes before the sprites, so they are depth tested against the opaque geometry
+        void RenderMeshes();
+
+        void ResetSaveState(const std::string& filepath, std::size_t appendedRecordCount = 0);
+
     private:
-        std::string    m_Name;
-        uint32_t       m_ViewportWidth;
-        uint32_t       m_ViewportHeight;
-        entt::registry m_Registry;
+        std::string                            m_Name;
+        uint32_t                               m_ViewportWidth;
+        uint32_t                               m_ViewportHeight;
+        entt::registry                         m_Registry;
+        std::unordered_map<UUID, entt::entity> m_EntityMap;
+        SaveState                              m_SaveState;
+        SpatialIndex                           m_SpatialIndex;
+        StaticSpriteCache                      m_StaticSpriteCache;
+        TilemapCache                           m_TilemapCache;
+        MeshCache                              m_MeshCache;
 
     }; // class Scene
 
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Scene.hpp"
+#include "Ziben/Utility/Reference.hpp"
+
+namespace Ziben {
+
+    // Deserializes a scene on a background thread into its own registry. The main thread
+    // polls the loader every frame, runs the queued GPU uploads within a time budget and
+    // takes the finished scene with a single pointer swap. Meshes and tilemaps of the scene
+    // are uploaded one entity per task, so a large scene is spread over several frames.
+    class SceneLoader {
+    public:
+        using ProgressCallback = std::function<void(float)>;
+        using UploadTask       = std::function<void()>;
+
+    public:
+        SceneLoader();
+        ~SceneLoader();
+
+        SceneLoader(const SceneLoader&) = delete;
+        SceneLoader& operator =(const SceneLoader&) = delete;
+
+    public:
+        [[nodiscard]] inline bool IsLoading() const { return m_Future.valid() || m_Scene; }
+        [[nodiscard]] inline float GetProgress() const { return m_Progress; }
+        [[nodiscard]] inline const std::string& GetFilepath() const { return m_Filepath; }
+
+        // Progress callback is invoked from the loading thread
+        bool Load(const std::string& filepath, const ProgressCallback& progressCallback = {});
+
+        // Can be called from any thread, the task is run on the main thread by Poll
+        void PushUploadTask(UploadTask task);
+
+        // Returns the scene once it's deserialized and all of its uploads are done
+        Ref<Scene> Poll(std::chrono::microseconds uploadBudget);
+
+    private:
+        void PushSceneUploadTasks();
+        bool RunUploadTasks(std::chrono::microseconds uploadBudget);
+
+    private:
+        std::string             m_Filepath;
+        Ref<Scene>              m_Scene;
+        std::atomic<float>      m_Progress;
+        std::mutex              m_UploadMutex;
+        std::queue<UploadTask>  m_UploadTasks;
+
+        // The task captures the loader, so it's destroyed first
+        std::future<Ref<Scene>> m_Future;
+
+    }; // class SceneLoader
+
+} // namespace Ziben
\ No newline at end of file
@@ -4,28 +4,34 @@
 #include "Scene.hpp"
 #include "Ziben/Utility/Reference.hpp"
 
-namespace YAML {
-
-   class Emitter;
-
-} // namespace YAML
-
 namespace Ziben {
 
+    class SceneWriter;
+    class SnapshotWriter;
+    class SnapshotReader;
+
     class SceneSerializer {
+    public:
+        // Receives the part of the file that is already read, in [0, 1]
+        using ProgressCallback = std::function<void(float)>;
+
     public:
         explicit SceneSerializer(const Ref<Scene>& context);
         ~SceneSerializer() = default;
 
     public:
-        void Serialize(const std::string& filepath);
+        // False when the file can't be written completely, the scene keeps its unsaved changes then
+        bool Serialize(const std::string& filepath);
+        bool SerializeIncremental(const std::string& filepath);
         void SerializeRuntime(const std::string& filepath);
+        void SerializeRuntime(SnapshotWriter& out);
 
-        bool Deserialize(const std::string& filepath);
+        bool Deserialize(const std::string& filepath, const ProgressCallback& progressCallback = {});
         bool DeserializeRuntime(const std::string& filepath);
+        bool DeserializeRuntime(SnapshotReader& in);
 
     private:
-        static void SerializeEntity(YAML::Emitter& out, const Entity& entity);
+        static void SerializeEntity(SceneWriter& out, const Entity& entity);
 
     private:
         Ref<Scene> m_Context;
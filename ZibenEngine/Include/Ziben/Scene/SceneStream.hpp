@@ -0,0 +1,124 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace Ziben {
+
+    // Minimal streaming writer for the block-style YAML subset used by *.ziben files.
+    // Output goes straight into a fixed-size file buffer, nothing is accumulated in memory.
+    class SceneWriter {
+    public:
+        explicit SceneWriter(const std::string& filepath, bool isAppend = false);
+        ~SceneWriter();
+
+    public:
+        [[nodiscard]] inline bool IsOpen() const { return m_OutputStream.is_open(); }
+
+        // False once a write has failed or the nesting got too deep, the output is incomplete then
+        [[nodiscard]] inline bool IsGood() const { return !m_HasError && m_OutputStream.good(); }
+
+        void BeginMap(std::string_view key);
+        void EndMap();
+
+        void BeginSequence(std::string_view key);
+        void EndSequence();
+
+        // Continues the top level sequence that the appended file ends with
+        void ResumeSequence();
+
+        void BeginSequenceItem();
+        void EndSequenceItem();
+
+        void Write(std::string_view key, std::string_view value);
+        void Write(std::string_view key, const std::string& value);
+        void Write(std::string_view key, const char* value);
+        void Write(std::string_view key, bool value);
+        void Write(std::string_view key, int value);
+        void Write(std::string_view key, uint64_t value);
+        void Write(std::string_view key, float value);
+        void Write(std::string_view key, const glm::vec2& value);
+        void Write(std::string_view key, const glm::vec3& value);
+        void Write(std::string_view key, const glm::vec4& value);
+
+        // Returns IsGood after the buffered output is written
+        bool Flush();
+
+    private:
+        void WriteKey(std::string_view key);
+        void WriteString(std::string_view value);
+        void WriteFloat(float value);
+
+    private:
+        static inline constexpr std::size_t s_BufferSize = 64 * 1024;
+        static inline constexpr uint32_t    s_MaxIndent  = 16;
+
+    private:
+        std::vector<char> m_Buffer;
+        std::ofstream     m_OutputStream;
+        uint32_t          m_Indent;
+        bool              m_IsSequenceItemPending;
+        bool              m_HasError;
+
+    }; // class SceneWriter
+
+    // Event based reader for the same subset. Lines are parsed one by one and reported
+    // through the callback, so only the current line is kept in memory.
+    class SceneReader {
+    public:
+        enum class EventType : uint8_t {
+            None = 0,
+            BeginMap,
+            BeginSequenceItem,
+            Scalar
+        };
+
+        struct Event {
+            EventType        Type  = EventType::None;
+            uint32_t         Depth = 0;
+            std::string_view Key;
+            std::string_view Value;
+        };
+
+        using EventCallback = std::function<void(const Event&)>;
+
+    public:
+        explicit SceneReader(const std::string& filepath);
+        ~SceneReader() = default;
+
+    public:
+        [[nodiscard]] inline bool IsOpen() const { return m_InputStream.is_open(); }
+
+        // Part of the file consumed by Parse, in [0, 1]
+        [[nodiscard]] float GetProgress() const;
+
+        bool Parse(const EventCallback& callback);
+
+    public:
+        static bool ParseBool(std::string_view value, bool& result);
+        static bool ParseInt(std::string_view value, int& result);
+        static bool ParseUInt64(std::string_view value, uint64_t& result);
+        static bool ParseFloat(std::string_view value, float& result);
+        static bool ParseVec2(std::string_view value, glm::vec2& result);
+        static bool ParseVec3(std::string_view value, glm::vec3& result);
+        static bool ParseVec4(std::string_view value, glm::vec4& result);
+        static std::string ParseString(std::string_view value);
+
+    private:
+        // False when the line is nested deeper than s_MaxDepthCount
+        bool GetDepth(uint32_t column, uint32_t& depth);
+
+    private:
+        static inline constexpr std::size_t s_BufferSize    = 64 * 1024;
+        static inline constexpr std::size_t s_MaxDepthCount = 16;
+
+    private:
+        std::vector<char>                      m_Buffer;
+        std::ifstream                          m_InputStream;
+        std::array<uint32_t, s_MaxDepthCount>  m_Columns;
+        uint32_t                               m_ColumnCount;
+        std::size_t                            m_FileSize;
+        std::size_t                            m_ReadSize;
+
+    }; // class SceneReader
+
+} // namespace Ziben
\ No newline at end of file
@@ -4,9 +4,13 @@
 
 namespace Ziben {
 
+    class SnapshotWriter;
+    class SnapshotReader;
+
     class ScriptableEntity {
     public:
         friend class Scene;
+        friend class SceneSerializer;
 
     public:
         ScriptableEntity() = default;
@@ -19,13 +23,16 @@ namespace Ziben {
         template <typename Component>
         [[nodiscard]] inline const Component& GetComponent() const { return m_Entity.GetComponent<Component>(); }
 
+        // Runtime snapshot hooks, the state written by OnSerialize is read back by OnDeserialize.
+        // OnCreate isn't called for restored scripts
+        virtual void OnSerialize(SnapshotWriter& out) const {}
+        virtual void OnDeserialize(SnapshotReader& in) {}
+
     protected:
         virtual void OnCreate() {}
         virtual void OnDestroy() {}
         virtual void OnUpdate(const TimeStep& ts) {}
 
-    protected:
-
     private:
         Entity m_Entity;
 
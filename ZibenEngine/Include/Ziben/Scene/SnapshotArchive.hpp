@@ -0,0 +1,71 @@
+#pragma once
+
+namespace Ziben {
+
+    // Pointers and arrays are excluded, so strings always go through the std::string_view overload
+    template <typename T>
+    concept TriviallyCopyableConcept = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && !std::is_array_v<T>;
+
+    // Compact binary archive for runtime snapshots. Values are stored as raw bytes in native
+    // byte order, so a snapshot is only meant to be read back by the same build.
+    class SnapshotWriter {
+    public:
+        SnapshotWriter() = default;
+        ~SnapshotWriter() = default;
+
+    public:
+        [[nodiscard]] inline const std::vector<char>& GetBuffer() const { return m_Buffer; }
+        [[nodiscard]] inline std::size_t GetSize() const { return m_Buffer.size(); }
+
+        template <TriviallyCopyableConcept T>
+        void Write(const T& value);
+
+        // Overwrites a value that was written at the offset before
+        template <TriviallyCopyableConcept T>
+        void Patch(std::size_t offset, const T& value);
+
+        void Write(std::string_view value);
+        void WriteBytes(const void* data, std::size_t size);
+
+        void Clear();
+
+    private:
+        std::vector<char> m_Buffer;
+
+    }; // class SnapshotWriter
+
+    class SnapshotReader {
+    public:
+        SnapshotReader(const char* data, std::size_t size);
+        explicit SnapshotReader(const std::vector<char>& buffer);
+        ~SnapshotReader() = default;
+
+    public:
+        // Becomes false once a read goes past the end of the data
+        [[nodiscard]] inline bool IsValid() const { return m_IsValid; }
+        [[nodiscard]] inline std::size_t GetPosition() const { return m_Position; }
+
+        template <TriviallyCopyableConcept T>
+        void Read(T& value);
+
+        template <TriviallyCopyableConcept T>
+        [[nodiscard]] T Read();
+
+        void Read(std::string& value);
+        void ReadBytes(void* data, std::size_t size);
+        void Skip(std::size_t size);
+
+        // Reader over the next size bytes, which are skipped by this reader
+        [[nodiscard]] SnapshotReader Slice(std::size_t size);
+
+    private:
+        const char* m_Data;
+        std::size_t m_Size;
+        std::size_t m_Position;
+        bool        m_IsValid;
+
+    }; // class SnapshotReader
+
+} // namespace Ziben
+
+#include "SnapshotArchive.inl"
\ No newline at end of file
@@ -0,0 +1,27 @@
+namespace Ziben {
+
+    template <TriviallyCopyableConcept T>
+    void SnapshotWriter::Write(const T& value) {
+        WriteBytes(&value, sizeof(T));
+    }
+
+    template <TriviallyCopyableConcept T>
+    void SnapshotWriter::Patch(std::size_t offset, const T& value) {
+        assert(offset + sizeof(T) <= m_Buffer.size());
+        std::memcpy(m_Buffer.data() + offset, &value, sizeof(T));
+    }
+
+    template <TriviallyCopyableConcept T>
+    void SnapshotReader::Read(T& value) {
+        ReadBytes(&value, sizeof(T));
+    }
+
+    template <TriviallyCopyableConcept T>
+    T SnapshotReader::Read() {
+        T value{};
+        Read(value);
+
+        return value;
+    }
+
+} // namespace Ziben
\ No newline at end of file
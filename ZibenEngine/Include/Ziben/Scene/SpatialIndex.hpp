@@ -0,0 +1,56 @@
+#pragma once
+
+#include <entt/entt.hpp>
+
+#include "Ziben/Renderer/AABBTree.hpp"
+
+namespace Ziben {
+
+    class MeshCache;
+
+    // Bounds of the sprite, tilemap and mesh entities kept in dynamic AABB trees. Entities are only marked
+    // on changes, their bounds are recomputed lazily on the next Update. Static sprites and the entities
+    // without a sprite live in their own trees, so the per frame sprite traversal can skip them
+    class SpatialIndex {
+    public:
+        enum class Layer : uint8_t { Dynamic = 0, Static = 1, Geometry = 2, Count };
+
+    public:
+        SpatialIndex() = default;
+        ~SpatialIndex() = default;
+
+    public:
+        [[nodiscard]] inline const AABBTree& GetTree(Layer layer) const { return m_Trees[static_cast<std::size_t>(layer)]; }
+        [[nodiscard]] inline const auto& GetTrees() const { return m_Trees; }
+        [[nodiscard]] inline std::size_t GetSize() const { return m_Proxies.size(); }
+
+        [[nodiscard]] static inline entt::entity GetHandle(uint32_t userData) { return static_cast<entt::entity>(userData); }
+
+        // World bounds of everything the entity draws, false if it draws nothing
+        static bool GetBounds(const entt::registry& registry, MeshCache& meshCache, entt::entity handle, AABB& bounds);
+
+        void MarkMoved(entt::entity handle);
+        void Remove(entt::entity handle);
+
+        // Refits the marked entities, returns the number of leaves that were reinserted
+        std::size_t Update(const entt::registry& registry, MeshCache& meshCache);
+
+        void Clear();
+
+    private:
+        struct Proxy {
+            Layer   TreeLayer;
+            int32_t Index;
+        };
+
+    private:
+        [[nodiscard]] inline AABBTree& GetLayerTree(Layer layer) { return m_Trees[static_cast<std::size_t>(layer)]; }
+
+    private:
+        std::array<AABBTree, static_cast<std::size_t>(Layer::Count)> m_Trees;
+        std::unordered_map<entt::entity, Proxy>                       m_Proxies;
+        std::unordered_set<entt::entity>                              m_MovedEntities;
+
+    }; // class SpatialIndex
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <entt/entt.hpp>
+
+#include "Ziben/Renderer/Renderer2D.hpp"
+#include "Ziben/Renderer/AABB.hpp"
+
+namespace Ziben {
+
+    // Static sprites grouped by world grid cell into chunks with persistent vertex buffers.
+    // A chunk is rebuilt and uploaded only when one of its sprites is added, changed or removed,
+    // an emptied chunk frees its buffers and its slot is reused by the next new chunk.
+    // The chunks are drawn before the dynamic sprites rather than sorted with them, so a translucent
+    // static sprite never blends over a dynamic one behind it. Opaque sprites are still ordered by the depth test
+    class StaticSpriteCache {
+    public:
+        static constexpr uint32_t ChunkCapacity = 1024;
+        static constexpr float    CellSize      = 32.0f;
+
+    public:
+        StaticSpriteCache() = default;
+        ~StaticSpriteCache() = default;
+
+    public:
+        [[nodiscard]] inline bool Contains(entt::entity handle) const { return m_Slots.contains(handle); }
+        [[nodiscard]] inline std::size_t GetSize() const { return m_Slots.size(); }
+        [[nodiscard]] inline std::size_t GetChunkCount() const { return m_Chunks.size() - m_FreeChunks.size(); }
+
+        void MarkDirty(entt::entity handle);
+        void Remove(entt::entity handle);
+
+        // Places the marked sprites into chunks and rebuilds the dirty ones
+        void Update(const entt::registry& registry);
+
+        // Draws the chunks that intersect the frustum, must be called between BeginScene and EndScene
+        void Render(const Frustum& frustum) const;
+
+        void Clear();
+
+    private:
+        struct Chunk {
+            std::vector<entt::entity> Entities;
+            Ref<VertexBuffer>         QuadVertexBuffer;
+            Ref<VertexArray>          QuadVertexArray;
+            AABB                      Bounds;
+            uint64_t                  Cell      = 0;
+            uint32_t                  QuadCount = 0;
+            bool                      IsDirty   = true;
+        };
+
+        struct Slot {
+            uint32_t ChunkIndex;
+            uint32_t EntityIndex;
+        };
+
+    private:
+        void Insert(entt::entity handle, uint64_t cell);
+        void RebuildChunk(const entt::registry& registry, Chunk& chunk);
+        void ReleaseChunk(uint32_t chunkIndex);
+
+    private:
+        std::vector<Chunk>                                m_Chunks;
+        std::vector<uint32_t>                             m_FreeChunks;
+        std::unordered_map<uint64_t, std::vector<uint32_t>> m_CellChunks;
+        std::unordered_map<entt::entity, Slot>            m_Slots;
+        std::unordered_set<entt::entity>                  m_PendingEntities;
+        std::vector<Renderer2D::QuadVertex>               m_Vertices;
+
+    }; // class StaticSpriteCache
+
+} // namespace Ziben
\ No newline at end of file
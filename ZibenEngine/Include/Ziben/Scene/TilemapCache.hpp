@@ -0,0 +1,47 @@
+#pragma once
+
+#include <entt/entt.hpp>
+
+#include "Ziben/Renderer/TextureLoader.hpp"
+
+namespace Ziben {
+
+    // GPU side of the tilemaps: an R16UI texture of tile indices per tilemap and its tileset.
+    // Only the chunks whose revision changed since the last upload are copied into the texture
+    class TilemapCache {
+    public:
+        TilemapCache() = default;
+        ~TilemapCache() = default;
+
+    public:
+        [[nodiscard]] inline std::size_t GetSize() const { return m_Entries.size(); }
+
+        void Remove(entt::entity handle);
+
+        // Creates the textures of the tilemap and uploads its edited chunks without drawing it, on the render thread too
+        inline void Prepare(const entt::registry& registry, entt::entity handle) { Resolve(registry, handle); }
+
+        // Uploads the edited chunks and draws the tilemaps, must be called between BeginScene and EndScene.
+        // Textures are created here, so it has to run on the render thread
+        void Render(const entt::registry& registry);
+
+        void Clear();
+
+    private:
+        struct Entry {
+            Ref<Texture2D>        Tiles;
+            Ref<AsyncTexture2D>   Tileset;
+            std::string           TilesetPath;
+            std::vector<uint32_t> ChunkRevisions;
+        };
+
+    private:
+        // Null while the tilemap is empty or its tileset is missing
+        const Entry* Resolve(const entt::registry& registry, entt::entity handle);
+
+    private:
+        std::unordered_map<entt::entity, Entry> m_Entries;
+
+    }; // class TilemapCache
+
+} // namespace Ziben
\ No newline at end of file
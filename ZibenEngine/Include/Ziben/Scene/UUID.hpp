@@ -0,0 +1,33 @@
+#pragma once
+
+namespace Ziben {
+
+    class UUID {
+    public:
+        UUID();
+        explicit UUID(uint64_t value);
+        ~UUID() = default;
+
+    public:
+        explicit inline operator uint64_t() const { return m_Value; }
+
+        inline bool operator ==(const UUID& other) const { return m_Value == other.m_Value; }
+        inline bool operator !=(const UUID& other) const { return m_Value != other.m_Value; }
+
+    private:
+        uint64_t m_Value;
+
+    }; // class UUID
+
+} // namespace Ziben
+
+namespace std {
+
+    template <>
+    struct hash<Ziben::UUID> {
+        std::size_t operator ()(const Ziben::UUID& uuid) const {
+            return std::hash<uint64_t>()(static_cast<uint64_t>(uuid));
+        }
+    };
+
+} // namespace std
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+
+namespace Ziben {
+
+    // Reports the watched files that changed since the last Poll. On Linux the directories of the files
+    // are watched with inotify, so saves that replace the file are caught too. Other platforms compare
+    // the write times of the files every s_PollInterval
+    class FileWatcher {
+    public:
+        FileWatcher();
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator =(const FileWatcher&) = delete;
+
+        void Watch(const std::string& filepath);
+        void Unwatch(const std::string& filepath);
+
+        // The paths as they were passed to Watch, each changed file is reported once
+        std::vector<std::string> Poll();
+
+    private:
+        static constexpr std::chrono::milliseconds s_PollInterval = std::chrono::milliseconds(250);
+
+    private:
+        struct File {
+            std::string                     Path; // Normalized
+            std::filesystem::file_time_type WriteTime;
+        };
+
+    private:
+        int                                   m_Handle;
+        std::unordered_map<int, std::string>  m_Directories;
+        std::unordered_map<std::string, File> m_Files;
+        std::chrono::steady_clock::time_point m_LastPoll;
+
+    }; // class FileWatcher
+
+} // namespace Ziben
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include "Ziben/System/Log.hpp"
 #include "Ziben/Scene/ImGuiLayer.hpp"
 #include "Ziben/Renderer/Renderer.hpp"
+#include "Ziben/Renderer/TextureLoader.hpp"
+#include "Ziben/Renderer/ShaderReloader.hpp"
+#include "Ziben/Renderer/RenderState.hpp"
 #include "Ziben/Window/EventDispatcher.hpp"
 
 namespace Ziben {
@@ -45,6 +48,15 @@ namespace Ziben {
 
             m_TimeStep.Update(static_cast<float>(glfwGetTime()));
 
+            // Binds are counted per frame
+            RenderState::ResetStatistics();
+
+            // Textures requested last frame are drawn with their data from this one
+            TextureLoader::Update();
+
+            // Edited shaders are swapped in before anything is drawn
+            ShaderReloader::Update();
+
             if (!m_IsMinimized) {
                 {
                     ZIBEN_PROFILE_SCOPE("LayerStack OnUpdate");
@@ -0,0 +1,66 @@
+#include "AABB.hpp"
+
+namespace Ziben {
+
+    float AABB::GetSurfaceArea() const {
+        glm::vec3 size = Max - Min;
+
+        return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    float AABB::GetDistanceSquared(const glm::vec3& point) const {
+        glm::vec3 delta = glm::max(glm::max(Min - point, point - Max), glm::vec3(0.0f));
+
+        return glm::dot(delta, delta);
+    }
+
+    bool AABB::Contains(const AABB& other) const {
+        return glm::all(glm::lessThanEqual(Min, other.Min)) && glm::all(glm::greaterThanEqual(Max, other.Max));
+    }
+
+    bool AABB::Overlaps(const AABB& other) const {
+        return glm::all(glm::lessThanEqual(Min, other.Max)) && glm::all(glm::greaterThanEqual(Max, other.Min));
+    }
+
+    float AABB::Raycast(const glm::vec3& origin, const glm::vec3& inverseDirection, float maxDistance) const {
+        // Slab test, infinite components of inverseDirection are handled by the min/max below
+        glm::vec3 t0 = (Min - origin) * inverseDirection;
+        glm::vec3 t1 = (Max - origin) * inverseDirection;
+
+        glm::vec3 tMin = glm::min(t0, t1);
+        glm::vec3 tMax = glm::max(t0, t1);
+
+        float entry = std::max(std::max(tMin.x, tMin.y), std::max(tMin.z, 0.0f));
+        float exit  = std::min(std::min(tMax.x, tMax.y), std::min(tMax.z, maxDistance));
+
+        return entry <= exit ? entry : -1.0f;
+    }
+
+    AABB AABB::Expand(float margin) const {
+        return { Min - glm::vec3(margin), Max + glm::vec3(margin) };
+    }
+
+    AABB AABB::Merge(const AABB& lhs, const AABB& rhs) {
+        return { glm::min(lhs.Min, rhs.Min), glm::max(lhs.Max, rhs.Max) };
+    }
+
+    AABB AABB::Transform(const glm::mat4& transform) const {
+        glm::vec3 center  = transform * glm::vec4(GetCenter(), 1.0f);
+        glm::vec3 extents = GetExtents();
+
+        // Every axis of the transform adds its absolute projection of the extents
+        extents = glm::abs(glm::vec3(transform[0])) * extents.x
+                + glm::abs(glm::vec3(transform[1])) * extents.y
+                + glm::abs(glm::vec3(transform[2])) * extents.z;
+
+        return { center - extents, center + extents };
+    }
+
+    AABB AABB::FromQuad(const glm::mat4& transform) {
+        glm::vec3 center  = glm::vec3(transform[3]);
+        glm::vec3 extents = 0.5f * (glm::abs(glm::vec3(transform[0])) + glm::abs(glm::vec3(transform[1])));
+
+        return { center - extents, center + extents };
+    }
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,234 @@
+#include "AABBTree.hpp"
+
+namespace Ziben {
+
+    AABBTree::AABBTree()
+        : m_Root(NullNode)
+        , m_FreeList(NullNode)
+        , m_LeafCount(0) {}
+
+    int32_t AABBTree::GetHeight() const {
+        return m_Root == NullNode ? 0 : m_Nodes[m_Root].Height;
+    }
+
+    int32_t AABBTree::Insert(const AABB& bounds, uint32_t userData) {
+        int32_t leaf = AllocateNode();
+
+        m_Nodes[leaf].Bounds   = bounds.Expand(FatMargin);
+        m_Nodes[leaf].UserData = userData;
+        m_Nodes[leaf].Height   = 0;
+
+        InsertLeaf(leaf);
+        ++m_LeafCount;
+
+        return leaf;
+    }
+
+    void AABBTree::Remove(int32_t proxy) {
+        assert(proxy >= 0 && proxy < static_cast<int32_t>(m_Nodes.size()) && m_Nodes[proxy].IsLeaf());
+
+        RemoveLeaf(proxy);
+        FreeNode(proxy);
+        --m_LeafCount;
+    }
+
+    bool AABBTree::Move(int32_t proxy, const AABB& bounds) {
+        assert(proxy >= 0 && proxy < static_cast<int32_t>(m_Nodes.size()) && m_Nodes[proxy].IsLeaf());
+
+        if (m_Nodes[proxy].Bounds.Contains(bounds))
+            return false;
+
+        RemoveLeaf(proxy);
+        m_Nodes[proxy].Bounds = bounds.Expand(FatMargin);
+        InsertLeaf(proxy);
+
+        return true;
+    }
+
+    void AABBTree::Clear() {
+        m_Nodes.clear();
+
+        m_Root      = NullNode;
+        m_FreeList  = NullNode;
+        m_LeafCount = 0;
+    }
+
+    int32_t AABBTree::AllocateNode() {
+        if (m_FreeList == NullNode) {
+            m_Nodes.emplace_back();
+            return static_cast<int32_t>(m_Nodes.size() - 1);
+        }
+
+        int32_t index = m_FreeList;
+        m_FreeList    = m_Nodes[index].Parent;
+
+        m_Nodes[index] = Node();
+
+        return index;
+    }
+
+    void AABBTree::FreeNode(int32_t index) {
+        m_Nodes[index].Parent = m_FreeList;
+        m_Nodes[index].Height = -1;
+
+        m_FreeList = index;
+    }
+
+    void AABBTree::InsertLeaf(int32_t leaf) {
+        if (m_Root == NullNode) {
+            m_Root                = leaf;
+            m_Nodes[leaf].Parent = NullNode;
+            return;
+        }
+
+        // Descend towards the sibling with the lowest surface area cost
+        const AABB& bounds  = m_Nodes[leaf].Bounds;
+        int32_t     sibling = m_Root;
+
+        while (!m_Nodes[sibling].IsLeaf()) {
+            const auto& node = m_Nodes[sibling];
+
+            float area         = node.Bounds.GetSurfaceArea();
+            float combinedArea = AABB::Merge(node.Bounds, bounds).GetSurfaceArea();
+
+            // Cost of creating a new parent here and the minimum cost pushed down to the children
+            float cost        = 2.0f * combinedArea;
+            float inheritance = 2.0f * (combinedArea - area);
+
+            auto getChildCost = [&](int32_t child) {
+                const auto& childBounds = m_Nodes[child].Bounds;
+                float       mergedArea  = AABB::Merge(childBounds, bounds).GetSurfaceArea();
+
+                return m_Nodes[child].IsLeaf()
+                    ? mergedArea + inheritance
+                    : mergedArea - childBounds.GetSurfaceArea() + inheritance;
+            };
+
+            float leftCost  = getChildCost(node.Left);
+            float rightCost = getChildCost(node.Right);
+
+            if (cost < leftCost && cost < rightCost)
+                break;
+
+            sibling = leftCost < rightCost ? node.Left : node.Right;
+        }
+
+        int32_t oldParent = m_Nodes[sibling].Parent;
+        int32_t newParent = AllocateNode();
+
+        m_Nodes[newParent].Parent = oldParent;
+        m_Nodes[newParent].Bounds = AABB::Merge(m_Nodes[leaf].Bounds, m_Nodes[sibling].Bounds);
+        m_Nodes[newParent].Height = m_Nodes[sibling].Height + 1;
+        m_Nodes[newParent].Left   = sibling;
+        m_Nodes[newParent].Right  = leaf;
+
+        m_Nodes[sibling].Parent = newParent;
+        m_Nodes[leaf].Parent    = newParent;
+
+        if (oldParent == NullNode) {
+            m_Root = newParent;
+        } else if (m_Nodes[oldParent].Left == sibling) {
+            m_Nodes[oldParent].Left = newParent;
+        } else {
+            m_Nodes[oldParent].Right = newParent;
+        }
+
+        Refit(m_Nodes[leaf].Parent);
+    }
+
+    void AABBTree::RemoveLeaf(int32_t leaf) {
+        if (leaf == m_Root) {
+            m_Root = NullNode;
+            return;
+        }
+
+        int32_t parent      = m_Nodes[leaf].Parent;
+        int32_t grandParent = m_Nodes[parent].Parent;
+        int32_t sibling     = m_Nodes[parent].Left == leaf ? m_Nodes[parent].Right : m_Nodes[parent].Left;
+
+        // The sibling takes the place of the parent
+        if (grandParent == NullNode) {
+            m_Root                   = sibling;
+            m_Nodes[sibling].Parent = NullNode;
+        } else {
+            if (m_Nodes[grandParent].Left == parent) {
+                m_Nodes[grandParent].Left = sibling;
+            } else {
+                m_Nodes[grandParent].Right = sibling;
+            }
+
+            m_Nodes[sibling].Parent = grandParent;
+        }
+
+        FreeNode(parent);
+
+        if (grandParent != NullNode)
+            Refit(grandParent);
+    }
+
+    void AABBTree::Refit(int32_t index) {
+        while (index != NullNode) {
+            index = Balance(index);
+
+            auto& node = m_Nodes[index];
+
+            node.Bounds = AABB::Merge(m_Nodes[node.Left].Bounds, m_Nodes[node.Right].Bounds);
+            node.Height = 1 + std::max(m_Nodes[node.Left].Height, m_Nodes[node.Right].Height);
+
+            index = node.Parent;
+        }
+    }
+
+    int32_t AABBTree::Balance(int32_t a) {
+        // Rotates the higher grandchild of A up if the children heights differ by more than one,
+        // returns the index of the node that took the place of A
+        Node& nodeA = m_Nodes[a];
+
+        if (nodeA.IsLeaf() || nodeA.Height < 2)
+            return a;
+
+        int32_t b       = nodeA.Left;
+        int32_t c       = nodeA.Right;
+        int32_t balance = m_Nodes[c].Height - m_Nodes[b].Height;
+
+        if (balance > 1 || balance < -1) {
+            // Rotate the higher child (up) with its higher child staying below it
+            int32_t up    = balance > 1 ? c : b;
+            int32_t other = balance > 1 ? b : c;
+
+            Node&   nodeUp = m_Nodes[up];
+            int32_t f      = nodeUp.Left;
+            int32_t g      = nodeUp.Right;
+
+            nodeUp.Left   = a;
+            nodeUp.Parent = nodeA.Parent;
+            nodeA.Parent  = up;
+
+            if (nodeUp.Parent == NullNode) {
+                m_Root = up;
+            } else if (m_Nodes[nodeUp.Parent].Left == a) {
+                m_Nodes[nodeUp.Parent].Left = up;
+            } else {
+                m_Nodes[nodeUp.Parent].Right = up;
+            }
+
+            int32_t higher = m_Nodes[f].Height > m_Nodes[g].Height ? f : g;
+            int32_t lower  = higher == f ? g : f;
+
+            nodeUp.Right = higher;
+
+            nodeA.Left  = other;
+            nodeA.Right = lower;
+
+            m_Nodes[lower].Parent = a;
+
+            nodeA.Bounds = AABB::Merge(m_Nodes[other].Bounds, m_Nodes[lower].Bounds);
+            nodeA.Height = 1 + std::max(m_Nodes[other].Height, m_Nodes[lower].Height);
+
+            return up;
+        }
+
+        return a;
+    }
+
+} // namespace Ziben
\ No newline at end of file
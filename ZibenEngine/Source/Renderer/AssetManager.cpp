@@ -0,0 +1,551 @@
+#include "AssetManager.hpp"
+
+#include "ShaderReloader.hpp"
+#include "MeshGenerator.hpp"
+#include "MeshLoader.hpp"
+#include "MeshOptimizer.hpp"
+#include "MeshSimplifier.hpp"
+#include "TextureCompressor.hpp"
+
+namespace Ziben {
+
+    namespace Internal {
+
+        static inline std::string NormalizePath(const std::string& filepath) {
+            return std::filesystem::path(filepath).lexically_normal().generic_string();
+        }
+
+        static std::string ToHex(uint64_t value) {
+            std::array<char, 16> buffer = {};
+            std::string          result(buffer.size(), '0');
+
+            auto [end, error] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, 16);
+            auto length       = static_cast<std::size_t>(end - buffer.data());
+
+            std::copy(buffer.data(), end, result.begin() + static_cast<std::ptrdiff_t>(result.size() - length));
+
+            return result;
+        }
+
+        template <typename Key, typename T>
+        static uint32_t CountAlive(const std::unordered_map<Key, std::weak_ptr<T>>& assets) {
+            return static_cast<uint32_t>(std::count_if(assets.begin(), assets.end(), [](const auto& item) {
+                return !item.second.expired();
+            }));
+        }
+
+    } // namespace Internal
+
+    template <typename Key, typename T>
+    Ref<T> AssetManager::Find(const std::unordered_map<Key, std::weak_ptr<T>>& assets, const Key& key) {
+        auto it = assets.find(key);
+        return it != assets.end() ? it->second.lock() : nullptr;
+    }
+
+    Ref<Texture2D> AssetManager::LoadTexture(const std::string& filepath) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data = GetData();
+        auto  path = Internal::NormalizePath(filepath);
+
+        if (auto texture = Find(data.Textures.Paths, path)) {
+            ++data.PathHits;
+            return texture;
+        }
+
+        std::vector<uint8_t> fileData;
+
+        if (!ReadFile(filepath, fileData))
+            return nullptr;
+
+        Hash hash = HashData(fileData.data(), fileData.size());
+
+        // The same image under another path
+        if (auto texture = Find(data.Textures.Contents, hash)) {
+            ++data.ContentHits;
+            data.Textures.Paths[path] = texture;
+
+            return texture;
+        }
+
+        Ref<Texture2D> texture;
+
+        if (std::filesystem::path(filepath).extension() == ".ktx2") {
+            CompressedImage image;
+
+            if (!TextureCompressor::ReadKtx2(filepath, image))
+                return nullptr;
+
+            texture = Texture2D::Create(image);
+        } else {
+            std::vector<uint8_t> pixels;
+            uint32_t             width;
+            uint32_t             height;
+
+            if (!LoadPixels(hash, fileData, pixels, width, height)) {
+                ZIBEN_CORE_ERROR("AssetManager: can't decode {0}", filepath);
+                return nullptr;
+            }
+
+            texture = Texture2D::Create(width, height, TextureFormat::RGBA8, Texture2D::GetMipLevelCount(width, height));
+            texture->SetData(pixels.data(), static_cast<uint32_t>(pixels.size()));
+            texture->GenerateMipmaps();
+        }
+
+        data.Textures.Paths[path]    = texture;
+        data.Textures.Contents[hash] = texture;
+
+        return texture;
+    }
+
+    Ref<Texture2D> AssetManager::FindTexture(const std::string& filepath) {
+        auto& data    = GetData();
+        auto  texture = Find(data.Textures.Paths, Internal::NormalizePath(filepath));
+
+        if (texture)
+            ++data.PathHits;
+
+        return texture;
+    }
+
+    Ref<Texture2D> AssetManager::FindTexture(Hash hash) {
+        auto& data    = GetData();
+        auto  texture = Find(data.Textures.Contents, hash);
+
+        if (texture)
+            ++data.ContentHits;
+
+        return texture;
+    }
+
+    void AssetManager::RegisterTexture(const std::string& filepath, Hash hash, const Ref<Texture2D>& texture) {
+        auto& data = GetData();
+
+        data.Textures.Paths[Internal::NormalizePath(filepath)] = texture;
+        data.Textures.Contents[hash]                           = texture;
+    }
+
+    Ref<Shader> AssetManager::LoadShader(const std::string& filepath) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data = GetData();
+        auto  path = Internal::NormalizePath(filepath);
+
+        if (auto shader = Find(data.Shaders, path)) {
+            ++data.PathHits;
+            return shader;
+        }
+
+        auto shader = Shader::Create(filepath);
+
+        ShaderReloader::Watch(shader);
+
+        data.Shaders[path] = shader;
+
+        return shader;
+    }
+
+    Ref<Mesh> AssetManager::LoadMesh(const std::string& filepath) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data = GetData();
+        auto  path = Internal::NormalizePath(filepath);
+
+        if (auto it = data.Meshes.find(path); it != data.Meshes.end()) {
+            ++data.PathHits;
+            return it->second;
+        }
+
+        MeshData meshData;
+
+        if (path == CubeMeshPath) {
+            meshData = MeshGenerator::CreateCube();
+        } else if (path == PlaneMeshPath) {
+            meshData = MeshGenerator::CreatePlane(1.0f, 8);
+        } else if (path == SphereMeshPath) {
+            meshData = MeshGenerator::CreateSphere();
+        } else if (path == TorusMeshPath) {
+            meshData = MeshGenerator::CreateTorus(0.35f, 0.15f, 32, 64);
+        } else {
+            std::vector<uint8_t> fileData;
+
+            if (!ReadFile(filepath, fileData))
+                return nullptr;
+
+            if (!LoadMeshData(HashData(fileData.data(), fileData.size()), fileData, filepath, meshData))
+                return nullptr;
+        }
+
+        // Generated meshes are cheap to process, the loaded ones come optimized and simplified from the cache
+        if (path.starts_with("Primitives/")) {
+            auto statistics = MeshOptimizer::Optimize(meshData);
+            ZIBEN_CORE_INFO("AssetManager: {0} ACMR {1:.3f} -> {2:.3f}", path, statistics.AcmrBefore, statistics.AcmrAfter);
+
+            MeshSimplifier::GenerateLods(meshData);
+        }
+
+        auto mesh = Mesh::Create(meshData);
+
+        data.Meshes[path] = mesh;
+
+        return mesh;
+    }
+
+    bool AssetManager::LoadPixels(const std::string& filepath, std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height) {
+        Hash hash;
+        return LoadPixels(filepath, pixels, width, height, hash);
+    }
+
+    bool AssetManager::LoadPixels(const std::string& filepath, std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height, Hash& hash) {
+        std::vector<uint8_t> fileData;
+
+        if (!ReadFile(filepath, fileData))
+            return false;
+
+        hash = HashData(fileData.data(), fileData.size());
+
+        return LoadPixels(hash, fileData, pixels, width, height);
+    }
+
+    AssetManager::Hash AssetManager::HashData(const void* data, std::size_t size) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        // FNV-1a over 8 byte words, the rotation carries the high bits down and the
+        // MurmurHash3 finalizer spreads the last words over the whole hash
+        constexpr Hash prime = 0x100000001b3;
+
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        Hash        hash  = 0xcbf29ce484222325;
+        std::size_t i     = 0;
+
+        for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, bytes + i, sizeof(word));
+
+            hash = std::rotl((hash ^ word) * prime, 31);
+        }
+
+        for (; i < size; ++i)
+            hash = (hash ^ bytes[i]) * prime;
+
+        hash ^= size;
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccd;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53;
+        hash ^= hash >> 33;
+
+        return hash;
+    }
+
+    bool AssetManager::HashFile(const std::string& filepath, Hash& hash) {
+        std::vector<uint8_t> fileData;
+
+        if (!ReadFile(filepath, fileData))
+            return false;
+
+        hash = HashData(fileData.data(), fileData.size());
+
+        return true;
+    }
+
+    std::string AssetManager::GetCachePath(Hash hash, std::string_view extension) {
+        std::string cachePath(s_CacheDirectory);
+
+        cachePath += '/';
+        cachePath += Internal::ToHex(hash);
+        cachePath += '.';
+        cachePath += extension;
+
+        return cachePath;
+    }
+
+    bool AssetManager::WriteCache(const std::string& cachePath, const std::function<bool(const std::string&)>& write) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(cachePath).parent_path(), error);
+
+        // Threads writing the same entry don't share the temporary file
+        std::string temporaryPath = cachePath + ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+        if (!write(temporaryPath)) {
+            std::filesystem::remove(temporaryPath, error);
+            return false;
+        }
+
+        std::filesystem::rename(temporaryPath, cachePath, error);
+
+        if (error) {
+            std::filesystem::remove(temporaryPath, error);
+            return false;
+        }
+
+        return true;
+    }
+
+    void AssetManager::CollectGarbage() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data    = GetData();
+        auto  isFreed = [](const auto& item) { return item.second.expired(); };
+
+        std::erase_if(data.Textures.Paths,    isFreed);
+        std::erase_if(data.Textures.Contents, isFreed);
+        std::erase_if(data.Shaders,           isFreed);
+    }
+
+    AssetManager::Statistics AssetManager::GetStatistics() {
+        auto&      data = GetData();
+        Statistics statistics;
+
+        statistics.TextureCount      = Internal::CountAlive(data.Textures.Contents);
+        statistics.ShaderCount       = Internal::CountAlive(data.Shaders);
+        statistics.MeshCount         = static_cast<uint32_t>(data.Meshes.size());
+        statistics.PathHits          = data.PathHits;
+        statistics.ContentHits       = data.ContentHits;
+        statistics.DecodeCacheHits   = data.DecodeCacheHits;
+        statistics.DecodeCacheMisses = data.DecodeCacheMisses;
+
+        return statistics;
+    }
+
+    AssetManager::Data& AssetManager::GetData() {
+        static Data data;
+        return data;
+    }
+
+    bool AssetManager::ReadFile(const std::string& filepath, std::vector<uint8_t>& data) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        std::ifstream inputStream(filepath, std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+
+        if (!inputStream) {
+            ZIBEN_CORE_ERROR("AssetManager: can't open the file by provided path: {0}", filepath);
+            return false;
+        }
+
+        data.resize(static_cast<std::size_t>(inputStream.tellg()));
+
+        inputStream.seekg(0);
+        inputStream.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+        return static_cast<bool>(inputStream);
+    }
+
+    bool AssetManager::LoadPixels(
+        Hash                        hash,
+        const std::vector<uint8_t>& fileData,
+        std::vector<uint8_t>&       pixels,
+        uint32_t&                   width,
+        uint32_t&                   height
+    ) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data      = GetData();
+        auto  cachePath = GetCachePath(hash, "rgba");
+
+        // Magic, version, width, height and the pixels as they are
+        std::array<uint32_t, 4> header = {};
+
+        if (std::ifstream inputStream(cachePath, std::ios_base::in | std::ios_base::binary | std::ios_base::ate); inputStream) {
+            auto fileSize = static_cast<uint64_t>(inputStream.tellg());
+
+            inputStream.seekg(0);
+            inputStream.read(reinterpret_cast<char*>(header.data()), sizeof(header));
+
+            // A truncated or corrupted entry is a miss, the size is checked before anything is allocated
+            bool isValid = inputStream
+                && header[0] == s_PixelCacheMagic
+                && header[1] == s_PixelCacheVersion
+                && header[2] > 0
+                && header[3] > 0
+                && fileSize == sizeof(header) + static_cast<uint64_t>(header[2]) * header[3] * 4;
+
+            if (isValid) {
+                width  = header[2];
+                height = header[3];
+
+                pixels.resize(static_cast<std::size_t>(width) * height * 4);
+                inputStream.read(reinterpret_cast<char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+
+                if (inputStream) {
+                    ++data.DecodeCacheHits;
+                    return true;
+                }
+            }
+        }
+
+        ++data.DecodeCacheMisses;
+
+        if (!Texture2D::DecodePixels(fileData.data(), fileData.size(), pixels, width, height))
+            return false;
+
+        header = { s_PixelCacheMagic, s_PixelCacheVersion, width, height };
+
+        WriteCache(cachePath, [&](const std::string& filepath) {
+            std::ofstream outputStream(filepath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+            outputStream.write(reinterpret_cast<const char*>(header.data()), sizeof(header));
+            outputStream.write(reinterpret_cast<const char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+
+            return outputStream.good();
+        });
+
+        return true;
+    }
+
+    bool AssetManager::LoadMeshData(Hash hash, const std::vector<uint8_t>& fileData, const std::string& filepath, MeshData& meshData) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data      = GetData();
+        auto  cachePath = GetCachePath(hash, "mesh");
+
+        // Magic, version, vertex count, index count, index size and level count, then the vertices and the indices
+        // as they are. Every level follows with its index count, its error and its indices
+        std::array<uint32_t, 6> header = {};
+
+        auto readIndices = [](std::ifstream& inputStream, std::vector<IndexType>& indices, bool isShort) {
+            if (isShort) {
+                std::vector<uint16_t> shortIndices(indices.size());
+
+                inputStream.read(reinterpret_cast<char*>(shortIndices.data()), static_cast<std::streamsize>(shortIndices.size() * sizeof(uint16_t)));
+                std::copy(shortIndices.begin(), shortIndices.end(), indices.begin());
+            } else {
+                inputStream.read(reinterpret_cast<char*>(indices.data()), static_cast<std::streamsize>(indices.size() * sizeof(IndexType)));
+            }
+        };
+
+        auto writeIndices = [](std::ofstream& outputStream, const std::vector<IndexType>& indices, bool isShort) {
+            if (isShort) {
+                std::vector<uint16_t> shortIndices(indices.begin(), indices.end());
+                outputStream.write(reinterpret_cast<const char*>(shortIndices.data()), static_cast<std::streamsize>(shortIndices.size() * sizeof(uint16_t)));
+            } else {
+                outputStream.write(reinterpret_cast<const char*>(indices.data()), static_cast<std::streamsize>(indices.size() * sizeof(IndexType)));
+            }
+        };
+
+        // Every index of the entry has to point at one of its vertices
+        auto areIndicesValid = [](const std::vector<IndexType>& indices, std::size_t vertexCount) {
+            return std::all_of(indices.begin(), indices.end(), [vertexCount](IndexType index) { return index < vertexCount; });
+        };
+
+        if (std::ifstream inputStream(cachePath, std::ios_base::in | std::ios_base::binary | std::ios_base::ate); inputStream) {
+            auto fileSize = static_cast<uint64_t>(inputStream.tellg());
+
+            inputStream.seekg(0);
+            inputStream.read(reinterpret_cast<char*>(header.data()), sizeof(header));
+
+            bool     isShort   = header[4] == sizeof(uint16_t);
+            uint64_t indexSize = header[4];
+
+            // The counts are checked against the file size before anything is allocated, every level takes at least its count and error
+            bool isValid = inputStream
+                && header[0] == s_MeshCacheMagic
+                && header[1] == s_MeshCacheVersion
+                && (indexSize == sizeof(uint16_t) || indexSize == sizeof(IndexType))
+                && header[2] > 0
+                && header[3] > 0
+                && header[3] % 3 == 0
+                && fileSize >= sizeof(header)
+                    + static_cast<uint64_t>(header[2]) * sizeof(MeshQueue::Vertex)
+                    + static_cast<uint64_t>(header[3]) * indexSize
+                    + static_cast<uint64_t>(header[5]) * (sizeof(uint32_t) + sizeof(MeshLodData::Error));
+
+            if (isValid) {
+                meshData.Vertices.resize(header[2]);
+                meshData.Indices.resize(header[3]);
+                meshData.Lods.resize(header[5]);
+
+                inputStream.read(reinterpret_cast<char*>(meshData.Vertices.data()), static_cast<std::streamsize>(meshData.Vertices.size() * sizeof(MeshQueue::Vertex)));
+                readIndices(inputStream, meshData.Indices, isShort);
+
+                for (auto& lod : meshData.Lods) {
+                    uint32_t indexCount = 0;
+
+                    inputStream.read(reinterpret_cast<char*>(&indexCount), sizeof(indexCount));
+                    inputStream.read(reinterpret_cast<char*>(&lod.Error), sizeof(lod.Error));
+
+                    // A level is never larger than the full detail mesh, anything else is a broken entry
+                    if (indexCount > meshData.Indices.size())
+                        inputStream.setstate(std::ios_base::failbit);
+
+                    if (!inputStream)
+                        break;
+
+                    lod.Indices.resize(indexCount);
+                    readIndices(inputStream, lod.Indices, isShort);
+
+                    if (!areIndicesValid(lod.Indices, meshData.Vertices.size()))
+                        inputStream.setstate(std::ios_base::failbit);
+                }
+
+                // Nothing may follow the last level
+                bool isComplete = inputStream
+                    && static_cast<uint64_t>(inputStream.tellg()) == fileSize
+                    && areIndicesValid(meshData.Indices, meshData.Vertices.size());
+
+                if (isComplete) {
+                    ++data.DecodeCacheHits;
+                    return true;
+                }
+
+                meshData = {};
+            }
+        }
+
+        ++data.DecodeCacheMisses;
+
+        std::string_view source(reinterpret_cast<const char*>(fileData.data()), fileData.size());
+
+        if (!MeshLoader::ParseObj(source, filepath, meshData))
+            return false;
+
+        auto statistics = MeshOptimizer::Optimize(meshData);
+
+        MeshSimplifier::GenerateLods(meshData);
+
+        ZIBEN_CORE_INFO(
+            "AssetManager: {0} {1} vertices, {2} triangles, {3} levels of detail, ACMR {4:.3f} -> {5:.3f}",
+            filepath,
+            meshData.Vertices.size(),
+            meshData.Indices.size() / 3,
+            meshData.Lods.size(),
+            statistics.AcmrBefore,
+            statistics.AcmrAfter
+        );
+
+        // The queue draws every mesh with 32 bit indices, the cache entry is stored with 16 bit ones where they fit
+        bool isShort = MeshOptimizer::CanUseShortIndices(meshData.Vertices.size());
+
+        header = {
+            s_MeshCacheMagic,
+            s_MeshCacheVersion,
+            static_cast<uint32_t>(meshData.Vertices.size()),
+            static_cast<uint32_t>(meshData.Indices.size()),
+            static_cast<uint32_t>(isShort ? sizeof(uint16_t) : sizeof(IndexType)),
+            static_cast<uint32_t>(meshData.Lods.size())
+        };
+
+        WriteCache(cachePath, [&](const std::string& path) {
+            std::ofstream outputStream(path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+            outputStream.write(reinterpret_cast<const char*>(header.data()), sizeof(header));
+            outputStream.write(reinterpret_cast<const char*>(meshData.Vertices.data()), static_cast<std::streamsize>(meshData.Vertices.size() * sizeof(MeshQueue::Vertex)));
+            writeIndices(outputStream, meshData.Indices, isShort);
+
+            for (const auto& lod : meshData.Lods) {
+                auto indexCount = static_cast<uint32_t>(lod.Indices.size());
+
+                outputStream.write(reinterpret_cast<const char*>(&indexCount), sizeof(indexCount));
+                outputStream.write(reinterpret_cast<const char*>(&lod.Error), sizeof(lod.Error));
+                writeIndices(outputStream, lod.Indices, isShort);
+            }
+
+            return outputStream.good();
+        });
+
+        return true;
+    }
+
+} // namespace Ziben
\ No newline at end of file
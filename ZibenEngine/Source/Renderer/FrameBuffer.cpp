@@ -1,5 +1,7 @@
 #include "FrameBuffer.hpp"
 
+#include "RenderState.hpp"
+
 namespace Ziben {
 
     namespace Internal {
@@ -21,8 +23,9 @@ namespace Ziben {
             glCreateTextures(TextureTarget(isMultiSampled), static_cast<GLsizei>(count), handles);
         }
 
-        static inline void BindTexture(bool isMultiSampled, HandleType handle) {
-            glBindTexture(TextureTarget(isMultiSampled), handle);
+        // The attachments are set up through the texture bound to the unit 0
+        static inline void BindTexture(HandleType handle) {
+            RenderState::BindTextureUnit(0, handle);
         }
 
         static void AttachColorTexture(
@@ -147,8 +150,8 @@ namespace Ziben {
     }
 
     void FrameBuffer::Bind(const Ref<FrameBuffer>& frameBuffer) {
-        glBindFramebuffer(GL_FRAMEBUFFER, frameBuffer->m_Handle);
-        glViewport(
+        RenderState::BindFrameBuffer(frameBuffer->m_Handle);
+        RenderState::SetViewport(
             0,
             0,
             static_cast<GLsizei>(frameBuffer->m_Specification.Width),
@@ -157,12 +160,20 @@ namespace Ziben {
     }
 
     void FrameBuffer::Unbind() {
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        RenderState::BindFrameBuffer(0);
+    }
+
+    uint32_t FrameBuffer::GetBucketSize(uint32_t size) {
+        uint32_t step = std::max(std::bit_floor(size) / 4, s_MinBucketStep);
+
+        return std::min((size + step - 1) / step * step, s_MaxFrameBufferSize);
     }
 
     FrameBuffer::FrameBuffer(FrameBufferSpecification&& specification)
         : m_Handle(0)
         , m_Specification(specification)
+        , m_AllocatedWidth(GetBucketSize(m_Specification.Width))
+        , m_AllocatedHeight(GetBucketSize(m_Specification.Height))
         , m_DepthAttachment(0) {
 
         for (auto textureSpecification : m_Specification.Attachments.Attachments) {
@@ -189,7 +200,7 @@ namespace Ziben {
             Clear();
 
         glCreateFramebuffers(1, &m_Handle);
-        glBindFramebuffer(GL_FRAMEBUFFER, m_Handle);
+        RenderState::BindFrameBuffer(m_Handle);
 
         bool isMultiSampled = m_Specification.Samples > 1;
 
@@ -200,7 +211,7 @@ namespace Ziben {
             Internal::CreateTextures(isMultiSampled, m_ColorAttachments.data(), m_ColorAttachments.size());
 
             for (std::size_t i = 0; i < m_ColorAttachments.size(); ++i) {
-                Internal::BindTexture(isMultiSampled, m_ColorAttachments[i]);
+                Internal::BindTexture(m_ColorAttachments[i]);
 
                 switch (m_ColorAttachmentSpecification[i].TextureFormat) {
                     case FrameBufferTextureFormat::RGBA8: {
@@ -209,8 +220,8 @@ namespace Ziben {
                             m_Specification.Samples,
                             GL_RGBA8,
                             GL_RGBA,
-                            m_Specification.Width,
-                            m_Specification.Height,
+                            m_AllocatedWidth,
+                            m_AllocatedHeight,
                             i
                         );
 
@@ -223,8 +234,8 @@ namespace Ziben {
                             m_Specification.Samples,
                             GL_R32I,
                             GL_RED_INTEGER,
-                            m_Specification.Width,
-                            m_Specification.Height,
+                            m_AllocatedWidth,
+                            m_AllocatedHeight,
                             i
                         );
 
@@ -238,7 +249,7 @@ namespace Ziben {
 
         if (m_DepthAttachmentSpecification.TextureFormat != FrameBufferTextureFormat::None) {
             Internal::CreateTextures(isMultiSampled, &m_DepthAttachment, 1);
-            Internal::BindTexture(isMultiSampled, m_DepthAttachment);
+            Internal::BindTexture(m_DepthAttachment);
 
             switch (m_DepthAttachmentSpecification.TextureFormat) {
                 case FrameBufferTextureFormat::Depth24Stencil8: {
@@ -247,8 +258,8 @@ namespace Ziben {
                         m_Specification.Samples,
                         GL_DEPTH24_STENCIL8,
                         GL_DEPTH_STENCIL_ATTACHMENT,
-                        m_Specification.Width,
-                        m_Specification.Height
+                        m_AllocatedWidth,
+                        m_AllocatedHeight
                     );
 
                     break;
@@ -276,7 +287,7 @@ namespace Ziben {
 
         assert(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
 
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        RenderState::BindFrameBuffer(0);
     }
 
     void FrameBuffer::Resize(uint32_t width, uint32_t height) {
@@ -288,6 +299,13 @@ namespace Ziben {
         m_Specification.Width = width;
         m_Specification.Height = height;
 
+        // Dragging a dock splitter resizes every frame, the attachments are kept while the size stays in the bucket
+        if (GetBucketSize(width) == m_AllocatedWidth && GetBucketSize(height) == m_AllocatedHeight)
+            return;
+
+        m_AllocatedWidth  = GetBucketSize(width);
+        m_AllocatedHeight = GetBucketSize(height);
+
         Invalidate();
     }
 
@@ -318,16 +336,21 @@ namespace Ziben {
 
     void FrameBuffer::Clear() {
         if (m_Handle) {
+            RenderState::OnFrameBufferDeleted(m_Handle);
             glDeleteFramebuffers(1, &m_Handle);
             m_Handle = 0;
         }
 
         if (!m_ColorAttachments.empty()) {
+            for (HandleType colorAttachment : m_ColorAttachments)
+                RenderState::OnTextureDeleted(colorAttachment);
+
             glDeleteTextures(static_cast<GLsizei>(m_ColorAttachments.size()), m_ColorAttachments.data());
             m_ColorAttachments.clear();
         }
 
         if (m_DepthAttachment) {
+            RenderState::OnTextureDeleted(m_DepthAttachment);
             glDeleteTextures(1, &m_DepthAttachment);
             m_DepthAttachment = 0;
         }
@@ -0,0 +1,76 @@
+#include "Frustum.hpp"
+
+namespace Ziben {
+
+    namespace Internal {
+
+        // Maps the [min, max] rectangle of the clip space to the whole [-1, 1] range
+        static glm::mat4 RemapRect(const glm::vec2& min, const glm::vec2& max) {
+            glm::vec2 size = glm::max(max - min, glm::vec2(1e-6f));
+            glm::mat4 remap(1.0f);
+
+            remap[0][0] = 2.0f / size.x;
+            remap[1][1] = 2.0f / size.y;
+            remap[3][0] = -(max.x + min.x) / size.x;
+            remap[3][1] = -(max.y + min.y) / size.y;
+
+            return remap;
+        }
+
+    } // namespace Internal
+
+    Frustum::Frustum()
+        : Frustum(glm::mat4(1.0f)) {}
+
+    Frustum::Frustum(const glm::mat4& viewProjection) {
+        // Gribb-Hartmann: planes are combinations of the matrix rows
+        auto row = [&](int index) {
+            return glm::vec4(viewProjection[0][index], viewProjection[1][index], viewProjection[2][index], viewProjection[3][index]);
+        };
+
+        m_Planes[0] = row(3) + row(0);
+        m_Planes[1] = row(3) - row(0);
+        m_Planes[2] = row(3) + row(1);
+        m_Planes[3] = row(3) - row(1);
+        m_Planes[4] = row(3) + row(2);
+        m_Planes[5] = row(3) - row(2);
+    }
+
+    Frustum::Frustum(const glm::mat4& viewProjection, const glm::vec2& ndcMin, const glm::vec2& ndcMax)
+        : Frustum(Internal::RemapRect(ndcMin, ndcMax) * viewProjection) {}
+
+    bool Frustum::Intersects(const glm::vec3& center, const glm::vec3& extents) const {
+        for (const auto& plane : m_Planes) {
+            float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+            float radius   = std::abs(plane.x) * extents.x + std::abs(plane.y) * extents.y + std::abs(plane.z) * extents.z;
+
+            if (distance + radius < 0.0f)
+                return false;
+        }
+
+        return true;
+    }
+
+    uint32_t Frustum::Cull(const AABBBatch& batch, std::size_t count, uint8_t* isVisible) const {
+        assert(count <= AABBBatch::Capacity);
+
+        std::fill_n(isVisible, count, static_cast<uint8_t>(1));
+
+        // Plane by plane over the whole batch, the inner loop has no branches
+        for (const auto& plane : m_Planes) {
+            float absX = std::abs(plane.x);
+            float absY = std::abs(plane.y);
+            float absZ = std::abs(plane.z);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                float distance = plane.x * batch.CenterX[i] + plane.y * batch.CenterY[i] + plane.z * batch.CenterZ[i] + plane.w;
+                float radius   = absX * batch.ExtentX[i] + absY * batch.ExtentY[i] + absZ * batch.ExtentZ[i];
+
+                isVisible[i] &= static_cast<uint8_t>(distance + radius >= 0.0f);
+            }
+        }
+
+        return static_cast<uint32_t>(std::count(isVisible, isVisible + count, static_cast<uint8_t>(1)));
+    }
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "GpuBuffer.hpp"
+
+#include "RenderState.hpp"
+
+namespace Ziben {
+
+    Ref<GpuBuffer> GpuBuffer::Create(std::size_t size, BufferStorage storage) {
+        return CreateRef<GpuBuffer>(nullptr, size, storage);
+    }
+
+    Ref<GpuBuffer> GpuBuffer::Create(const void* data, std::size_t size, BufferStorage storage) {
+        return CreateRef<GpuBuffer>(data, size, storage);
+    }
+
+    void GpuBuffer::Bind(const Ref<GpuBuffer>& buffer, GLenum target) {
+        RenderState::BindBuffer(target, buffer->m_Handle);
+    }
+
+    void GpuBuffer::Unbind(GLenum target) {
+        RenderState::BindBuffer(target, 0);
+    }
+
+    GpuBuffer::GpuBuffer(const void* data, std::size_t size, BufferStorage storage, BufferUsage usage)
+        : m_Handle(0)
+        , m_Size(size)
+        , m_Storage(storage)
+        , m_Usage(usage)
+        , m_MappedData(nullptr) {
+
+        ZIBEN_PROFILE_FUNCTION();
+
+        glCreateBuffers(1, &m_Handle);
+
+        switch (m_Storage) {
+            case BufferStorage::Mutable: {
+                glNamedBufferData(m_Handle, static_cast<GLsizeiptr>(m_Size), data, static_cast<GLenum>(m_Usage));
+                break;
+            }
+
+            case BufferStorage::Immutable: {
+                glNamedBufferStorage(m_Handle, static_cast<GLsizeiptr>(m_Size), data, GL_DYNAMIC_STORAGE_BIT);
+                break;
+            }
+
+            case BufferStorage::Persistent: {
+                constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+                glNamedBufferStorage(m_Handle, static_cast<GLsizeiptr>(m_Size), data, flags);
+                m_MappedData = static_cast<uint8_t*>(glMapNamedBufferRange(m_Handle, 0, static_cast<GLsizeiptr>(m_Size), flags));
+
+                assert(m_MappedData);
+
+                break;
+            }
+        }
+    }
+
+    GpuBuffer::~GpuBuffer() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        if (m_MappedData)
+            glUnmapNamedBuffer(m_Handle);
+
+        RenderState::OnBufferDeleted(m_Handle);
+        glDeleteBuffers(1, &m_Handle);
+    }
+
+    void GpuBuffer::SetData(const void* data, std::size_t size, std::size_t offset) const {
+        assert(offset + size <= m_Size);
+
+        if (m_MappedData) {
+            std::memcpy(m_MappedData + offset, data, size);
+            return;
+        }
+
+        glNamedBufferSubData(m_Handle, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+    }
+
+} // namespace Ziben
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "IndexBuffer.hpp"
 
+#include "RenderState.hpp"
+
 namespace Ziben {
 
     Ref<IndexBuffer> IndexBuffer::Create(const IndexType* indices, std::size_t count, BufferUsage usage) {
@@ -9,36 +11,21 @@ namespace Ziben {
     void IndexBuffer::Bind(const Ref<IndexBuffer>& indexBuffer) {
         ZIBEN_PROFILE_FUNCTION();
 
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer->m_Handle);
+        RenderState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer->GetHandle());
     }
 
     void IndexBuffer::Unbind() {
         ZIBEN_PROFILE_FUNCTION();
 
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        RenderState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
 
     IndexBuffer::IndexBuffer(const IndexType* indices, std::size_t count, BufferUsage usage)
-        : m_Handle(0)
-        , m_Count(count)
-        , m_Usage(usage) {
-
-        ZIBEN_PROFILE_FUNCTION();
-
-        glGenBuffers(1, &m_Handle);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_Handle);
-        glBufferData(
-            GL_ELEMENT_ARRAY_BUFFER,
-            static_cast<GLsizeiptr>(count * sizeof(IndexType)),
-            indices,
-            static_cast<GLenum>(usage)
-        );
-    }
-
-    IndexBuffer::~IndexBuffer() {
-        ZIBEN_PROFILE_FUNCTION();
+        : m_Buffer(indices, count * sizeof(IndexType), BufferStorage::Immutable, usage)
+        , m_Count(count) {}
 
-        glDeleteBuffers(1, &m_Handle);
+    void IndexBuffer::SetData(const IndexType* indices, std::size_t count, std::size_t offset) const {
+        m_Buffer.SetData(indices, count * sizeof(IndexType), offset * sizeof(IndexType));
     }
 
 } // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include "Mesh.hpp"
+
+namespace Ziben {
+
+    Ref<Mesh> Mesh::Create(const MeshData& data) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        AABB bounds = { glm::vec3(std::numeric_limits<float>::max()), glm::vec3(std::numeric_limits<float>::lowest()) };
+
+        for (const auto& vertex : data.Vertices) {
+            bounds.Min = glm::min(bounds.Min, vertex.Position);
+            bounds.Max = glm::max(bounds.Max, vertex.Position);
+        }
+
+        if (data.Vertices.empty())
+            bounds = {};
+
+        std::vector<Lod> lods;
+        lods.reserve(data.Lods.size() + 1);
+
+        MeshQueue::MeshId id = MeshQueue::AddMesh(data.Vertices, data.Indices);
+
+        lods.push_back({ id, static_cast<uint32_t>(data.Indices.size()) });
+
+        // The error is relative to the bounds radius and the screen size covers the diameter
+        for (const auto& lod : data.Lods) {
+            float screenSize = lod.Error > 0.0f ? 2.0f * MaxScreenError / lod.Error : std::numeric_limits<float>::max();
+
+            lods.push_back({ MeshQueue::AddMesh(id, lod.Indices), static_cast<uint32_t>(lod.Indices.size()), screenSize });
+        }
+
+        return CreateRef<Mesh>(std::move(lods), static_cast<uint32_t>(data.Vertices.size()), bounds);
+    }
+
+    float Mesh::GetScreenSize(const glm::mat4& viewProjectionMatrix, const glm::vec3& center, float radius) {
+        // The fourth row gives the clip w, the view depth for a perspective projection and 1 for an orthographic one.
+        // The length of the second row is the vertical scale of the projection
+        float w     = viewProjectionMatrix[0][3] * center.x + viewProjectionMatrix[1][3] * center.y + viewProjectionMatrix[2][3] * center.z + viewProjectionMatrix[3][3];
+        float scale = glm::length(glm::vec3(viewProjectionMatrix[0][1], viewProjectionMatrix[1][1], viewProjectionMatrix[2][1]));
+
+        // The camera is inside or behind the sphere
+        if (w <= std::numeric_limits<float>::epsilon())
+            return std::numeric_limits<float>::max();
+
+        return radius * scale / w;
+    }
+
+    Mesh::Mesh(std::vector<Lod> lods, uint32_t vertexCount, const AABB& bounds)
+        : m_Lods(std::move(lods))
+        , m_VertexCount(vertexCount)
+        , m_Bounds(bounds) {}
+
+    uint32_t Mesh::SelectLod(float screenSize, uint32_t currentLod) const {
+        auto     lodCount = static_cast<uint32_t>(m_Lods.size());
+        uint32_t lod      = 0;
+
+        currentLod = std::min(currentLod, lodCount - 1);
+
+        while (lod + 1 < lodCount && screenSize < m_Lods[lod + 1].ScreenSize)
+            ++lod;
+
+        // A coarser level is taken once the size is well below its threshold,
+        // a finer one once the size is well above the threshold of the level after it
+        while (lod > currentLod && screenSize >= m_Lods[lod].ScreenSize * (1.0f - LodHysteresis))
+            --lod;
+
+        while (lod < currentLod && screenSize <= m_Lods[lod + 1].ScreenSize * (1.0f + LodHysteresis))
+            ++lod;
+
+        return lod;
+    }
+
+} // namespace Ziben
\ No newline at end of file
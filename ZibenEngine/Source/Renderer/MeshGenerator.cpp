@@ -0,0 +1,158 @@
+#include "MeshGenerator.hpp"
+
+#include <glm/gtc/constants.hpp>
+
+namespace Ziben {
+
+    namespace Internal {
+
+        // Cosines and sines of count + 1 steps around the circle, the last one closes the seam
+        static std::vector<glm::vec2> GetCircle(uint32_t count) {
+            std::vector<glm::vec2> circle(count + 1);
+
+            for (uint32_t i = 0; i <= count; ++i) {
+                float angle = glm::two_pi<float>() * static_cast<float>(i) / static_cast<float>(count);
+                circle[i]   = glm::vec2(std::cos(angle), std::sin(angle));
+            }
+
+            return circle;
+        }
+
+        // Two triangles per cell of a grid with rowSize vertices per row
+        static void PushQuad(std::vector<IndexType>& indices, IndexType current, IndexType rowSize) {
+            IndexType next = current + rowSize;
+
+            indices.insert(indices.end(), { current, next, next + 1, current, next + 1, current + 1 });
+        }
+
+    } // namespace Internal
+
+    MeshData MeshGenerator::CreateCube(float size) {
+        struct Face {
+            glm::vec3 Normal;
+            glm::vec3 U;
+            glm::vec3 V;
+        };
+
+        // U x V = Normal, so the quads are counter clockwise seen from outside
+        static const std::array<Face, 6> faces = {{
+            { glm::vec3( 1.0f,  0.0f,  0.0f), glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f) },
+            { glm::vec3(-1.0f,  0.0f,  0.0f), glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 1.0f, 0.0f) },
+            { glm::vec3( 0.0f,  1.0f,  0.0f), glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(1.0f, 0.0f, 0.0f) },
+            { glm::vec3( 0.0f, -1.0f,  0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f) },
+            { glm::vec3( 0.0f,  0.0f,  1.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f) },
+            { glm::vec3( 0.0f,  0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f) }
+        }};
+
+        static const std::array<glm::vec2, 4> corners = {{
+            { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f }
+        }};
+
+        MeshData data;
+
+        data.Vertices.reserve(faces.size() * 4);
+        data.Indices.reserve(faces.size() * 6);
+
+        for (const auto& face : faces) {
+            auto first = static_cast<IndexType>(data.Vertices.size());
+
+            for (const auto& corner : corners)
+                data.Vertices.push_back({ size * (0.5f * face.Normal + (corner.x - 0.5f) * face.U + (corner.y - 0.5f) * face.V), face.Normal, corner });
+
+            data.Indices.insert(data.Indices.end(), { first, first + 1, first + 2, first, first + 2, first + 3 });
+        }
+
+        return data;
+    }
+
+    MeshData MeshGenerator::CreatePlane(float size, uint32_t subdivisionCount) {
+        MeshData data;
+        uint32_t rowSize = subdivisionCount + 1;
+
+        data.Vertices.reserve(static_cast<std::size_t>(rowSize) * rowSize);
+        data.Indices.reserve(static_cast<std::size_t>(subdivisionCount) * subdivisionCount * 6);
+
+        for (uint32_t z = 0; z <= subdivisionCount; ++z) {
+            for (uint32_t x = 0; x <= subdivisionCount; ++x) {
+                glm::vec2 texCoord = glm::vec2(static_cast<float>(x), static_cast<float>(z)) / static_cast<float>(subdivisionCount);
+
+                data.Vertices.push_back({ size * glm::vec3(texCoord.x - 0.5f, 0.0f, texCoord.y - 0.5f), glm::vec3(0.0f, 1.0f, 0.0f), texCoord });
+            }
+        }
+
+        for (uint32_t z = 0; z < subdivisionCount; ++z)
+            for (uint32_t x = 0; x < subdivisionCount; ++x)
+                Internal::PushQuad(data.Indices, z * rowSize + x, rowSize);
+
+        return data;
+    }
+
+    MeshData MeshGenerator::CreateSphere(float radius, uint32_t sectorCount, uint32_t stackCount) {
+        MeshData data;
+        uint32_t rowSize = sectorCount + 1;
+        auto     sectors = Internal::GetCircle(sectorCount);
+
+        data.Vertices.reserve(static_cast<std::size_t>(stackCount + 1) * rowSize);
+        data.Indices.reserve(static_cast<std::size_t>(stackCount) * sectorCount * 6);
+
+        for (uint32_t stack = 0; stack <= stackCount; ++stack) {
+            float v      = static_cast<float>(stack) / static_cast<float>(stackCount);
+            float sinPhi = std::sin(glm::pi<float>() * v);
+            float cosPhi = std::cos(glm::pi<float>() * v);
+
+            for (uint32_t sector = 0; sector <= sectorCount; ++sector) {
+                glm::vec3 normal = glm::vec3(sinPhi * sectors[sector].x, cosPhi, -sinPhi * sectors[sector].y);
+                float     u      = static_cast<float>(sector) / static_cast<float>(sectorCount);
+
+                data.Vertices.push_back({ radius * normal, normal, glm::vec2(u, 1.0f - v) });
+            }
+        }
+
+        // The triangles touching a pole by an edge are degenerate
+        for (uint32_t stack = 0; stack < stackCount; ++stack) {
+            for (uint32_t sector = 0; sector < sectorCount; ++sector) {
+                IndexType current = stack * rowSize + sector;
+                IndexType next    = current + rowSize;
+
+                if (stack != stackCount - 1)
+                    data.Indices.insert(data.Indices.end(), { current, next, next + 1 });
+
+                if (stack != 0)
+                    data.Indices.insert(data.Indices.end(), { current, next + 1, current + 1 });
+            }
+        }
+
+        return data;
+    }
+
+    MeshData MeshGenerator::CreateTorus(float outerRadius, float innerRadius, uint32_t sideCount, uint32_t ringCount) {
+        MeshData data;
+        uint32_t rowSize = sideCount + 1;
+        auto     rings   = Internal::GetCircle(ringCount);
+        auto     sides   = Internal::GetCircle(sideCount);
+
+        data.Vertices.reserve(static_cast<std::size_t>(ringCount + 1) * rowSize);
+        data.Indices.reserve(static_cast<std::size_t>(ringCount) * sideCount * 6);
+
+        // The seams get their own vertices, so the texture coordinates wrap around
+        for (uint32_t ring = 0; ring <= ringCount; ++ring) {
+            glm::vec3 direction = glm::vec3(rings[ring].x, rings[ring].y, 0.0f);
+            float     u         = static_cast<float>(ring) / static_cast<float>(ringCount);
+
+            for (uint32_t side = 0; side <= sideCount; ++side) {
+                // Unit length already, no normalization needed
+                glm::vec3 normal = sides[side].x * direction + glm::vec3(0.0f, 0.0f, sides[side].y);
+                float     v      = static_cast<float>(side) / static_cast<float>(sideCount);
+
+                data.Vertices.push_back({ outerRadius * direction + innerRadius * normal, normal, glm::vec2(u, v) });
+            }
+        }
+
+        for (uint32_t ring = 0; ring < ringCount; ++ring)
+            for (uint32_t side = 0; side < sideCount; ++side)
+                Internal::PushQuad(data.Indices, ring * rowSize + side, rowSize);
+
+        return data;
+    }
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,214 @@
+#include "MeshLoader.hpp"
+
+namespace Ziben {
+
+    namespace Internal {
+
+        static inline bool IsSpace(char ch) {
+            return ch == ' ' || ch == '\t' || ch == '\r';
+        }
+
+        static std::string_view NextToken(std::string_view& line) {
+            std::size_t begin = 0;
+
+            while (begin < line.size() && IsSpace(line[begin]))
+                ++begin;
+
+            std::size_t end = begin;
+
+            while (end < line.size() && !IsSpace(line[end]))
+                ++end;
+
+            std::string_view token = line.substr(begin, end - begin);
+            line.remove_prefix(end);
+
+            return token;
+        }
+
+        static bool ParseFloats(std::string_view& line, float* values, std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i) {
+                std::string_view token = NextToken(line);
+
+                if (std::from_chars(token.data(), token.data() + token.size(), values[i]).ec != std::errc())
+                    return false;
+            }
+
+            return true;
+        }
+
+        // OBJ indices start from 1, negative ones count back from the last element
+        static bool ParseIndex(std::string_view token, std::size_t count, int64_t& index) {
+            if (token.empty()) {
+                index = -1;
+                return true;
+            }
+
+            if (std::from_chars(token.data(), token.data() + token.size(), index).ec != std::errc() || index == 0)
+                return false;
+
+            index = index > 0 ? index - 1 : static_cast<int64_t>(count) + index;
+
+            return index >= 0 && index < static_cast<int64_t>(count);
+        }
+
+        // Position, texture coordinate and normal indices of a face corner, -1 when missing
+        struct Corner {
+            int64_t Position = -1;
+            int64_t TexCoord = -1;
+            int64_t Normal   = -1;
+
+            bool operator ==(const Corner&) const = default;
+        };
+
+        struct CornerHash {
+            std::size_t operator ()(const Corner& corner) const {
+                return std::hash<int64_t>()(corner.Position) ^ std::hash<int64_t>()(corner.TexCoord) * 31 ^ std::hash<int64_t>()(corner.Normal) * 961;
+            }
+        };
+
+    } // namespace Internal
+
+    bool MeshLoader::LoadObj(const std::string& filepath, MeshData& data) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        std::ifstream inputStream(filepath, std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+
+        if (!inputStream) {
+            ZIBEN_CORE_ERROR("MeshLoader: can't open the file by provided path: {0}", filepath);
+            return false;
+        }
+
+        std::string source(static_cast<std::size_t>(inputStream.tellg()), '\0');
+
+        inputStream.seekg(0);
+        inputStream.read(source.data(), static_cast<std::streamsize>(source.size()));
+
+        return ParseObj(source, filepath, data);
+    }
+
+    bool MeshLoader::ParseObj(std::string_view source, std::string_view name, MeshData& data) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        std::vector<glm::vec3> positions;
+        std::vector<glm::vec2> texCoords;
+        std::vector<glm::vec3> normals;
+
+        std::unordered_map<Internal::Corner, IndexType, Internal::CornerHash> vertexIndices;
+        std::vector<Internal::Corner>                                         polygon;
+        bool                                                                  hasMissingNormals = false;
+        std::size_t                                                           lineNumber        = 0;
+
+        data = {};
+
+        auto warn = [&](std::string_view message) {
+            ZIBEN_CORE_WARN("MeshLoader: {0}:{1}: {2}", name, lineNumber, message);
+        };
+
+        while (!source.empty()) {
+            std::size_t      end  = source.find('\n');
+            std::string_view line = source.substr(0, end);
+
+            source.remove_prefix(end != std::string_view::npos ? end + 1 : source.size());
+            ++lineNumber;
+
+            std::string_view keyword = Internal::NextToken(line);
+
+            if (keyword == "v") {
+                glm::vec3 position = glm::vec3(0.0f);
+
+                if (!Internal::ParseFloats(line, &position.x, 3))
+                    warn("invalid position");
+
+                positions.push_back(position);
+            } else if (keyword == "vt") {
+                glm::vec2 texCoord = glm::vec2(0.0f);
+
+                if (!Internal::ParseFloats(line, &texCoord.x, 2))
+                    warn("invalid texture coordinate");
+
+                texCoords.push_back(texCoord);
+            } else if (keyword == "vn") {
+                glm::vec3 normal = glm::vec3(0.0f);
+
+                if (!Internal::ParseFloats(line, &normal.x, 3))
+                    warn("invalid normal");
+
+                normals.push_back(normal);
+            } else if (keyword == "f") {
+                polygon.clear();
+
+                for (std::string_view token = Internal::NextToken(line); !token.empty(); token = Internal::NextToken(line)) {
+                    Internal::Corner corner;
+
+                    std::size_t first  = token.find('/');
+                    std::size_t second = first != std::string_view::npos ? token.find('/', first + 1) : std::string_view::npos;
+
+                    bool isValid = Internal::ParseIndex(token.substr(0, first), positions.size(), corner.Position) && corner.Position >= 0;
+
+                    if (first != std::string_view::npos)
+                        isValid &= Internal::ParseIndex(token.substr(first + 1, second - first - 1), texCoords.size(), corner.TexCoord);
+
+                    if (second != std::string_view::npos)
+                        isValid &= Internal::ParseIndex(token.substr(second + 1), normals.size(), corner.Normal);
+
+                    if (!isValid) {
+                        warn("invalid face index");
+                        polygon.clear();
+
+                        break;
+                    }
+
+                    polygon.push_back(corner);
+                }
+
+                for (std::size_t i = 2; i < polygon.size(); ++i) {
+                    for (const auto& corner : { polygon[0], polygon[i - 1], polygon[i] }) {
+                        auto [it, isInserted] = vertexIndices.try_emplace(corner, static_cast<IndexType>(data.Vertices.size()));
+
+                        if (isInserted) {
+                            MeshQueue::Vertex vertex;
+
+                            vertex.Position = positions[corner.Position];
+                            vertex.TexCoord = corner.TexCoord >= 0 ? texCoords[corner.TexCoord] : glm::vec2(0.0f);
+                            vertex.Normal   = corner.Normal >= 0 ? normals[corner.Normal] : glm::vec3(0.0f);
+
+                            hasMissingNormals |= corner.Normal < 0;
+
+                            data.Vertices.push_back(vertex);
+                        }
+
+                        data.Indices.push_back(it->second);
+                    }
+                }
+            }
+        }
+
+        // Area weighted, the cross product is twice the triangle area
+        if (hasMissingNormals) {
+            std::vector<glm::vec3> faceNormals(data.Vertices.size(), glm::vec3(0.0f));
+
+            for (std::size_t i = 0; i + 2 < data.Indices.size(); i += 3) {
+                const auto& a = data.Vertices[data.Indices[i]].Position;
+                const auto& b = data.Vertices[data.Indices[i + 1]].Position;
+                const auto& c = data.Vertices[data.Indices[i + 2]].Position;
+
+                glm::vec3 normal = glm::cross(b - a, c - a);
+
+                for (std::size_t corner = 0; corner < 3; ++corner)
+                    faceNormals[data.Indices[i + corner]] += normal;
+            }
+
+            for (std::size_t i = 0; i < data.Vertices.size(); ++i)
+                if (data.Vertices[i].Normal == glm::vec3(0.0f) && faceNormals[i] != glm::vec3(0.0f))
+                    data.Vertices[i].Normal = glm::normalize(faceNormals[i]);
+        }
+
+        if (data.Indices.empty()) {
+            ZIBEN_CORE_ERROR("MeshLoader: {0} has no faces", name);
+            return false;
+        }
+
+        return true;
+    }
+
+} // namespace Ziben
\ No newline at end of file
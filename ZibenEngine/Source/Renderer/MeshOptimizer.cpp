@@ -0,0 +1,168 @@
+#include "MeshOptimizer.hpp"
+
+namespace Ziben {
+
+    MeshOptimizer::Statistics MeshOptimizer::Optimize(MeshData& data, uint32_t cacheSize) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        Statistics statistics;
+        auto       vertexCount = static_cast<uint32_t>(data.Vertices.size());
+
+        statistics.AcmrBefore = GetAcmr(data.Indices, vertexCount, cacheSize);
+
+        OptimizeVertexCache(data.Indices, vertexCount, cacheSize);
+        OptimizeVertexFetch(data);
+
+        statistics.AcmrAfter = GetAcmr(data.Indices, static_cast<uint32_t>(data.Vertices.size()), cacheSize);
+
+        return statistics;
+    }
+
+    void MeshOptimizer::OptimizeVertexCache(std::vector<IndexType>& indices, uint32_t vertexCount, uint32_t cacheSize) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        std::size_t triangleCount = indices.size() / 3;
+
+        if (triangleCount == 0 || vertexCount == 0)
+            return;
+
+        // Triangles around every vertex in compressed rows
+        std::vector<uint32_t> liveCounts(vertexCount, 0);
+        std::vector<uint32_t> offsets(vertexCount + 1, 0);
+        std::vector<uint32_t> adjacency(triangleCount * 3);
+
+        for (std::size_t i = 0; i < triangleCount * 3; ++i)
+            ++liveCounts[indices[i]];
+
+        for (uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+            offsets[vertex + 1] = offsets[vertex] + liveCounts[vertex];
+
+        {
+            std::vector<uint32_t> cursors(offsets.begin(), offsets.end() - 1);
+
+            for (std::size_t i = 0; i < triangleCount * 3; ++i)
+                adjacency[cursors[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+
+        // A vertex is in the cache while fewer than cacheSize vertices were transformed after it
+        std::vector<uint32_t>  timestamps(vertexCount, 0);
+        std::vector<bool>      isEmitted(triangleCount, false);
+        std::vector<uint32_t>  deadEnds;
+        std::vector<uint32_t>  candidates;
+        std::vector<IndexType> result;
+
+        deadEnds.reserve(triangleCount * 3);
+        candidates.reserve(64);
+        result.reserve(triangleCount * 3);
+
+        uint32_t time   = cacheSize + 1;
+        uint32_t cursor = 0;
+
+        // Vertex with live triangles from the dead end stack or in the input order, -1 once everything is emitted
+        auto skipDeadEnd = [&]() -> int64_t {
+            while (!deadEnds.empty()) {
+                uint32_t vertex = deadEnds.back();
+                deadEnds.pop_back();
+
+                if (liveCounts[vertex] > 0)
+                    return vertex;
+            }
+
+            for (; cursor < vertexCount; ++cursor)
+                if (liveCounts[cursor] > 0)
+                    return cursor;
+
+            return -1;
+        };
+
+        for (int64_t fan = skipDeadEnd(); fan >= 0;) {
+            candidates.clear();
+
+            for (uint32_t i = offsets[fan]; i < offsets[fan + 1]; ++i) {
+                uint32_t triangle = adjacency[i];
+
+                if (isEmitted[triangle])
+                    continue;
+
+                for (std::size_t corner = 0; corner < 3; ++corner) {
+                    IndexType vertex = indices[triangle * 3 + corner];
+
+                    result.push_back(vertex);
+                    deadEnds.push_back(vertex);
+                    candidates.push_back(vertex);
+
+                    --liveCounts[vertex];
+
+                    if (time - timestamps[vertex] > cacheSize)
+                        timestamps[vertex] = time++;
+                }
+
+                isEmitted[triangle] = true;
+            }
+
+            // The candidate that will still be in the cache after its remaining triangles and was cached the longest ago
+            int64_t  next         = -1;
+            uint32_t bestPriority = 0;
+
+            for (uint32_t vertex : candidates) {
+                if (liveCounts[vertex] == 0)
+                    continue;
+
+                uint32_t priority = 0;
+
+                if (time - timestamps[vertex] + 2 * liveCounts[vertex] <= cacheSize)
+                    priority = time - timestamps[vertex];
+
+                if (next < 0 || priority > bestPriority) {
+                    next         = vertex;
+                    bestPriority = priority;
+                }
+            }
+
+            fan = next >= 0 ? next : skipDeadEnd();
+        }
+
+        indices = std::move(result);
+    }
+
+    void MeshOptimizer::OptimizeVertexFetch(MeshData& data) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        static constexpr IndexType s_Unused = std::numeric_limits<IndexType>::max();
+
+        std::vector<IndexType>         remap(data.Vertices.size(), s_Unused);
+        std::vector<MeshQueue::Vertex> vertices;
+
+        vertices.reserve(data.Vertices.size());
+
+        for (auto& index : data.Indices) {
+            if (remap[index] == s_Unused) {
+                remap[index] = static_cast<IndexType>(vertices.size());
+                vertices.push_back(data.Vertices[index]);
+            }
+
+            index = remap[index];
+        }
+
+        data.Vertices = std::move(vertices);
+    }
+
+    float MeshOptimizer::GetAcmr(const std::vector<IndexType>& indices, uint32_t vertexCount, uint32_t cacheSize) {
+        if (indices.size() < 3)
+            return 0.0f;
+
+        std::vector<uint32_t> timestamps(vertexCount, 0);
+        uint32_t              time   = cacheSize + 1;
+        uint32_t              misses = 0;
+
+        for (IndexType index : indices) {
+            if (time - timestamps[index] > cacheSize) {
+                timestamps[index] = time++;
+                ++misses;
+            }
+        }
+
+        return static_cast<float>(misses) / static_cast<float>(indices.size() / 3);
+    }
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,241 @@
+#include "MeshQueue.hpp"
+
+#include "RenderCommand.hpp"
+#include "Renderer.hpp"
+#include "AssetManager.hpp"
+
+namespace Ziben {
+
+    void MeshQueue::Init() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data = GetData();
+
+        Reserve(s_InitialVertexCount, s_InitialIndexCount);
+
+        data.InstanceBuffer = StorageBuffer::Create(s_MaxObjectCount * sizeof(Instance));
+        data.CommandBuffer  = GpuBuffer::Create(s_MaxObjectCount * sizeof(DrawCommand));
+        data.DefaultShader  = AssetManager::LoadShader("Assets/Shaders/MeshShader.glsl");
+
+        data.Objects.reserve(s_MaxObjectCount);
+        data.Instances.reserve(s_MaxObjectCount);
+    }
+
+    void MeshQueue::Shutdown() {
+        GetData() = {};
+    }
+
+    MeshQueue::MeshId MeshQueue::AddMesh(const std::vector<Vertex>& vertices, const std::vector<IndexType>& indices) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data       = GetData();
+        auto& statistics = GetStatistics();
+
+        auto vertexCount = static_cast<uint32_t>(vertices.size());
+        auto indexCount  = static_cast<uint32_t>(indices.size());
+
+        Reserve(data.VertexCount + vertexCount, data.IndexCount + indexCount);
+
+        data.MeshVertexBuffer->SetData(vertices.data(), vertices.size() * sizeof(Vertex), data.VertexCount * sizeof(Vertex));
+        data.MeshIndexBuffer->SetData(indices.data(), indices.size(), data.IndexCount);
+
+        data.Meshes.push_back({ indexCount, data.IndexCount, static_cast<int32_t>(data.VertexCount) });
+
+        data.VertexCount += vertexCount;
+        data.IndexCount  += indexCount;
+
+        statistics.MeshCount   = static_cast<uint32_t>(data.Meshes.size());
+        statistics.VertexCount = data.VertexCount;
+        statistics.IndexCount  = data.IndexCount;
+
+        return static_cast<MeshId>(data.Meshes.size() - 1);
+    }
+
+    MeshQueue::MeshId MeshQueue::AddMesh(MeshId mesh, const std::vector<IndexType>& indices) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data       = GetData();
+        auto& statistics = GetStatistics();
+
+        assert(mesh < data.Meshes.size());
+
+        auto indexCount = static_cast<uint32_t>(indices.size());
+        auto baseVertex = data.Meshes[mesh].BaseVertex;
+
+        Reserve(data.VertexCount, data.IndexCount + indexCount);
+
+        data.MeshIndexBuffer->SetData(indices.data(), indices.size(), data.IndexCount);
+        data.Meshes.push_back({ indexCount, data.IndexCount, baseVertex });
+
+        data.IndexCount += indexCount;
+
+        statistics.MeshCount  = static_cast<uint32_t>(data.Meshes.size());
+        statistics.IndexCount = data.IndexCount;
+
+        return static_cast<MeshId>(data.Meshes.size() - 1);
+    }
+
+    void MeshQueue::BeginScene(const glm::mat4& viewProjectionMatrix) {
+        Renderer::SetFrameUniforms({ viewProjectionMatrix });
+    }
+
+    void MeshQueue::EndScene() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        Flush();
+    }
+
+    void MeshQueue::Submit(
+        const Ref<Shader>& shader,
+        MeshId             mesh,
+        const glm::mat4&   transform,
+        const glm::vec4&   color,
+        int                entityHandle
+    ) {
+        auto& data = GetData();
+
+        assert(mesh < data.Meshes.size());
+
+        if (data.Objects.size() == s_MaxObjectCount)
+            Flush();
+
+        auto [it, isInserted] = data.ShaderIndices.try_emplace(shader.get(), static_cast<uint32_t>(data.Shaders.size()));
+
+        if (isInserted)
+            data.Shaders.push_back(shader);
+
+        data.Objects.push_back({ static_cast<uint64_t>(it->second) << 32 | mesh, static_cast<uint32_t>(data.Instances.size()) });
+        data.Instances.push_back({ transform, color, entityHandle, {} });
+    }
+
+    void MeshQueue::Flush() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data       = GetData();
+        auto& statistics = GetStatistics();
+
+        if (data.Objects.empty())
+            return;
+
+        std::sort(data.Objects.begin(), data.Objects.end(), [](const Object& lhs, const Object& rhs) {
+            return lhs.Key < rhs.Key;
+        });
+
+        // Instances of a mesh are consecutive, so a command covers them with its base instance
+        data.SortedInstances.resize(data.Objects.size());
+        data.Commands.clear();
+
+        for (std::size_t i = 0; i < data.Objects.size(); ++i) {
+            const auto& object = data.Objects[i];
+
+            data.SortedInstances[i] = data.Instances[object.InstanceIndex];
+
+            if (i > 0 && data.Objects[i - 1].Key == object.Key) {
+                ++data.Commands.back().InstanceCount;
+                continue;
+            }
+
+            const auto& mesh = data.Meshes[static_cast<MeshId>(object.Key)];
+
+            data.Commands.push_back({ mesh.IndexCount, 1, mesh.FirstIndex, mesh.BaseVertex, static_cast<uint32_t>(i) });
+        }
+
+        for (const auto& command : data.Commands)
+            statistics.TriangleCount += command.IndexCount / 3 * command.InstanceCount;
+
+        data.InstanceBuffer->SetData(data.SortedInstances.data(), data.SortedInstances.size() * sizeof(Instance));
+        data.CommandBuffer->SetData(data.Commands.data(), data.Commands.size() * sizeof(DrawCommand));
+
+        StorageBuffer::Bind(data.InstanceBuffer, s_InstanceBufferBinding);
+        GpuBuffer::Bind(data.CommandBuffer, GL_DRAW_INDIRECT_BUFFER);
+        VertexArray::Bind(data.MeshVertexArray);
+
+        // One draw per shader, its commands are consecutive
+        auto getShaderIndex = [&data](const DrawCommand& command) {
+            return static_cast<uint32_t>(data.Objects[command.BaseInstance].Key >> 32);
+        };
+
+        for (std::size_t begin = 0, end = 0; begin < data.Commands.size(); begin = end) {
+            uint32_t shaderIndex = getShaderIndex(data.Commands[begin]);
+
+            end = begin + 1;
+
+            while (end < data.Commands.size() && getShaderIndex(data.Commands[end]) == shaderIndex)
+                ++end;
+
+            Shader::Bind(data.Shaders[shaderIndex]);
+            RenderCommand::DrawIndexedIndirect(end - begin, begin);
+
+            ++statistics.DrawCalls;
+        }
+
+        statistics.CommandCount += static_cast<uint32_t>(data.Commands.size());
+        statistics.ObjectCount  += static_cast<uint32_t>(data.Objects.size());
+
+        data.Objects.clear();
+        data.Instances.clear();
+        data.Shaders.clear();
+        data.ShaderIndices.clear();
+    }
+
+    const Ref<Shader>& MeshQueue::GetDefaultShader() {
+        return GetData().DefaultShader;
+    }
+
+    MeshQueue::Statistics& MeshQueue::GetStatistics() {
+        static Statistics statistics;
+        return statistics;
+    }
+
+    void MeshQueue::ResetStatistics() {
+        GetStatistics().DrawCalls     = 0;
+        GetStatistics().CommandCount  = 0;
+        GetStatistics().ObjectCount   = 0;
+        GetStatistics().TriangleCount = 0;
+        GetStatistics().CulledCount   = 0;
+    }
+
+    MeshQueue::Data& MeshQueue::GetData() {
+        static Data data;
+        return data;
+    }
+
+    void MeshQueue::Reserve(uint32_t vertexCount, uint32_t indexCount) {
+        auto& data = GetData();
+
+        auto vertexCapacity = static_cast<uint32_t>(data.MeshVertexBuffer ? data.MeshVertexBuffer->GetSize() / sizeof(Vertex) : 0);
+        auto indexCapacity  = static_cast<uint32_t>(data.MeshIndexBuffer ? data.MeshIndexBuffer->GetCount() : 0);
+
+        if (vertexCount <= vertexCapacity && indexCount <= indexCapacity)
+            return;
+
+        ZIBEN_PROFILE_FUNCTION();
+
+        // Doubled, so adding meshes one by one copies the geometry a logarithmic number of times
+        vertexCapacity = std::max(vertexCount, vertexCapacity * 2);
+        indexCapacity  = std::max(indexCount, indexCapacity * 2);
+
+        auto vertexBuffer = VertexBuffer::Create(static_cast<std::size_t>(vertexCapacity) * sizeof(Vertex));
+        auto indexBuffer  = IndexBuffer::Create(nullptr, indexCapacity);
+
+        vertexBuffer->SetLayout({
+            { ShaderData::Type::Float3, "a_Position" },
+            { ShaderData::Type::Float3, "a_Normal"   },
+            { ShaderData::Type::Float2, "a_TexCoord" }
+        });
+
+        if (data.VertexCount > 0)
+            glCopyNamedBufferSubData(data.MeshVertexBuffer->GetHandle(), vertexBuffer->GetHandle(), 0, 0, static_cast<GLsizeiptr>(data.VertexCount * sizeof(Vertex)));
+
+        if (data.IndexCount > 0)
+            glCopyNamedBufferSubData(data.MeshIndexBuffer->GetHandle(), indexBuffer->GetHandle(), 0, 0, static_cast<GLsizeiptr>(data.IndexCount * sizeof(IndexType)));
+
+        data.MeshVertexBuffer = vertexBuffer;
+        data.MeshIndexBuffer  = indexBuffer;
+
+        data.MeshVertexArray = VertexArray::Create();
+        data.MeshVertexArray->PushVertexBuffer(data.MeshVertexBuffer);
+        data.MeshVertexArray->SetIndexBuffer(data.MeshIndexBuffer);
+    }
+
+} // namespace Ziben
\ No newline at end of file
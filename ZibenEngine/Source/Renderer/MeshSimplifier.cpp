@@ -0,0 +1,455 @@
+#include "MeshSimplifier.hpp"
+
+#include "MeshOptimizer.hpp"
+
+namespace Ziben {
+
+    namespace Internal {
+
+        enum class VertexKind : uint8_t {
+            // Collapses into any neighbour
+            Manifold = 0,
+
+            // Collapses along the boundary only
+            Border,
+
+            // Seams and non-manifold vertices, never collapses
+            Locked
+        };
+
+        // Sum of the squared distances to the planes, p * A * p + 2 * B * p + C, weighted by the triangle areas
+        struct Quadric {
+            double A00    = 0.0;
+            double A01    = 0.0;
+            double A02    = 0.0;
+            double A11    = 0.0;
+            double A12    = 0.0;
+            double A22    = 0.0;
+            double B0     = 0.0;
+            double B1     = 0.0;
+            double B2     = 0.0;
+            double C      = 0.0;
+            double Weight = 0.0;
+        };
+
+        struct Collapse {
+            IndexType From;
+            IndexType To;
+            float     Error;
+        };
+
+        static void AddPlane(Quadric& quadric, const glm::vec3& normal, float distance, float weight) {
+            double x = normal.x;
+            double y = normal.y;
+            double z = normal.z;
+            double d = distance;
+            double w = weight;
+
+            quadric.A00    += w * x * x;
+            quadric.A01    += w * x * y;
+            quadric.A02    += w * x * z;
+            quadric.A11    += w * y * y;
+            quadric.A12    += w * y * z;
+            quadric.A22    += w * z * z;
+            quadric.B0     += w * x * d;
+            quadric.B1     += w * y * d;
+            quadric.B2     += w * z * d;
+            quadric.C      += w * d * d;
+            quadric.Weight += w;
+        }
+
+        static void AddQuadric(Quadric& lhs, const Quadric& rhs) {
+            lhs.A00    += rhs.A00;
+            lhs.A01    += rhs.A01;
+            lhs.A02    += rhs.A02;
+            lhs.A11    += rhs.A11;
+            lhs.A12    += rhs.A12;
+            lhs.A22    += rhs.A22;
+            lhs.B0     += rhs.B0;
+            lhs.B1     += rhs.B1;
+            lhs.B2     += rhs.B2;
+            lhs.C      += rhs.C;
+            lhs.Weight += rhs.Weight;
+        }
+
+        // Weighted mean of the squared distances, so the error doesn't depend on the tessellation
+        static float GetError(const Quadric& quadric, const glm::vec3& point) {
+            double x = point.x;
+            double y = point.y;
+            double z = point.z;
+
+            double error = quadric.A00 * x * x + quadric.A11 * y * y + quadric.A22 * z * z
+                         + 2.0 * (quadric.A01 * x * y + quadric.A02 * x * z + quadric.A12 * y * z)
+                         + 2.0 * (quadric.B0 * x + quadric.B1 * y + quadric.B2 * z)
+                         + quadric.C;
+
+            return quadric.Weight > 0.0 ? static_cast<float>(std::abs(error) / quadric.Weight) : 0.0f;
+        }
+
+        static uint64_t GetEdgeKey(uint32_t from, uint32_t to) {
+            return static_cast<uint64_t>(from) << 32 | to;
+        }
+
+    } // namespace Internal
+
+    float MeshSimplifier::Simplify(
+        const std::vector<MeshQueue::Vertex>& vertices,
+        std::vector<IndexType>&               indices,
+        uint32_t                              targetIndexCount,
+        float                                 targetError
+    ) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        using namespace Internal;
+
+        auto vertexCount = static_cast<uint32_t>(vertices.size());
+
+        if (indices.size() <= targetIndexCount || vertexCount == 0)
+            return 0.0f;
+
+        // Used vertices at the same position are welded, the topology and the quadrics live on the welded indices
+        std::vector<IndexType> welded(vertexCount);
+        std::vector<uint32_t>  wedgeCounts(vertexCount, 0);
+        std::vector<bool>      isUsed(vertexCount, false);
+
+        std::iota(welded.begin(), welded.end(), 0);
+
+        for (IndexType index : indices)
+            isUsed[index] = true;
+
+        {
+            std::vector<IndexType> order;
+
+            for (IndexType vertex = 0; vertex < vertexCount; ++vertex)
+                if (isUsed[vertex])
+                    order.push_back(vertex);
+
+            auto isLess = [&vertices](IndexType lhs, IndexType rhs) {
+                const auto& l = vertices[lhs].Position;
+                const auto& r = vertices[rhs].Position;
+
+                return std::tie(l.x, l.y, l.z) < std::tie(r.x, r.y, r.z);
+            };
+
+            std::sort(order.begin(), order.end(), isLess);
+
+            for (std::size_t i = 0; i < order.size(); ++i) {
+                bool isDuplicate = i > 0 && !isLess(order[i - 1], order[i]);
+
+                welded[order[i]] = isDuplicate ? welded[order[i - 1]] : order[i];
+
+                ++wedgeCounts[welded[order[i]]];
+            }
+        }
+
+        auto getPosition = [&](IndexType index) -> const glm::vec3& { return vertices[welded[index]].Position; };
+
+        // Bounds radius, the errors are reported relative to it
+        float radius = 0.0f;
+
+        {
+            glm::vec3 min = glm::vec3(std::numeric_limits<float>::max());
+            glm::vec3 max = glm::vec3(std::numeric_limits<float>::lowest());
+
+            for (IndexType index : indices) {
+                min = glm::min(min, vertices[index].Position);
+                max = glm::max(max, vertices[index].Position);
+            }
+
+            radius = 0.5f * glm::length(max - min);
+        }
+
+        if (radius <= 0.0f)
+            return 0.0f;
+
+        // Directed edges of the welded triangles, an edge without its twin is on the boundary
+        std::vector<uint64_t> edges;
+
+        auto buildEdges = [&] {
+            edges.clear();
+
+            for (std::size_t i = 0; i < indices.size(); i += 3)
+                for (std::size_t corner = 0; corner < 3; ++corner)
+                    edges.push_back(GetEdgeKey(welded[indices[i + corner]], welded[indices[i + (corner + 1) % 3]]));
+
+            std::sort(edges.begin(), edges.end());
+        };
+
+        auto isBorderEdge = [&](IndexType from, IndexType to) {
+            return !std::binary_search(edges.begin(), edges.end(), GetEdgeKey(welded[to], welded[from]));
+        };
+
+        buildEdges();
+
+        std::vector<VertexKind> kinds(vertexCount, VertexKind::Manifold);
+
+        {
+            std::vector<uint32_t> borderCounts(vertexCount, 0);
+
+            for (std::size_t i = 0; i < edges.size(); ++i) {
+                auto from = static_cast<uint32_t>(edges[i] >> 32);
+                auto to   = static_cast<uint32_t>(edges[i]);
+
+                // An edge shared by triangles of the same orientation isn't manifold
+                if (i > 0 && edges[i - 1] == edges[i]) {
+                    kinds[from] = VertexKind::Locked;
+                    kinds[to]   = VertexKind::Locked;
+                }
+
+                if (!std::binary_search(edges.begin(), edges.end(), GetEdgeKey(to, from))) {
+                    ++borderCounts[from];
+                    ++borderCounts[to];
+                }
+            }
+
+            for (uint32_t vertex = 0; vertex < vertexCount; ++vertex) {
+                if (welded[vertex] != vertex || wedgeCounts[vertex] > 1)
+                    kinds[vertex] = VertexKind::Locked;
+                else if (borderCounts[vertex] > 0 && kinds[vertex] == VertexKind::Manifold)
+                    kinds[vertex] = borderCounts[vertex] == 2 ? VertexKind::Border : VertexKind::Locked;
+            }
+        }
+
+        // Planes of the triangles, the boundary edges add planes perpendicular to their triangles
+        std::vector<Quadric> quadrics(vertexCount);
+
+        for (std::size_t i = 0; i < indices.size(); i += 3) {
+            std::array<IndexType, 3> triangle = { indices[i], indices[i + 1], indices[i + 2] };
+
+            glm::vec3 normal = glm::cross(getPosition(triangle[1]) - getPosition(triangle[0]), getPosition(triangle[2]) - getPosition(triangle[0]));
+            float     length = glm::length(normal);
+
+            if (length == 0.0f)
+                continue;
+
+            normal /= length;
+
+            for (IndexType index : triangle)
+                AddPlane(quadrics[welded[index]], normal, -glm::dot(normal, getPosition(triangle[0])), 0.5f * length);
+
+            for (std::size_t corner = 0; corner < 3; ++corner) {
+                IndexType from = triangle[corner];
+                IndexType to   = triangle[(corner + 1) % 3];
+
+                if (!isBorderEdge(from, to))
+                    continue;
+
+                glm::vec3 edge       = getPosition(to) - getPosition(from);
+                glm::vec3 edgeNormal = glm::normalize(glm::cross(edge, normal));
+                float     distance   = -glm::dot(edgeNormal, getPosition(from));
+                float     weight     = glm::dot(edge, edge) * s_BorderWeight;
+
+                AddPlane(quadrics[welded[from]], edgeNormal, distance, weight);
+                AddPlane(quadrics[welded[to]],   edgeNormal, distance, weight);
+            }
+        }
+
+        std::vector<IndexType> remap(vertexCount);
+        std::vector<bool>      isCollapseLocked(vertexCount);
+        std::vector<uint32_t>  offsets(vertexCount + 1);
+        std::vector<uint32_t>  adjacency;
+        std::vector<Collapse>  collapses;
+        std::vector<IndexType> fromNeighbours;
+        std::vector<IndexType> toNeighbours;
+
+        float maxError   = 0.0f;
+        float errorLimit = targetError * radius * targetError * radius;
+
+        // Welded vertices of the triangles around the vertex, with the collapses of the current pass applied
+        auto getNeighbours = [&](IndexType vertex, std::vector<IndexType>& neighbours) {
+            neighbours.clear();
+
+            for (uint32_t i = offsets[vertex]; i < offsets[vertex + 1]; ++i)
+                for (std::size_t corner = 0; corner < 3; ++corner)
+                    if (IndexType neighbour = welded[remap[indices[adjacency[i] * 3 + corner]]]; neighbour != vertex)
+                        neighbours.push_back(neighbour);
+
+            std::sort(neighbours.begin(), neighbours.end());
+            neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+        };
+
+        // The collapse must keep the surface manifold and must not turn any of the remaining triangles over
+        auto isCollapseValid = [&](IndexType from, IndexType to, bool isBorder) {
+            getNeighbours(from, fromNeighbours);
+            getNeighbours(welded[to], toNeighbours);
+
+            std::size_t commonCount = 0;
+
+            for (std::size_t i = 0, j = 0; i < fromNeighbours.size() && j < toNeighbours.size();) {
+                if (fromNeighbours[i] < toNeighbours[j]) {
+                    ++i;
+                } else if (toNeighbours[j] < fromNeighbours[i]) {
+                    ++j;
+                } else {
+                    ++commonCount;
+                    ++i;
+                    ++j;
+                }
+            }
+
+            if (commonCount != (isBorder ? 1 : 2))
+                return false;
+
+            for (uint32_t i = offsets[from]; i < offsets[from + 1]; ++i) {
+                std::array<glm::vec3, 3> before;
+                std::array<glm::vec3, 3> after;
+                bool                     isRemoved = false;
+
+                for (std::size_t corner = 0; corner < 3; ++corner) {
+                    IndexType vertex = welded[remap[indices[adjacency[i] * 3 + corner]]];
+
+                    isRemoved      |= vertex == welded[to];
+                    before[corner]  = vertices[vertex].Position;
+                    after[corner]   = vertex == from ? getPosition(to) : before[corner];
+                }
+
+                if (isRemoved)
+                    continue;
+
+                glm::vec3 normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+                glm::vec3 normalAfter  = glm::cross(after[1] - after[0], after[2] - after[0]);
+
+                if (glm::dot(normalBefore, normalAfter) <= 0.0f)
+                    return false;
+            }
+
+            return true;
+        };
+
+        while (indices.size() > targetIndexCount) {
+            std::size_t triangleCount = indices.size() / 3;
+
+            // Triangles around every welded vertex in compressed rows
+            std::fill(offsets.begin(), offsets.end(), 0);
+            adjacency.resize(triangleCount * 3);
+
+            for (IndexType index : indices)
+                ++offsets[welded[index] + 1];
+
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+            {
+                std::vector<uint32_t> cursors(offsets.begin(), offsets.end() - 1);
+
+                for (std::size_t i = 0; i < indices.size(); ++i)
+                    adjacency[cursors[welded[indices[i]]]++] = static_cast<uint32_t>(i / 3);
+            }
+
+            // Every interior edge once per direction, the boundary edges only along the boundary
+            collapses.clear();
+
+            for (std::size_t i = 0; i < indices.size(); i += 3) {
+                for (std::size_t corner = 0; corner < 3; ++corner) {
+                    IndexType from     = indices[i + corner];
+                    IndexType to       = indices[i + (corner + 1) % 3];
+                    bool      isBorder = isBorderEdge(from, to);
+
+                    if (!isBorder && welded[from] > welded[to])
+                        continue;
+
+                    for (auto [source, target] : { std::pair(from, to), std::pair(to, from) }) {
+                        VertexKind kind = kinds[welded[source]];
+
+                        if (kind == VertexKind::Locked || (kind == VertexKind::Border && !isBorder))
+                            continue;
+
+                        collapses.push_back({ welded[source], target, GetError(quadrics[welded[source]], getPosition(target)) });
+                    }
+                }
+            }
+
+            std::sort(collapses.begin(), collapses.end(), [](const Collapse& lhs, const Collapse& rhs) {
+                return lhs.Error < rhs.Error;
+            });
+
+            // A collapse removes two triangles, the goal keeps the pass from overshooting the target. Many collapses
+            // are locked by their neighbours, so the pass goes a bit past the error of the collapse at the goal
+            std::size_t collapseGoal  = std::max<std::size_t>((indices.size() - targetIndexCount) / 6, 1);
+            std::size_t collapseCount = 0;
+            float       passError     = errorLimit;
+
+            if (collapseGoal < collapses.size())
+                passError = std::min(passError, 1.5f * collapses[collapseGoal].Error);
+
+            std::iota(remap.begin(), remap.end(), 0);
+            std::fill(isCollapseLocked.begin(), isCollapseLocked.end(), false);
+
+            for (const auto& collapse : collapses) {
+                if (collapse.Error > passError || collapseCount == collapseGoal)
+                    break;
+
+                IndexType from = collapse.From;
+                IndexType to   = welded[collapse.To];
+
+                if (isCollapseLocked[from] || isCollapseLocked[to])
+                    continue;
+
+                if (!isCollapseValid(from, collapse.To, kinds[from] == VertexKind::Border))
+                    continue;
+
+                remap[from] = collapse.To;
+                AddQuadric(quadrics[to], quadrics[from]);
+
+                isCollapseLocked[from] = true;
+                isCollapseLocked[to]   = true;
+
+                maxError = std::max(maxError, collapse.Error);
+
+                ++collapseCount;
+            }
+
+            if (collapseCount == 0)
+                break;
+
+            // The triangles around the collapsed edges degenerate
+            std::size_t count = 0;
+
+            for (std::size_t i = 0; i < indices.size(); i += 3) {
+                IndexType a = remap[indices[i + 0]];
+                IndexType b = remap[indices[i + 1]];
+                IndexType c = remap[indices[i + 2]];
+
+                if (welded[a] == welded[b] || welded[b] == welded[c] || welded[c] == welded[a])
+                    continue;
+
+                indices[count++] = a;
+                indices[count++] = b;
+                indices[count++] = c;
+            }
+
+            indices.resize(count);
+
+            buildEdges();
+        }
+
+        return std::sqrt(maxError) / radius;
+    }
+
+    void MeshSimplifier::GenerateLods(MeshData& data, uint32_t lodCount, float ratio) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto vertexCount = static_cast<uint32_t>(data.Vertices.size());
+
+        data.Lods.clear();
+
+        for (uint32_t i = 0; i < lodCount; ++i) {
+            const auto& previousIndices = data.Lods.empty() ? data.Indices : data.Lods.back().Indices;
+            float       previousError   = data.Lods.empty() ? 0.0f : data.Lods.back().Error;
+            auto        targetCount     = static_cast<uint32_t>(static_cast<float>(previousIndices.size()) * ratio) / 3 * 3;
+
+            MeshLodData lod;
+
+            // The distance to the full detail surface is at most the sum of the distances between the levels
+            lod.Indices = previousIndices;
+            lod.Error   = previousError + Simplify(data.Vertices, lod.Indices, targetCount);
+
+            if (lod.Indices.empty() || static_cast<float>(lod.Indices.size()) > static_cast<float>(previousIndices.size()) * s_MaxLodIndexRatio)
+                break;
+
+            MeshOptimizer::OptimizeVertexCache(lod.Indices, vertexCount);
+
+            data.Lods.push_back(std::move(lod));
+        }
+    }
+
+} // namespace Ziben
\ No newline at end of file
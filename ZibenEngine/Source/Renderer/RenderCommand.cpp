@@ -1,5 +1,7 @@
 #include "RenderCommand.hpp"
 
+#include "RenderState.hpp"
+
 namespace Ziben {
 
     namespace Internal {
@@ -76,14 +78,14 @@ namespace Ziben {
 		glDebugMessageCallback(Internal::DebugMessageCallback, nullptr);
 //    #endif
 
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        RenderState::SetBlend(true);
+        RenderState::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-        glEnable(GL_DEPTH_TEST);
+        RenderState::SetDepthTest(true);
     }
 
     void RenderCommand::SetViewport(int x, int y, int width, int height) {
-        glViewport(x, y, width, height);
+        RenderState::SetViewport(x, y, width, height);
     }
 
     void RenderCommand::SetClearColor(const glm::vec4& color) {
@@ -97,10 +99,23 @@ namespace Ziben {
     void RenderCommand::DrawIndexed(const Ref<VertexArray>& vertexArray, std::size_t indexCount) {
         glDrawElements(
             GL_TRIANGLES,
-            static_cast<GLsizei>(indexCount ? vertexArray->GetIndexBuffer()->GetCount() : indexCount),
+            static_cast<GLsizei>(indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount()),
             GL_UNSIGNED_INT,
             nullptr
         );
     }
 
+    void RenderCommand::DrawIndexedIndirect(std::size_t commandCount, std::size_t commandOffset) {
+        // IndexCount, InstanceCount, FirstIndex, BaseVertex, BaseInstance
+        constexpr std::size_t commandSize = 5 * sizeof(uint32_t);
+
+        glMultiDrawElementsIndirect(
+            GL_TRIANGLES,
+            GL_UNSIGNED_INT,
+            reinterpret_cast<const void*>(commandOffset * commandSize),
+            static_cast<GLsizei>(commandCount),
+            0
+        );
+    }
+
 } // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,450 @@
+#include "RenderGraph.hpp"
+
+#include "RenderState.hpp"
+
+namespace Ziben {
+
+    namespace Internal {
+
+        static constexpr bool IsIntegerFormat(FrameBufferTextureFormat format) {
+            return format == FrameBufferTextureFormat::RedInteger;
+        }
+
+        static constexpr GLenum GetInternalFormat(FrameBufferTextureFormat format) {
+            switch (format) {
+                case FrameBufferTextureFormat::RGBA8:           return GL_RGBA8;
+                case FrameBufferTextureFormat::RedInteger:      return GL_R32I;
+                case FrameBufferTextureFormat::Depth24Stencil8: return GL_DEPTH24_STENCIL8;
+                default:                                        break;
+            }
+
+            assert(false);
+            return 0;
+        }
+
+        static HandleType CreateTexture(const RenderGraph::TextureDescription& description) {
+            HandleType handle;
+
+            glCreateTextures(GL_TEXTURE_2D, 1, &handle);
+            glTextureStorage2D(
+                handle,
+                1,
+                GetInternalFormat(description.Format),
+                static_cast<GLsizei>(description.Width),
+                static_cast<GLsizei>(description.Height)
+            );
+
+            // Integer textures can't be filtered
+            GLint filter = IsIntegerFormat(description.Format) ? GL_NEAREST : GL_LINEAR;
+
+            glTextureParameteri(handle, GL_TEXTURE_MIN_FILTER, filter);
+            glTextureParameteri(handle, GL_TEXTURE_MAG_FILTER, filter);
+            glTextureParameteri(handle, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTextureParameteri(handle, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+            return handle;
+        }
+
+    } // namespace Internal
+
+    RenderGraph::PassBuilder::PassBuilder(Pass& pass)
+        : m_Pass(pass) {}
+
+    void RenderGraph::PassBuilder::Write(TextureId texture) {
+        m_Pass.ColorAttachments.push_back({ texture, LoadOperation::Load });
+    }
+
+    void RenderGraph::PassBuilder::Write(TextureId texture, const glm::vec4& clearColor) {
+        m_Pass.ColorAttachments.push_back({ texture, LoadOperation::Clear, clearColor });
+    }
+
+    void RenderGraph::PassBuilder::Write(TextureId texture, int clearValue) {
+        m_Pass.ColorAttachments.push_back({ texture, LoadOperation::Clear, glm::vec4(static_cast<float>(clearValue)) });
+    }
+
+    void RenderGraph::PassBuilder::WriteDepth(TextureId texture) {
+        m_Pass.DepthAttachment = { texture, LoadOperation::Load };
+    }
+
+    void RenderGraph::PassBuilder::WriteDepth(TextureId texture, float clearDepth) {
+        m_Pass.DepthAttachment = { texture, LoadOperation::Clear, glm::vec4(clearDepth) };
+    }
+
+    void RenderGraph::PassBuilder::Read(TextureId texture) {
+        m_Pass.Reads.push_back(texture);
+    }
+
+    void RenderGraph::PassBuilder::SetSideEffect() {
+        m_Pass.HasSideEffect = true;
+    }
+
+    RenderGraph::~RenderGraph() {
+        ReleaseResources();
+    }
+
+    RenderGraph::TextureId RenderGraph::CreateTexture(const TextureDescription& description) {
+        BeginFrame();
+
+        assert(description.Width > 0 && description.Height > 0);
+        assert(description.Format != FrameBufferTextureFormat::None);
+
+        m_Textures.push_back({ description, false, 0, 0, -1 });
+
+        return static_cast<TextureId>(m_Textures.size() - 1);
+    }
+
+    void RenderGraph::AddPass(std::string name, const SetupFunction& setup, ExecuteFunction execute) {
+        BeginFrame();
+
+        Pass& pass = m_Passes.emplace_back();
+
+        pass.Name    = std::move(name);
+        pass.Execute = std::move(execute);
+
+        PassBuilder builder(pass);
+        setup(builder);
+
+        assert(pass.ColorAttachments.size() <= s_MaxColorAttachments);
+    }
+
+    void RenderGraph::Export(TextureId texture) {
+        assert(texture < m_Textures.size());
+        m_Textures[texture].IsExported = true;
+    }
+
+    void RenderGraph::Execute() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        BeginFrame();
+
+        m_Statistics = {};
+        m_Statistics.PassCount = static_cast<uint32_t>(m_Passes.size());
+
+        Compile();
+
+        for (uint32_t i = 0; i < m_Passes.size(); ++i) {
+            if (m_Passes[i].IsCulled)
+                continue;
+
+            for (auto& texture : m_Textures)
+                if (texture.FirstPass == i)
+                    texture.PooledTexture = AcquireTexture(texture.Description);
+
+            ExecutePass(m_Passes[i]);
+
+            // Exported textures stay in use until the next frame
+            for (auto& texture : m_Textures)
+                if (texture.LastPass == i && texture.PooledTexture != -1 && !texture.IsExported)
+                    m_TexturePool[texture.PooledTexture].IsInUse = false;
+        }
+
+        RenderState::BindFrameBuffer(0);
+
+        m_Passes.clear();
+        m_IsExecuted = true;
+
+        m_Statistics.TextureCount     = static_cast<uint32_t>(m_TexturePool.size());
+        m_Statistics.FrameBufferCount = static_cast<uint32_t>(m_FrameBufferPool.size());
+    }
+
+    HandleType RenderGraph::GetTextureHandle(TextureId texture) const {
+        assert(texture < m_Textures.size());
+
+        int32_t pooledTexture = m_Textures[texture].PooledTexture;
+
+        return pooledTexture != -1 ? m_TexturePool[pooledTexture].Handle : 0;
+    }
+
+    glm::vec2 RenderGraph::GetTextureScale(TextureId texture) const {
+        assert(texture < m_Textures.size());
+
+        const auto& description = m_Textures[texture].Description;
+
+        return {
+            static_cast<float>(description.Width)  / static_cast<float>(FrameBuffer::GetBucketSize(description.Width)),
+            static_cast<float>(description.Height) / static_cast<float>(FrameBuffer::GetBucketSize(description.Height))
+        };
+    }
+
+    int RenderGraph::ReadPixel(TextureId texture, int x, int y) const {
+        assert(Internal::IsIntegerFormat(m_Textures[texture].Description.Format));
+
+        int pixelData = -1;
+
+        glGetTextureSubImage(GetTextureHandle(texture), 0, x, y, 0, 1, 1, 1, GL_RED_INTEGER, GL_INT, sizeof(pixelData), &pixelData);
+
+        return pixelData;
+    }
+
+    void RenderGraph::ReleaseResources() {
+        for (const auto& texture : m_TexturePool)
+            DeleteTexture(texture);
+
+        m_TexturePool.clear();
+
+        for (const auto& [key, frameBuffer] : m_FrameBufferPool) {
+            RenderState::OnFrameBufferDeleted(frameBuffer.Handle);
+            glDeleteFramebuffers(1, &frameBuffer.Handle);
+        }
+
+        m_FrameBufferPool.clear();
+
+        for (auto& texture : m_Textures)
+            texture.PooledTexture = -1;
+    }
+
+    void RenderGraph::BeginFrame() {
+        if (!m_IsExecuted)
+            return;
+
+        m_IsExecuted = false;
+        ++m_FrameIndex;
+
+        m_Textures.clear();
+
+        for (auto& texture : m_TexturePool)
+            texture.IsInUse = false;
+
+        CollectGarbage();
+    }
+
+    void RenderGraph::Compile() {
+        // Walks back from the exported textures. A texture is needed before a pass when a later pass that runs
+        // reads it, the pass that clears it satisfies the need, the one that loads it passes the need on
+        std::vector<bool> isNeeded(m_Textures.size(), false);
+
+        for (std::size_t i = 0; i < m_Textures.size(); ++i)
+            isNeeded[i] = m_Textures[i].IsExported;
+
+        for (auto pass = m_Passes.rbegin(); pass != m_Passes.rend(); ++pass) {
+            bool isUsed = pass->HasSideEffect;
+
+            pass->IsColorAttachmentUsed.assign(pass->ColorAttachments.size(), false);
+
+            for (std::size_t i = 0; i < pass->ColorAttachments.size(); ++i) {
+                if (isNeeded[pass->ColorAttachments[i].Texture]) {
+                    pass->IsColorAttachmentUsed[i] = true;
+                    isUsed                         = true;
+                }
+            }
+
+            if (pass->DepthAttachment.Texture != s_NullTexture && isNeeded[pass->DepthAttachment.Texture])
+                isUsed = true;
+
+            pass->IsCulled = !isUsed;
+
+            if (pass->IsCulled) {
+                ++m_Statistics.CulledPassCount;
+                continue;
+            }
+
+            for (std::size_t i = 0; i < pass->ColorAttachments.size(); ++i) {
+                const auto& attachment = pass->ColorAttachments[i];
+
+                if (!pass->IsColorAttachmentUsed[i])
+                    ++m_Statistics.CulledAttachments;
+                else if (attachment.Load == LoadOperation::Clear)
+                    isNeeded[attachment.Texture] = false;
+            }
+
+            if (pass->DepthAttachment.Texture != s_NullTexture)
+                isNeeded[pass->DepthAttachment.Texture] = pass->DepthAttachment.Load == LoadOperation::Load;
+
+            for (TextureId texture : pass->Reads)
+                isNeeded[texture] = true;
+        }
+
+        // Lifetimes over the passes that run
+        for (auto& texture : m_Textures) {
+            texture.FirstPass     = std::numeric_limits<uint32_t>::max();
+            texture.LastPass      = 0;
+            texture.PooledTexture = -1;
+        }
+
+        auto use = [this](TextureId texture, uint32_t pass) {
+            m_Textures[texture].FirstPass = std::min(m_Textures[texture].FirstPass, pass);
+            m_Textures[texture].LastPass  = std::max(m_Textures[texture].LastPass,  pass);
+        };
+
+        for (uint32_t i = 0; i < m_Passes.size(); ++i) {
+            const auto& pass = m_Passes[i];
+
+            if (pass.IsCulled)
+                continue;
+
+            for (std::size_t j = 0; j < pass.ColorAttachments.size(); ++j)
+                if (pass.IsColorAttachmentUsed[j])
+                    use(pass.ColorAttachments[j].Texture, i);
+
+            if (pass.DepthAttachment.Texture != s_NullTexture)
+                use(pass.DepthAttachment.Texture, i);
+
+            for (TextureId texture : pass.Reads)
+                use(texture, i);
+        }
+    }
+
+    void RenderGraph::ExecutePass(Pass& pass) {
+        FrameBufferKey key             = {};
+        bool           hasAttachments  = false;
+        TextureId      viewportTexture = s_NullTexture;
+
+        for (std::size_t i = 0; i < pass.ColorAttachments.size(); ++i) {
+            if (!pass.IsColorAttachmentUsed[i])
+                continue;
+
+            key[i]          = GetTextureHandle(pass.ColorAttachments[i].Texture);
+            hasAttachments  = true;
+            viewportTexture = pass.ColorAttachments[i].Texture;
+        }
+
+        if (pass.DepthAttachment.Texture != s_NullTexture) {
+            key[s_MaxColorAttachments] = GetTextureHandle(pass.DepthAttachment.Texture);
+            hasAttachments             = true;
+            viewportTexture            = pass.DepthAttachment.Texture;
+        }
+
+        // Readbacks and the like don't render anything
+        if (!hasAttachments) {
+            pass.Execute();
+            return;
+        }
+
+        HandleType  frameBuffer = AcquireFrameBuffer(key, pass.ColorAttachments.size());
+        const auto& viewport    = m_Textures[viewportTexture].Description;
+
+        // The corner of the bucket sized attachments
+        RenderState::BindFrameBuffer(frameBuffer);
+        RenderState::SetViewport(0, 0, static_cast<int>(viewport.Width), static_cast<int>(viewport.Height));
+
+        for (std::size_t i = 0; i < pass.ColorAttachments.size(); ++i) {
+            const auto& attachment = pass.ColorAttachments[i];
+
+            if (!pass.IsColorAttachmentUsed[i] || attachment.Load != LoadOperation::Clear)
+                continue;
+
+            auto drawBuffer = static_cast<GLint>(i);
+
+            if (Internal::IsIntegerFormat(m_Textures[attachment.Texture].Description.Format)) {
+                auto value = static_cast<GLint>(attachment.ClearValue.x);
+                glClearNamedFramebufferiv(frameBuffer, GL_COLOR, drawBuffer, &value);
+            } else {
+                glClearNamedFramebufferfv(frameBuffer, GL_COLOR, drawBuffer, &attachment.ClearValue.x);
+            }
+
+            ++m_Statistics.Clears;
+        }
+
+        if (pass.DepthAttachment.Texture != s_NullTexture && pass.DepthAttachment.Load == LoadOperation::Clear) {
+            glClearNamedFramebufferfi(frameBuffer, GL_DEPTH_STENCIL, 0, pass.DepthAttachment.ClearValue.x, 0);
+            ++m_Statistics.Clears;
+        }
+
+        pass.Execute();
+    }
+
+    int32_t RenderGraph::AcquireTexture(const TextureDescription& description) {
+        TextureDescription bucket = {
+            FrameBuffer::GetBucketSize(description.Width),
+            FrameBuffer::GetBucketSize(description.Height),
+            description.Format
+        };
+
+        for (std::size_t i = 0; i < m_TexturePool.size(); ++i) {
+            auto& texture = m_TexturePool[i];
+
+            if (texture.IsInUse || texture.Description != bucket)
+                continue;
+
+            // Released by a pass that has already run this frame
+            if (texture.LastUsedFrame == m_FrameIndex)
+                ++m_Statistics.AliasedTextures;
+
+            texture.IsInUse       = true;
+            texture.LastUsedFrame = m_FrameIndex;
+
+            return static_cast<int32_t>(i);
+        }
+
+        m_TexturePool.push_back({ Internal::CreateTexture(bucket), bucket, m_FrameIndex, true });
+        ++m_Statistics.AllocatedTextures;
+
+        return static_cast<int32_t>(m_TexturePool.size() - 1);
+    }
+
+    HandleType RenderGraph::AcquireFrameBuffer(const FrameBufferKey& key, std::size_t colorAttachmentCount) {
+        if (auto it = m_FrameBufferPool.find(key); it != m_FrameBufferPool.end()) {
+            it->second.LastUsedFrame = m_FrameIndex;
+            return it->second.Handle;
+        }
+
+        HandleType handle;
+        glCreateFramebuffers(1, &handle);
+
+        // Left out attachments keep their slot, the fragment outputs of the shaders don't move
+        std::array<GLenum, s_MaxColorAttachments> drawBuffers = {};
+
+        for (std::size_t i = 0; i < colorAttachmentCount; ++i) {
+            drawBuffers[i] = key[i] ? static_cast<GLenum>(GL_COLOR_ATTACHMENT0 + i) : GL_NONE;
+
+            if (key[i])
+                glNamedFramebufferTexture(handle, drawBuffers[i], key[i], 0);
+        }
+
+        if (key[s_MaxColorAttachments])
+            glNamedFramebufferTexture(handle, GL_DEPTH_STENCIL_ATTACHMENT, key[s_MaxColorAttachments], 0);
+
+        if (colorAttachmentCount > 0)
+            glNamedFramebufferDrawBuffers(handle, static_cast<GLsizei>(colorAttachmentCount), drawBuffers.data());
+        else
+            glNamedFramebufferDrawBuffer(handle, GL_NONE);
+
+        assert(glCheckNamedFramebufferStatus(handle, GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
+
+        m_FrameBufferPool[key] = { handle, m_FrameIndex };
+
+        return handle;
+    }
+
+    void RenderGraph::CollectGarbage() {
+        auto isUnused = [this](uint64_t lastUsedFrame) {
+            return m_FrameIndex - lastUsedFrame > s_MaxUnusedFrames;
+        };
+
+        std::erase_if(m_TexturePool, [this, &isUnused](const PooledTexture& texture) {
+            if (!isUnused(texture.LastUsedFrame))
+                return false;
+
+            DeleteTexture(texture);
+
+            return true;
+        });
+
+        std::erase_if(m_FrameBufferPool, [&isUnused](const auto& item) {
+            if (!isUnused(item.second.LastUsedFrame))
+                return false;
+
+            RenderState::OnFrameBufferDeleted(item.second.Handle);
+            glDeleteFramebuffers(1, &item.second.Handle);
+
+            return true;
+        });
+    }
+
+    void RenderGraph::DeleteTexture(const PooledTexture& texture) {
+        // GL reuses the name, a cached framebuffer keyed by it would be found for the next texture
+        std::erase_if(m_FrameBufferPool, [&texture](const auto& item) {
+            if (std::find(item.first.begin(), item.first.end(), texture.Handle) == item.first.end())
+                return false;
+
+            RenderState::OnFrameBufferDeleted(item.second.Handle);
+            glDeleteFramebuffers(1, &item.second.Handle);
+
+            return true;
+        });
+
+        RenderState::OnTextureDeleted(texture.Handle);
+        glDeleteTextures(1, &texture.Handle);
+    }
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,214 @@
+#include "RenderState.hpp"
+
+namespace Ziben {
+
+    void RenderState::Invalidate() {
+        GetData().Reset();
+    }
+
+    void RenderState::UseProgram(HandleType program) {
+        auto& data = GetData();
+
+        if (IsRedundant(data.Program == program))
+            return;
+
+        glUseProgram(program);
+        data.Program = program;
+    }
+
+    void RenderState::BindVertexArray(HandleType vertexArray) {
+        auto& data = GetData();
+
+        if (IsRedundant(data.VertexArray == vertexArray))
+            return;
+
+        glBindVertexArray(vertexArray);
+        data.VertexArray = vertexArray;
+    }
+
+    void RenderState::BindBuffer(GLenum target, HandleType buffer) {
+        auto* binding = GetBuffer(target);
+
+        if (binding && IsRedundant(*binding == buffer))
+            return;
+
+        glBindBuffer(target, buffer);
+
+        if (binding)
+            *binding = buffer;
+    }
+
+    void RenderState::BindBufferBase(GLenum target, uint32_t index, HandleType buffer) {
+        auto* bindings = GetIndexedBindings(target);
+
+        if (bindings && index < bindings->size() && IsRedundant((*bindings)[index] == buffer))
+            return;
+
+        glBindBufferBase(target, index, buffer);
+
+        if (bindings && index < bindings->size())
+            (*bindings)[index] = buffer;
+
+        // The generic binding point is changed too
+        if (auto* binding = GetBuffer(target))
+            *binding = buffer;
+    }
+
+    void RenderState::BindTextureUnit(uint32_t unit, HandleType texture) {
+        auto& data = GetData();
+
+        if (unit < s_MaxTextureUnits && IsRedundant(data.TextureUnits[unit] == texture))
+            return;
+
+        glBindTextureUnit(unit, texture);
+
+        if (unit < s_MaxTextureUnits)
+            data.TextureUnits[unit] = texture;
+    }
+
+    void RenderState::BindFrameBuffer(HandleType frameBuffer) {
+        auto& data = GetData();
+
+        if (IsRedundant(data.FrameBuffer == frameBuffer))
+            return;
+
+        glBindFramebuffer(GL_FRAMEBUFFER, frameBuffer);
+        data.FrameBuffer = frameBuffer;
+    }
+
+    void RenderState::SetBlend(bool isEnabled) {
+        SetFlag(GetData().Blend, GL_BLEND, isEnabled);
+    }
+
+    void RenderState::SetBlendFunc(GLenum source, GLenum destination) {
+        auto& data = GetData();
+
+        if (IsRedundant(data.BlendFunc[0] == source && data.BlendFunc[1] == destination))
+            return;
+
+        glBlendFunc(source, destination);
+        data.BlendFunc = { source, destination };
+    }
+
+    void RenderState::SetDepthTest(bool isEnabled) {
+        SetFlag(GetData().DepthTest, GL_DEPTH_TEST, isEnabled);
+    }
+
+    void RenderState::SetViewport(int x, int y, int width, int height) {
+        auto& data = GetData();
+
+        if (IsRedundant(data.Viewport == std::array<int, 4>{ x, y, width, height }))
+            return;
+
+        glViewport(x, y, width, height);
+        data.Viewport = { x, y, width, height };
+    }
+
+    void RenderState::OnProgramDeleted(HandleType program) {
+        auto& data = GetData();
+
+        if (data.Program == program)
+            data.Program = s_Unknown;
+    }
+
+    void RenderState::OnVertexArrayDeleted(HandleType vertexArray) {
+        auto& data = GetData();
+
+        // Deleting the bound vertex array binds 0
+        if (data.VertexArray == vertexArray)
+            data.VertexArray = 0;
+    }
+
+    void RenderState::OnBufferDeleted(HandleType buffer) {
+        auto& data = GetData();
+
+        // Deleting a bound buffer resets its bindings to 0
+        for (auto* bindings : { &data.UniformBuffers, &data.StorageBuffers })
+            std::replace(bindings->begin(), bindings->end(), buffer, HandleType(0));
+
+        std::replace(data.Buffers.begin(), data.Buffers.end(), buffer, HandleType(0));
+    }
+
+    void RenderState::OnTextureDeleted(HandleType texture) {
+        auto& data = GetData();
+
+        std::replace(data.TextureUnits.begin(), data.TextureUnits.end(), texture, HandleType(0));
+    }
+
+    void RenderState::OnFrameBufferDeleted(HandleType frameBuffer) {
+        auto& data = GetData();
+
+        if (data.FrameBuffer == frameBuffer)
+            data.FrameBuffer = 0;
+    }
+
+    RenderState::Statistics& RenderState::GetStatistics() {
+        static Statistics statistics;
+        return statistics;
+    }
+
+    void RenderState::ResetStatistics() {
+        GetStatistics() = {};
+    }
+
+    void RenderState::Data::Reset() {
+        Program     = s_Unknown;
+        VertexArray = s_Unknown;
+        FrameBuffer = s_Unknown;
+        Blend       = Flag::Unknown;
+        BlendFunc   = { GL_NONE, GL_NONE };
+        DepthTest   = Flag::Unknown;
+        Viewport    = { -1, -1, -1, -1 };
+
+        Buffers.fill(s_Unknown);
+        UniformBuffers.fill(s_Unknown);
+        StorageBuffers.fill(s_Unknown);
+        TextureUnits.fill(s_Unknown);
+    }
+
+    RenderState::Data& RenderState::GetData() {
+        static Data data;
+        return data;
+    }
+
+    RenderState::IndexedBindings* RenderState::GetIndexedBindings(GLenum target) {
+        switch (target) {
+            case GL_UNIFORM_BUFFER:        return &GetData().UniformBuffers;
+            case GL_SHADER_STORAGE_BUFFER: return &GetData().StorageBuffers;
+            default:                       break;
+        }
+
+        return nullptr;
+    }
+
+    HandleType* RenderState::GetBuffer(GLenum target) {
+        auto it = std::find(s_BufferTargets.begin(), s_BufferTargets.end(), target);
+        return it != s_BufferTargets.end() ? &GetData().Buffers[static_cast<std::size_t>(it - s_BufferTargets.begin())] : nullptr;
+    }
+
+    bool RenderState::IsRedundant(bool isSame) {
+        auto& statistics = GetStatistics();
+
+        ++statistics.Calls;
+
+        if (isSame)
+            ++statistics.SkippedCalls;
+
+        return isSame;
+    }
+
+    void RenderState::SetFlag(Flag& flag, GLenum capability, bool isEnabled) {
+        Flag value = isEnabled ? Flag::Enabled : Flag::Disabled;
+
+        if (IsRedundant(flag == value))
+            return;
+
+        if (isEnabled)
+            glEnable(capability);
+        else
+            glDisable(capability);
+
+        flag = value;
+    }
+
+} // namespace Ziben
\ No newline at end of file
@@ -2,6 +2,9 @@
 
 #include "RenderCommand.hpp"
 #include "Renderer2D.hpp"
+#include "MeshQueue.hpp"
+#include "TextureLoader.hpp"
+#include "ShaderReloader.hpp"
 
 namespace Ziben {
 
@@ -9,23 +12,42 @@ namespace Ziben {
         ZIBEN_PROFILE_FUNCTION();
 
         RenderCommand::Init();
+        ShaderReloader::Init();
+
+        // Frame uniforms
+        GetStorage().FrameUniformBuffer = UniformBuffer::Create(sizeof(FrameUniforms));
+        UniformBuffer::Bind(GetStorage().FrameUniformBuffer, s_FrameUniformBinding);
+
         Renderer2D::Init();
+        MeshQueue::Init();
+        TextureLoader::Init();
     }
 
     void Renderer::Shutdown() {
+        TextureLoader::Shutdown();
+        MeshQueue::Shutdown();
         Renderer2D::Shutdown();
+        ShaderReloader::Shutdown();
+
+        GetStorage().FrameUniformBuffer = nullptr;
     }
 
     void Renderer::OnWindowResized(int width, int height) {
         RenderCommand::SetViewport(0, 0, width, height);
     }
 
+    void Renderer::SetFrameUniforms(const FrameUniforms& frameUniforms) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        GetStorage().FrameUniformBuffer->SetData(&frameUniforms, sizeof(frameUniforms));
+    }
+
     void Renderer::BeginScene(const Camera& camera) {
-//        GetStorage().ViewProjectionMatrix = camera.GetViewProjectionMatri();
+//        SetFrameUniforms({ camera.GetViewProjectionMatri() });
     }
 
     void Renderer::BeginScene(const OrthographicCamera& camera) {
-        GetStorage().ViewProjectionMatrix = camera.GetViewProjectionMatrix();
+        SetFrameUniforms({ camera.GetViewProjectionMatrix() });
     }
 
     void Renderer::EndScene() {
@@ -34,8 +56,7 @@ namespace Ziben {
 
     void Renderer::Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform) {
         Shader::Bind(shader);
-        shader->SetUniform("u_ViewProjectionMatrix", GetStorage().ViewProjectionMatrix);
-        shader->SetUniform("u_Transform", transform);
+        shader->SetUniform(GetStorage().TransformUniform, transform);
 
         VertexArray::Bind(vertexArray);
         RenderCommand::DrawIndexed(vertexArray);
@@ -2,8 +2,11 @@
 
 #include <glm/gtc/matrix_transform.hpp>
 
+#include "Renderer.hpp"
 #include "RenderCommand.hpp"
 #include "EditorCamera.hpp"
+#include "AABB.hpp"
+#include "AssetManager.hpp"
 #include "Ziben/Scene/Component.hpp"
 
 namespace Ziben {
@@ -13,14 +16,6 @@ namespace Ziben {
 
         // Quad VertexBuffer
         GetData().QuadVertexBuffer = VertexBuffer::Create(s_MaxVertexCount * sizeof(QuadVertex));
-        GetData().QuadVertexBuffer->SetLayout({
-            { ShaderData::Type::Float3, "VertexPosition" },
-            { ShaderData::Type::Float4, "Color"          },
-            { ShaderData::Type::Float2, "TexCoord"       },
-            { ShaderData::Type::Float,  "TexIndex"       },
-            { ShaderData::Type::Float,  "TilingFactor"   },
-            { ShaderData::Type::Int,    "EntityHandle"   }
-        });
 
         GetData().QuadVertexBufferBase = new QuadVertex[s_MaxVertexCount];
 
@@ -39,14 +34,12 @@ namespace Ziben {
             offset += 4;
         }
 
-        auto quadIndexBuffer = IndexBuffer::Create(quadIndices, s_MaxIndexCount);
+        GetData().QuadIndexBuffer = IndexBuffer::Create(quadIndices, s_MaxIndexCount);
 
         delete[] quadIndices;
 
         // Quad VertexArray
-        GetData().QuadVertexArray = VertexArray::Create();
-        GetData().QuadVertexArray->PushVertexBuffer(GetData().QuadVertexBuffer);
-        GetData().QuadVertexArray->SetIndexBuffer(quadIndexBuffer);
+        GetData().QuadVertexArray = CreateQuadVertexArray(GetData().QuadVertexBuffer);
 
         // White Texture
         uint32_t whiteTextureData = 0xffffffff;
@@ -55,14 +48,42 @@ namespace Ziben {
         GetData().WhiteTexture->SetData(&whiteTextureData, sizeof(whiteTextureData));
 
         // Texture Shader
-        std::array<int, s_MaxTextureSlots> samples = { 0 };
-        std::iota(samples.begin(), samples.end(), 0);
+        GetData().Mode = GLEW_ARB_bindless_texture ? TextureMode::Bindless : TextureMode::Slots;
+
+        if (GetData().Mode == TextureMode::Bindless) {
+            Shader::Bind(GetData().TextureShader = AssetManager::LoadShader("Assets/Shaders/TextureShaderBindless.glsl"));
+
+            // Index 0 is always the WhiteTexture, retained quads rely on it
+            uint64_t whiteTextureHandle = GetData().WhiteTexture->GetBindlessHandle();
+
+            GetData().TextureHandleBuffer = StorageBuffer::Create(s_MaxBindlessTextures * sizeof(uint64_t));
+            GetData().TextureHandleBuffer->SetData(&whiteTextureHandle, sizeof(whiteTextureHandle));
 
-        Shader::Bind(GetData().TextureShader = Shader::Create("Assets/Shaders/TextureShader.glsl"));
-        GetData().TextureShader->SetUniform("u_Textures", samples.data(), samples.size());
+            GetData().TextureHandles.reserve(s_MaxBindlessTextures);
+            GetData().BindlessTextures.reserve(s_MaxBindlessTextures);
+        } else {
+            std::array<int, s_TextureArraySlot> samples = { 0 };
+            std::iota(samples.begin(), samples.end(), 0);
+
+            Shader::Bind(GetData().TextureShader = AssetManager::LoadShader("Assets/Shaders/TextureShader.glsl"));
+            GetData().TextureShader->SetUniform("u_Textures", samples.data(), samples.size());
+        }
+
+        GetData().TextureShader->SetUniform("u_TextureArray", static_cast<int>(s_TextureArraySlot));
+
+        GetStatistics().CurrentTextureMode = GetData().Mode;
+        ZIBEN_CORE_INFO("Renderer2D: {0} texture mode", GetTextureModeName(GetData().Mode));
 
         // TextureSlots
         GetData().TextureSlots.front() = GetData().WhiteTexture;
+
+        // Tilemap
+        GetData().TilemapVertexBuffer = VertexBuffer::Create(4 * sizeof(QuadVertex));
+        GetData().TilemapVertexArray  = CreateQuadVertexArray(GetData().TilemapVertexBuffer);
+
+        Shader::Bind(GetData().TilemapShader = AssetManager::LoadShader("Assets/Shaders/TilemapShader.glsl"));
+        GetData().TilemapShader->SetUniform("u_Tiles", 0);
+        GetData().TilemapShader->SetUniform("u_Tileset", 1);
     }
 
     void Renderer2D::Shutdown() {
@@ -74,11 +95,12 @@ namespace Ziben {
     void Renderer2D::BeginScene(const Camera& camera, const glm::mat4& transform) {
         ZIBEN_PROFILE_FUNCTION();
 
-        Shader::Bind(GetData().TextureShader);
-        GetData().TextureShader->SetUniform(
-            "u_ViewProjectionMatrix",
-            camera.GetProjectionMatrix() * glm::inverse(transform)
-        );
+        glm::mat4 viewProjection = camera.GetProjectionMatrix() * glm::inverse(transform);
+
+        Renderer::SetFrameUniforms({ viewProjection });
+
+        GetData().CameraFrustum              = Frustum(viewProjection);
+        GetData().CameraViewProjectionMatrix = viewProjection;
 
         StartBatch();
     }
@@ -86,8 +108,10 @@ namespace Ziben {
     void Renderer2D::BeginScene(const EditorCamera& camera) {
         ZIBEN_PROFILE_FUNCTION();
 
-        Shader::Bind(GetData().TextureShader);
-        GetData().TextureShader->SetUniform("u_ViewProjectionMatrix", camera.GetViewProjectionMatrix());
+        Renderer::SetFrameUniforms({ camera.GetViewProjectionMatrix() });
+
+        GetData().CameraFrustum              = Frustum(camera.GetViewProjectionMatrix());
+        GetData().CameraViewProjectionMatrix = camera.GetViewProjectionMatrix();
 
         StartBatch();
     }
@@ -95,8 +119,10 @@ namespace Ziben {
     void Renderer2D::BeginScene(const OrthographicCamera& camera) {
         ZIBEN_PROFILE_FUNCTION();
 
-        Shader::Bind(GetData().TextureShader);
-        GetData().TextureShader->SetUniform("u_ViewProjectionMatrix", camera.GetViewProjectionMatrix());
+        Renderer::SetFrameUniforms({ camera.GetViewProjectionMatrix() });
+
+        GetData().CameraFrustum              = Frustum(camera.GetViewProjectionMatrix());
+        GetData().CameraViewProjectionMatrix = camera.GetViewProjectionMatrix();
 
         StartBatch();
     }
@@ -105,25 +131,34 @@ namespace Ziben {
         ZIBEN_PROFILE_FUNCTION();
 
         Flush();
-
-        std::fill(GetData().QuadVertexBufferBase, GetData().QuadVertexBufferBase + s_MaxVertexCount, QuadVertex());
     }
 
     void Renderer2D::Flush() {
         if (GetData().QuadIndexCount == 0)
             return;
 
+        // Only the written part of the batch is uploaded
         GetData().QuadVertexBuffer->SetData(
             GetData().QuadVertexBufferBase,
-            s_MaxVertexCount * sizeof(QuadVertex)
-//            (uint8_t*)GetData().QuadVertexBufferPointer - (uint8_t*)GetData().QuadVertexBufferBase
+            (uint8_t*)GetData().QuadVertexBufferPointer - (uint8_t*)GetData().QuadVertexBufferBase
         );
 
         // Bind Textures
-        for (uint32_t i = 0; i < GetData().TextureSlotIndex; ++i)
-            Texture2D::Bind(GetData().TextureSlots[i], i);
+        if (GetData().Mode == TextureMode::Bindless) {
+            GetData().TextureHandleBuffer->SetData(GetData().TextureHandles.data(), GetData().TextureHandles.size() * sizeof(uint64_t));
+            StorageBuffer::Bind(GetData().TextureHandleBuffer, s_HandleBufferBinding);
+        } else {
+            for (uint32_t i = 0; i < GetData().TextureSlotIndex; ++i)
+                Texture2D::Bind(GetData().TextureSlots[i], i);
+        }
+
+        if (GetData().TextureArray)
+            Texture2DArray::Bind(GetData().TextureArray, s_TextureArraySlot);
 
         Shader::Bind(GetData().TextureShader);
+        GetData().TextureShader->SetUniform(GetData().MipBiasUniform, GetData().MipBias);
+
+        VertexArray::Bind(GetData().QuadVertexArray);
         RenderCommand::DrawIndexed(GetData().QuadVertexArray, GetData().QuadIndexCount);
 
         ++GetStatistics().DrawCalls;
@@ -203,22 +238,7 @@ namespace Ziben {
         if (GetData().QuadIndexCount >= s_MaxIndexCount)
             NextBatch();
 
-        uint32_t textureIndex;
-
-        auto texturePosition = std::find_if(
-            GetData().TextureSlots.begin(),
-            GetData().TextureSlots.begin() + GetData().TextureSlotIndex,
-            [&](const Ref<Texture2D>& textureSlot) {
-                return *textureSlot == *texture;
-            }
-        );
-
-        if (texturePosition != GetData().TextureSlots.begin() + GetData().TextureSlotIndex) {
-            textureIndex = std::distance(GetData().TextureSlots.begin(), texturePosition);
-        } else {
-            textureIndex                                         = GetData().TextureSlotIndex;
-            GetData().TextureSlots[GetData().TextureSlotIndex++] = texture;
-        }
+        uint32_t textureIndex = GetTextureIndex(texture);
 
         glm::mat4 translation = glm::translate(glm::mat4(1.0f), position);
         glm::mat4 scaling     = glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
@@ -304,22 +324,7 @@ namespace Ziben {
         if (GetData().QuadIndexCount >= s_MaxIndexCount)
             NextBatch();
 
-        uint32_t textureIndex;
-
-        auto texturePosition = std::find_if(
-            GetData().TextureSlots.begin(),
-            GetData().TextureSlots.begin() + GetData().TextureSlotIndex,
-            [&](const Ref<Texture2D>& textureSlot) {
-                return *textureSlot == *subTexture->GetTexture();
-            }
-        );
-
-        if (texturePosition != GetData().TextureSlots.begin() + GetData().TextureSlotIndex) {
-            textureIndex = std::distance(GetData().TextureSlots.begin(), texturePosition);
-        } else {
-            textureIndex                                         = GetData().TextureSlotIndex;
-            GetData().TextureSlots[GetData().TextureSlotIndex++] = subTexture->GetTexture();
-        }
+        uint32_t textureIndex = GetTextureIndex(subTexture->GetTexture());
 
         glm::mat4 translation = glm::translate(glm::mat4(1.0f), position);
         glm::mat4 scaling     = glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
@@ -367,22 +372,7 @@ namespace Ziben {
         if (GetData().QuadIndexCount >= s_MaxIndexCount)
             NextBatch();
 
-        uint32_t textureIndex;
-
-        auto texturePosition = std::find_if(
-            GetData().TextureSlots.begin(),
-            GetData().TextureSlots.begin() + GetData().TextureSlotIndex,
-            [&](const Ref<Texture2D>& textureSlot) {
-                return *textureSlot == *texture;
-            }
-        );
-
-        if (texturePosition != GetData().TextureSlots.begin() + GetData().TextureSlotIndex) {
-            textureIndex = std::distance(GetData().TextureSlots.begin(), texturePosition);
-        } else {
-            textureIndex                                         = GetData().TextureSlotIndex;
-            GetData().TextureSlots[GetData().TextureSlotIndex++] = texture;
-        }
+        uint32_t textureIndex = GetTextureIndex(texture);
 
         for (uint32_t i = 0; i < 4; ++i) {
             GetData().QuadVertexBufferPointer->Position     = transform * s_QuadVertexPositions[i];
@@ -399,6 +389,35 @@ namespace Ziben {
         ++GetStatistics().QuadCount;
     }
 
+    void Renderer2D::DrawQuad(
+        const glm::mat4&           transform,
+        const Ref<Texture2DArray>& textureArray,
+        uint32_t                   layer,
+        const glm::vec4&           tintColor,
+        int                        entityHandle
+    ) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        if (GetData().QuadIndexCount >= s_MaxIndexCount || (GetData().TextureArray && *GetData().TextureArray != *textureArray))
+            NextBatch();
+
+        GetData().TextureArray = textureArray;
+
+        for (uint32_t i = 0; i < 4; ++i) {
+            GetData().QuadVertexBufferPointer->Position     = transform * s_QuadVertexPositions[i];
+            GetData().QuadVertexBufferPointer->Color        = tintColor;
+            GetData().QuadVertexBufferPointer->TexCoord     = s_QuadTexCoords[i];
+            GetData().QuadVertexBufferPointer->TexIndex     = -1.0f - static_cast<float>(layer); // Negative indices are array layers
+            GetData().QuadVertexBufferPointer->TilingFactor = 1.0f;
+            GetData().QuadVertexBufferPointer->EntityHandle = entityHandle;
+            GetData().QuadVertexBufferPointer++;
+        }
+
+        GetData().QuadIndexCount += 6;
+
+        ++GetStatistics().QuadCount;
+    }
+
     void Renderer2D::DrawRotatedQuad(
         const glm::vec2& position,
         const glm::vec2& size,
@@ -499,22 +518,7 @@ namespace Ziben {
         if (GetData().QuadIndexCount >= s_MaxIndexCount)
             NextBatch();
 
-        uint32_t textureIndex;
-
-        auto texturePosition = std::find_if(
-            GetData().TextureSlots.begin(),
-            GetData().TextureSlots.begin() + GetData().TextureSlotIndex,
-            [&](const Ref<Texture2D>& textureSlot) {
-                return *textureSlot == *texture;
-            }
-        );
-
-        if (texturePosition != GetData().TextureSlots.begin() + GetData().TextureSlotIndex) {
-            textureIndex = std::distance(GetData().TextureSlots.begin(), texturePosition);
-        } else {
-            textureIndex                                         = GetData().TextureSlotIndex;
-            GetData().TextureSlots[GetData().TextureSlotIndex++] = texture;
-        }
+        uint32_t textureIndex = GetTextureIndex(texture);
 
         glm::mat4 translation = glm::translate(glm::mat4(1.0f), position);
         glm::mat4 rotation    = glm::rotate(glm::mat4(1.0f), angle, { 0.0f, 0.0f, 1.0f });
@@ -543,14 +547,160 @@ namespace Ziben {
         DrawQuad(transform, GetData().WhiteTexture, spriteRendererComponent.Color, 1.0f, entityHandle);
     }
 
+    uint32_t Renderer2D::CullQuads(const glm::mat4* transforms, std::size_t count, uint8_t* isVisible) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        AABBBatch batch;
+        uint32_t  visibleCount = 0;
+
+        for (std::size_t offset = 0; offset < count; offset += AABBBatch::Capacity) {
+            auto batchSize = std::min(count - offset, AABBBatch::Capacity);
+
+            // World-space bounds of the [-0.5, 0.5] quad, local z is always 0
+            for (std::size_t i = 0; i < batchSize; ++i) {
+                const auto& transform = transforms[offset + i];
+
+                batch.CenterX[i] = transform[3].x;
+                batch.CenterY[i] = transform[3].y;
+                batch.CenterZ[i] = transform[3].z;
+                batch.ExtentX[i] = 0.5f * (std::abs(transform[0].x) + std::abs(transform[1].x));
+                batch.ExtentY[i] = 0.5f * (std::abs(transform[0].y) + std::abs(transform[1].y));
+                batch.ExtentZ[i] = 0.5f * (std::abs(transform[0].z) + std::abs(transform[1].z));
+            }
+
+            visibleCount += GetData().CameraFrustum.Cull(batch, batchSize, isVisible + offset);
+        }
+
+        GetStatistics().SubmittedQuadCount += static_cast<uint32_t>(count);
+        GetStatistics().CulledQuadCount    += static_cast<uint32_t>(count) - visibleCount;
+
+        return visibleCount;
+    }
+
+    const Frustum& Renderer2D::GetCameraFrustum() {
+        return GetData().CameraFrustum;
+    }
+
+    const glm::mat4& Renderer2D::GetCameraViewProjectionMatrix() {
+        return GetData().CameraViewProjectionMatrix;
+    }
+
+    void Renderer2D::SetMipBias(float mipBias) {
+        GetData().MipBias = mipBias;
+    }
+
+    float Renderer2D::GetMipBias() {
+        return GetData().MipBias;
+    }
+
+    void Renderer2D::BuildQuadVertices(const glm::mat4& transform, const glm::vec4& color, int entityHandle, QuadVertex* vertices) {
+        for (uint32_t i = 0; i < 4; ++i) {
+            vertices[i].Position     = transform * s_QuadVertexPositions[i];
+            vertices[i].Color        = color;
+            vertices[i].TexCoord     = s_QuadTexCoords[i];
+            vertices[i].TexIndex     = 0.0f; // WhiteTexture
+            vertices[i].TilingFactor = 1.0f;
+            vertices[i].EntityHandle = entityHandle;
+        }
+    }
+
+    Ref<VertexArray> Renderer2D::CreateQuadVertexArray(const Ref<VertexBuffer>& vertexBuffer) {
+        assert(vertexBuffer->GetSize() <= s_MaxVertexCount * sizeof(QuadVertex));
+
+        vertexBuffer->SetLayout({
+            { ShaderData::Type::Float3, "VertexPosition" },
+            { ShaderData::Type::Float4, "Color"          },
+            { ShaderData::Type::Float2, "TexCoord"       },
+            { ShaderData::Type::Float,  "TexIndex"       },
+            { ShaderData::Type::Float,  "TilingFactor"   },
+            { ShaderData::Type::Int,    "EntityHandle"   }
+        });
+
+        auto vertexArray = VertexArray::Create();
+        vertexArray->PushVertexBuffer(vertexBuffer);
+        vertexArray->SetIndexBuffer(GetData().QuadIndexBuffer);
+
+        return vertexArray;
+    }
+
+    void Renderer2D::DrawQuadVertexArray(const Ref<VertexArray>& vertexArray, uint32_t quadCount) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        if (quadCount == 0)
+            return;
+
+        if (GetData().Mode == TextureMode::Bindless)
+            StorageBuffer::Bind(GetData().TextureHandleBuffer, s_HandleBufferBinding);
+        else
+            Texture2D::Bind(GetData().WhiteTexture, 0);
+
+        Shader::Bind(GetData().TextureShader);
+        GetData().TextureShader->SetUniform(GetData().MipBiasUniform, GetData().MipBias);
+
+        VertexArray::Bind(vertexArray);
+        RenderCommand::DrawIndexed(vertexArray, quadCount * 6);
+
+        ++GetStatistics().DrawCalls;
+        GetStatistics().QuadCount       += quadCount;
+        GetStatistics().StaticQuadCount += quadCount;
+    }
+
+    void Renderer2D::DrawTilemap(
+        const glm::mat4&      transform,
+        const Ref<Texture2D>& tiles,
+        const Ref<Texture2D>& tileset,
+        const glm::vec2&      tilesetGrid,
+        const glm::vec4&      color,
+        int                   entityHandle
+    ) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        AABB bounds = AABB::FromQuad(transform);
+
+        if (!GetData().CameraFrustum.Intersects(bounds.GetCenter(), bounds.GetExtents()))
+            return;
+
+        std::array<QuadVertex, 4> vertices;
+        BuildQuadVertices(transform, color, entityHandle, vertices.data());
+        GetData().TilemapVertexBuffer->SetData(vertices.data(), sizeof(vertices));
+
+        Texture2D::Bind(tiles, 0);
+        Texture2D::Bind(tileset, 1);
+
+        Shader::Bind(GetData().TilemapShader);
+        GetData().TilemapShader->SetUniform(GetData().TilesetGridUniform, tilesetGrid);
+
+        VertexArray::Bind(GetData().TilemapVertexArray);
+        RenderCommand::DrawIndexed(GetData().TilemapVertexArray, 6);
+
+        ++GetStatistics().DrawCalls;
+        ++GetStatistics().TilemapCount;
+    }
+
     Renderer2D::Statistics& Renderer2D::GetStatistics() {
         static Renderer2D::Statistics statistics;
         return statistics;
     }
 
+    const char* Renderer2D::GetTextureModeName(TextureMode textureMode) {
+        switch (textureMode) {
+            case TextureMode::Slots:    return "Slots";
+            case TextureMode::Bindless: return "Bindless";
+        }
+
+        return "Unknown";
+    }
+
     void Renderer2D::ResetStatistics() {
-        GetStatistics().DrawCalls = 0;
-        GetStatistics().QuadCount = 0;
+        GetStatistics().DrawCalls           = 0;
+        GetStatistics().QuadCount           = 0;
+        GetStatistics().SubmittedQuadCount  = 0;
+        GetStatistics().CulledQuadCount     = 0;
+        GetStatistics().StaticQuadCount     = 0;
+        GetStatistics().StaticChunkUploads  = 0;
+        GetStatistics().TilemapCount        = 0;
+        GetStatistics().TilemapChunkUploads = 0;
+        GetStatistics().TextureSlotFlushes  = 0;
     }
 
     Renderer2D::Data& Renderer2D::GetData() {
@@ -562,6 +712,53 @@ namespace Ziben {
         GetData().QuadIndexCount          = 0;
         GetData().TextureSlotIndex        = 1;
         GetData().QuadVertexBufferPointer = GetData().QuadVertexBufferBase;
+        GetData().TextureArray            = nullptr;
+
+        if (GetData().Mode == TextureMode::Bindless) {
+            GetData().TextureHandles.assign(1, GetData().WhiteTexture->GetBindlessHandle());
+            GetData().BindlessTextures.assign(1, GetData().WhiteTexture);
+            GetData().BindlessTextureIndices.clear();
+            GetData().BindlessTextureIndices.emplace(GetData().WhiteTexture->GetHandle(), 0);
+        }
+    }
+
+    uint32_t Renderer2D::GetTextureIndex(const Ref<Texture2D>& texture) {
+        if (GetData().Mode == TextureMode::Bindless) {
+            if (auto it = GetData().BindlessTextureIndices.find(texture->GetHandle()); it != GetData().BindlessTextureIndices.end())
+                return it->second;
+
+            if (GetData().TextureHandles.size() == s_MaxBindlessTextures) {
+                NextBatch();
+                ++GetStatistics().TextureSlotFlushes;
+            }
+
+            auto index = static_cast<uint32_t>(GetData().TextureHandles.size());
+
+            GetData().BindlessTextureIndices.emplace(texture->GetHandle(), index);
+            GetData().TextureHandles.push_back(texture->GetBindlessHandle());
+            GetData().BindlessTextures.push_back(texture);
+
+            return index;
+        }
+
+        auto end             = GetData().TextureSlots.begin() + GetData().TextureSlotIndex;
+        auto texturePosition = std::find_if(GetData().TextureSlots.begin(), end, [&](const Ref<Texture2D>& textureSlot) {
+            return *textureSlot == *texture;
+        });
+
+        if (texturePosition != end)
+            return static_cast<uint32_t>(std::distance(GetData().TextureSlots.begin(), texturePosition));
+
+        // Every slot is taken, the batch is flushed only because of the texture count.
+        // The last slot belongs to the texture array
+        if (GetData().TextureSlotIndex == s_TextureArraySlot) {
+            NextBatch();
+            ++GetStatistics().TextureSlotFlushes;
+        }
+
+        GetData().TextureSlots[GetData().TextureSlotIndex] = texture;
+
+        return GetData().TextureSlotIndex++;
     }
 
     void Renderer2D::NextBatch() {
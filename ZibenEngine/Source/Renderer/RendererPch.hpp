@@ -1,16 +1,30 @@
 #pragma once
 
 #include <vector>
+#include <array>
 #include <map>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
 
 #include <cstdint>
 #include <fstream>
 #include <filesystem>
 #include <string>
+#include <string_view>
+#include <charconv>
+#include <bit>
 #include <unordered_map>
 #include <numeric>
 #include <algorithm>
+#include <functional>
+#include <cmath>
 #include <cassert>
+#include <cstring>
+#include <limits>
 
 #include "Ziben/Profiling/ProfileEngine.hpp"
 #include "Ziben/System/Log.hpp"
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include "Ziben/System/Log.hpp"
+#include "AssetManager.hpp"
+#include "RenderState.hpp"
 
 namespace Ziben {
 
@@ -55,39 +57,168 @@ namespace Ziben {
             return types.contains(type) ? types.at(type) : ShaderType::None;
         }
 
-        static std::map<ShaderType, std::string> PreProcessShader(const std::string& shaderSource) {
-            ZIBEN_PROFILE_FUNCTION();
+        static bool IsProgramBinarySupported() {
+            static const bool isSupported = [] {
+                int formatCount = 0;
+                glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
 
-            using namespace std::string_literals;
+                return formatCount > 0;
+            }();
 
-            std::map<ShaderType, std::string> result;
+            return isSupported;
+        }
 
-            auto token    = "#type"s;
-            auto position = shaderSource.find(token, 0);
+        static uint64_t GetDriverHash() {
+            // A binary is only valid for the driver that produced it, any update changes the version string
+            static const uint64_t hash = [] {
+                std::string driver;
 
-            while (position != std::string::npos) {
-                auto eol   = shaderSource.find_first_of("\r\n", position);
-                auto begin = position + token.size() + 1;
+                for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION, GL_SHADING_LANGUAGE_VERSION }) {
+                    if (const auto* string = glGetString(name))
+                        driver += reinterpret_cast<const char*>(string);
 
-                assert(eol != std::string::npos);
+                    driver += '\n';
+                }
 
-                auto type       = shaderSource.substr(begin, eol - begin);
-                auto shaderType = GetShaderTypeFromString(type);
+                return AssetManager::HashData(driver.data(), driver.size());
+            }();
 
-                assert(shaderType != ShaderType::None);
+            return hash;
+        }
 
-                auto nextLinePosition = shaderSource.find_first_not_of("\r\n", eol);
+        static uint64_t GetBinaryHash(const std::string& source) {
+            if (!IsProgramBinarySupported())
+                return 0;
+
+            std::array<uint64_t, 2> hashes = {
+                AssetManager::HashData(source.data(), source.size()),
+                GetDriverHash()
+            };
 
-                assert(nextLinePosition != std::string::npos);
+            return AssetManager::HashData(hashes.data(), sizeof(hashes));
+        }
 
-                position = shaderSource.find(token, nextLinePosition);
+        static int GetUniformComponentCount(GLenum type, bool& isInteger) {
+            isInteger = false;
+
+            switch (type) {
+                case GL_FLOAT:                          return 1;
+                case GL_FLOAT_VEC2:                     return 2;
+                case GL_FLOAT_VEC3:                     return 3;
+                case GL_FLOAT_VEC4:                     return 4;
+                case GL_FLOAT_MAT3:                     return 9;
+                case GL_FLOAT_MAT4:                     return 16;
+                default:                                break;
+            }
 
-                result[shaderType] = position == std::string::npos                                     ?
-                                     shaderSource.substr(nextLinePosition)                             :
-                                     shaderSource.substr(nextLinePosition, position - nextLinePosition);
+            isInteger = true;
+
+            switch (type) {
+                case GL_INT:
+                case GL_BOOL:
+                case GL_SAMPLER_1D:
+                case GL_SAMPLER_2D:
+                case GL_SAMPLER_3D:
+                case GL_SAMPLER_CUBE:
+                case GL_SAMPLER_2D_SHADOW:
+                case GL_SAMPLER_2D_ARRAY:
+                case GL_INT_SAMPLER_2D:
+                case GL_INT_SAMPLER_2D_ARRAY:
+                case GL_UNSIGNED_INT_SAMPLER_2D:
+                case GL_UNSIGNED_INT_SAMPLER_2D_ARRAY:  return 1;
+                case GL_INT_VEC2:
+                case GL_BOOL_VEC2:                      return 2;
+                case GL_INT_VEC3:
+                case GL_BOOL_VEC3:                      return 3;
+                case GL_INT_VEC4:
+                case GL_BOOL_VEC4:                      return 4;
+                default:                                break;
             }
 
-            return result;
+            return 0;
+        }
+
+        // Values of the default block uniforms both programs have, samplers keep their texture units
+        static void CopyUniforms(HandleType source, HandleType destination) {
+            ZIBEN_PROFILE_FUNCTION();
+
+            int uniformCount  = 0;
+            int maxNameLength = 0;
+
+            glGetProgramInterfaceiv(source, GL_UNIFORM, GL_ACTIVE_RESOURCES, &uniformCount);
+            glGetProgramInterfaceiv(source, GL_UNIFORM, GL_MAX_NAME_LENGTH, &maxNameLength);
+
+            constexpr std::array<GLenum, 3> properties = { GL_BLOCK_INDEX, GL_TYPE, GL_ARRAY_SIZE };
+
+            std::string name(static_cast<std::size_t>(maxNameLength), '\0');
+
+            for (int i = 0; i < uniformCount; ++i) {
+                std::array<int, 3> values = {};
+
+                glGetProgramResourceiv(
+                    source,
+                    GL_UNIFORM,
+                    static_cast<GLuint>(i),
+                    static_cast<GLsizei>(properties.size()),
+                    properties.data(),
+                    static_cast<GLsizei>(values.size()),
+                    nullptr,
+                    values.data()
+                );
+
+                bool isInteger;
+                int  componentCount = GetUniformComponentCount(static_cast<GLenum>(values[1]), isInteger);
+
+                if (values[0] != -1 || componentCount == 0)
+                    continue;
+
+                int length = 0;
+                glGetProgramResourceName(source, GL_UNIFORM, static_cast<GLuint>(i), maxNameLength, &length, name.data());
+
+                std::string baseName(name.data(), static_cast<std::size_t>(length));
+
+                if (baseName.ends_with("[0]"))
+                    baseName.resize(baseName.size() - 3);
+
+                for (int element = 0; element < values[2]; ++element) {
+                    auto elementName         = values[2] > 1 ? baseName + '[' + std::to_string(element) + ']' : baseName;
+                    int  sourceLocation      = glGetUniformLocation(source, elementName.c_str());
+                    int  destinationLocation = glGetUniformLocation(destination, elementName.c_str());
+
+                    if (sourceLocation < 0 || destinationLocation < 0)
+                        continue;
+
+                    if (isInteger) {
+                        std::array<int, 4> value = {};
+                        glGetUniformiv(source, sourceLocation, value.data());
+
+                        switch (componentCount) {
+                            case 1: glProgramUniform1iv(destination, destinationLocation, 1, value.data()); break;
+                            case 2: glProgramUniform2iv(destination, destinationLocation, 1, value.data()); break;
+                            case 3: glProgramUniform3iv(destination, destinationLocation, 1, value.data()); break;
+                            case 4: glProgramUniform4iv(destination, destinationLocation, 1, value.data()); break;
+                            default: break;
+                        }
+                    } else {
+                        std::array<float, 16> value = {};
+                        glGetUniformfv(source, sourceLocation, value.data());
+
+                        switch (componentCount) {
+                            case 1:  glProgramUniform1fv(destination, destinationLocation, 1, value.data());                  break;
+                            case 2:  glProgramUniform2fv(destination, destinationLocation, 1, value.data());                  break;
+                            case 3:  glProgramUniform3fv(destination, destinationLocation, 1, value.data());                  break;
+                            case 4:  glProgramUniform4fv(destination, destinationLocation, 1, value.data());                  break;
+                            case 9:  glProgramUniformMatrix3fv(destination, destinationLocation, 1, GL_FALSE, value.data()); break;
+                            case 16: glProgramUniformMatrix4fv(destination, destinationLocation, 1, GL_FALSE, value.data()); break;
+                            default: break;
+                        }
+                    }
+                }
+            }
+        }
+
+        static inline float GetMillisecondsSince(std::chrono::steady_clock::time_point begin) {
+            return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
         }
 
     } // namespace Internal
@@ -102,27 +233,92 @@ namespace Ziben {
         if (!shader->m_IsLinked)
             shader->Link();
 
-        glUseProgram(shader->m_Handle);
+        RenderState::UseProgram(shader->m_Handle);
     }
 
     void Shader::Unbind() {
         ZIBEN_PROFILE_FUNCTION();
 
-        glUseProgram(0);
+        RenderState::UseProgram(0);
+    }
+
+    UniformId Shader::GetUniformId(std::string_view name) {
+        static std::map<std::string, UniformId, std::less<>> uniformIds;
+
+        if (auto it = uniformIds.find(name); it != uniformIds.end())
+            return it->second;
+
+        auto id = static_cast<UniformId>(uniformIds.size());
+        uniformIds.emplace(name, id);
+
+        return id;
+    }
+
+    bool Shader::PreProcess(const std::string& shaderSource, std::map<ShaderType, std::string>& sources) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        using namespace std::string_literals;
+
+        sources.clear();
+
+        auto token    = "#type"s;
+        auto position = shaderSource.find(token, 0);
+
+        while (position != std::string::npos) {
+            auto eol   = shaderSource.find_first_of("\r\n", position);
+            auto begin = position + token.size() + 1;
+
+            if (eol == std::string::npos || begin > eol)
+                return false;
+
+            auto type       = shaderSource.substr(begin, eol - begin);
+            auto shaderType = Internal::GetShaderTypeFromString(type);
+
+            if (shaderType == ShaderType::None)
+                return false;
+
+            auto nextLinePosition = shaderSource.find_first_not_of("\r\n", eol);
+
+            if (nextLinePosition == std::string::npos)
+                return false;
+
+            position = shaderSource.find(token, nextLinePosition);
+
+            sources[shaderType] = position == std::string::npos                                     ?
+                                  shaderSource.substr(nextLinePosition)                             :
+                                  shaderSource.substr(nextLinePosition, position - nextLinePosition);
+        }
+
+        return !sources.empty();
+    }
+
+    Shader::Statistics& Shader::GetStatistics() {
+        static Statistics statistics;
+        return statistics;
     }
 
     Shader::Shader(const std::string& filepath)
         : m_Handle(0)
-        , m_IsLinked(false) {
+        , m_IsLinked(false)
+        , m_BinaryHash(0) {
 
         ZIBEN_PROFILE_FUNCTION();
 
-        auto source  = Internal::ReadFile(filepath);
-        auto sources = Internal::PreProcessShader(source);
+        auto source = Internal::ReadFile(filepath);
 
-        Compile(sources);
+        m_Name       = Internal::GetFileName(filepath);
+        m_Filepath   = filepath;
+        m_BinaryHash = Internal::GetBinaryHash(source);
+
+        if (m_BinaryHash != 0 && LoadBinary())
+            return;
+
+        std::map<ShaderType, std::string> sources;
+
+        if (!PreProcess(source, sources))
+            throw std::runtime_error(filepath + ": malformed #type directives!");
 
-        m_Name = Internal::GetFileName(filepath);
+        Compile(sources);
     }
 
     Shader::~Shader() {
@@ -131,21 +327,29 @@ namespace Ziben {
         if (m_Handle == 0)
             return;
 
+        RenderState::OnProgramDeleted(m_Handle);
         glDeleteProgram(m_Handle);
     }
 
     void Shader::Compile(const std::map<ShaderType, std::string>& sources) {
         ZIBEN_PROFILE_FUNCTION();
 
+        auto begin = std::chrono::steady_clock::now();
+
         if (m_Handle == 0) {
             m_Handle = glCreateProgram();
 
             if (m_Handle == 0)
                 throw std::runtime_error("Unable to create shader program!");
+
+            if (m_BinaryHash != 0)
+                glProgramParameteri(m_Handle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
         }
 
         for (const auto& [type, source] : sources)
             Compile(type, source);
+
+        GetStatistics().CompileMilliseconds += Internal::GetMillisecondsSince(begin);
     }
 
     void Shader::BindAttribLocation(uint32_t location, const std::string& name) const {
@@ -158,71 +362,80 @@ namespace Ziben {
             glBindFragDataLocation(m_Handle, location, name.c_str());
     }
 
-    void Shader::SetUniform(const std::string& name, bool value) {
-        ZIBEN_PROFILE_FUNCTION();
-
-        glUniform1i(GetUniformLocation(name), value);
+    void Shader::SetUniform(UniformId id, bool value) const {
+        glUniform1i(GetUniformLocation(id), value);
     }
 
-    void Shader::SetUniform(const std::string& name, int value) {
-        ZIBEN_PROFILE_FUNCTION();
-
-        glUniform1i(GetUniformLocation(name), value);
+    void Shader::SetUniform(UniformId id, int value) const {
+        glUniform1i(GetUniformLocation(id), value);
     }
 
-    void Shader::SetUniform(const std::string& name, int* values, uint32_t count) {
-        ZIBEN_PROFILE_FUNCTION();
+    void Shader::SetUniform(UniformId id, const int* values, uint32_t count) const {
+        glUniform1iv(GetUniformLocation(id), static_cast<GLsizei>(count), values);
+    }
 
-        glUniform1iv(GetUniformLocation(name), static_cast<GLsizei>(count), values);
+    void Shader::SetUniform(UniformId id, float value) const {
+        glUniform1f(GetUniformLocation(id), value);
     }
 
-    void Shader::SetUniform(const std::string& name, float value) {
-        ZIBEN_PROFILE_FUNCTION();
+    void Shader::SetUniform(UniformId id, const glm::vec2& vec2) const {
+        glUniform2fv(GetUniformLocation(id), 1, glm::value_ptr(vec2));
+    }
 
-        glUniform1f(GetUniformLocation(name), value);
+    void Shader::SetUniform(UniformId id, const glm::vec3& vec3) const {
+        glUniform3fv(GetUniformLocation(id), 1, glm::value_ptr(vec3));
     }
 
-    void Shader::SetUniform(const std::string& name, float x, float y, float z) {
-        ZIBEN_PROFILE_FUNCTION();
+    void Shader::SetUniform(UniformId id, const glm::vec4& vec4) const {
+        glUniform4fv(GetUniformLocation(id), 1, glm::value_ptr(vec4));
+    }
 
-        glUniform3f(GetUniformLocation(name), x, y, z);
+    void Shader::SetUniform(UniformId id, const glm::mat3& mat3) const {
+        glUniformMatrix3fv(GetUniformLocation(id), 1, GL_FALSE, glm::value_ptr(mat3));
     }
 
-    void Shader::SetUniform(const std::string& name, const glm::vec3& vec3) {
-        ZIBEN_PROFILE_FUNCTION();
+    void Shader::SetUniform(UniformId id, const glm::mat4& mat4) const {
+        glUniformMatrix4fv(GetUniformLocation(id), 1, GL_FALSE, glm::value_ptr(mat4));
+    }
 
-        glUniform3fv(GetUniformLocation(name), 1, glm::value_ptr(vec3));
+    void Shader::SetUniform(const std::string& name, bool value) const {
+        SetUniform(GetUniformId(name), value);
     }
 
-    void Shader::SetUniform(const std::string& name, const glm::vec4& vec4) {
-        ZIBEN_PROFILE_FUNCTION();
+    void Shader::SetUniform(const std::string& name, int value) const {
+        SetUniform(GetUniformId(name), value);
+    }
 
-        glUniform4fv(GetUniformLocation(name), 1, glm::value_ptr(vec4));
+    void Shader::SetUniform(const std::string& name, const int* values, uint32_t count) const {
+        SetUniform(GetUniformId(name), values, count);
     }
 
-    void Shader::SetUniform(const std::string& name, const glm::mat3& mat3) {
-        ZIBEN_PROFILE_FUNCTION();
+    void Shader::SetUniform(const std::string& name, float value) const {
+        SetUniform(GetUniformId(name), value);
+    }
 
-        glUniformMatrix3fv(GetUniformLocation(name), 1, GL_FALSE, glm::value_ptr(mat3));
+    void Shader::SetUniform(const std::string& name, float x, float y, float z) const {
+        SetUniform(GetUniformId(name), glm::vec3(x, y, z));
     }
 
-    void Shader::SetUniform(const std::string& name, const glm::mat4& mat4) {
-        ZIBEN_PROFILE_FUNCTION();
+    void Shader::SetUniform(const std::string& name, const glm::vec2& vec2) const {
+        SetUniform(GetUniformId(name), vec2);
+    }
 
-        glUniformMatrix4fv(GetUniformLocation(name), 1, GL_FALSE, glm::value_ptr(mat4));
+    void Shader::SetUniform(const std::string& name, const glm::vec3& vec3) const {
+        SetUniform(GetUniformId(name), vec3);
     }
-    
-    int Shader::GetUniformLocation(const std::string& name) {
-        ZIBEN_PROFILE_FUNCTION();
 
-        if (!m_UniformLocations.contains(name)) {
-            int location = glGetUniformLocation(m_Handle, name.c_str());
+    void Shader::SetUniform(const std::string& name, const glm::vec4& vec4) const {
+        SetUniform(GetUniformId(name), vec4);
+    }
 
-            if (location >= 0)
-                return m_UniformLocations[name] = location;
-        }
+    void Shader::SetUniform(const std::string& name, const glm::mat3& mat3) const {
+        SetUniform(GetUniformId(name), mat3);
+    }
 
-        return m_UniformLocations[name];
+    void Shader::SetUniform(const std::string& name, const glm::mat4& mat4) const {
+        SetUniform(GetUniformId(name), mat4);
     }
 
     void Shader::Compile(ShaderType type, const std::string& source) const {
@@ -268,6 +481,8 @@ namespace Ziben {
     void Shader::Link() const {
         ZIBEN_PROFILE_FUNCTION();
 
+        auto begin = std::chrono::steady_clock::now();
+
         glLinkProgram(m_Handle);
 
         int shaderCount = 0;
@@ -283,11 +498,21 @@ namespace Ziben {
             glValidateProgram(m_Handle);
             m_IsLinked = true;
 
+            Reflect();
+
             for (HandleType shaderHandle : shaderHandles) {
                 glDetachShader(m_Handle, shaderHandle);
                 glDeleteShader(shaderHandle);
             }
 
+            auto& statistics = GetStatistics();
+
+            ++statistics.CompiledCount;
+            statistics.CompileMilliseconds += Internal::GetMillisecondsSince(begin);
+
+            if (m_BinaryHash != 0)
+                SaveBinary();
+
             return;
         }
 
@@ -309,6 +534,182 @@ namespace Ziben {
         }
     }
 
+    void Shader::Swap(HandleType program, const std::string& source) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        if (m_IsLinked)
+            Internal::CopyUniforms(m_Handle, program);
+
+        if (m_Handle != 0) {
+            // Stages of a program that was never linked are still attached
+            int shaderCount = 0;
+            glGetProgramiv(m_Handle, GL_ATTACHED_SHADERS, &shaderCount);
+
+            std::vector<HandleType> shaderHandles(shaderCount);
+            glGetAttachedShaders(m_Handle, shaderCount, nullptr, shaderHandles.data());
+
+            for (HandleType shaderHandle : shaderHandles)
+                glDeleteShader(shaderHandle);
+
+            RenderState::OnProgramDeleted(m_Handle);
+            glDeleteProgram(m_Handle);
+        }
+
+        m_Handle     = program;
+        m_IsLinked   = true;
+        m_BinaryHash = Internal::GetBinaryHash(source);
+
+        Reflect();
+
+        if (m_BinaryHash != 0)
+            SaveBinary();
+    }
+
+    void Shader::Reflect() const {
+        ZIBEN_PROFILE_FUNCTION();
+
+        int uniformCount  = 0;
+        int maxNameLength = 0;
+
+        glGetProgramInterfaceiv(m_Handle, GL_UNIFORM, GL_ACTIVE_RESOURCES, &uniformCount);
+        glGetProgramInterfaceiv(m_Handle, GL_UNIFORM, GL_MAX_NAME_LENGTH, &maxNameLength);
+
+        constexpr std::array<GLenum, 2> properties = { GL_BLOCK_INDEX, GL_LOCATION };
+
+        std::string name(static_cast<std::size_t>(maxNameLength), '\0');
+
+        m_UniformLocations.clear();
+
+        for (int i = 0; i < uniformCount; ++i) {
+            std::array<int, 2> values = {};
+
+            glGetProgramResourceiv(
+                m_Handle,
+                GL_UNIFORM,
+                static_cast<GLuint>(i),
+                static_cast<GLsizei>(properties.size()),
+                properties.data(),
+                static_cast<GLsizei>(values.size()),
+                nullptr,
+                values.data()
+            );
+
+            // Members of the uniform blocks are set through their buffers
+            if (values[0] != -1 || values[1] < 0)
+                continue;
+
+            int length = 0;
+            glGetProgramResourceName(m_Handle, GL_UNIFORM, static_cast<GLuint>(i), maxNameLength, &length, name.data());
+
+            std::string_view uniformName(name.data(), static_cast<std::size_t>(length));
+
+            // Arrays are set from the first element
+            if (uniformName.ends_with("[0]"))
+                uniformName.remove_suffix(3);
+
+            UniformId id = GetUniformId(uniformName);
+
+            if (id >= m_UniformLocations.size())
+                m_UniformLocations.resize(id + 1, -1);
+
+            m_UniformLocations[id] = values[1];
+        }
+    }
+
+    bool Shader::LoadBinary() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto begin = std::chrono::steady_clock::now();
+
+        std::ifstream inputStream(AssetManager::GetCachePath(m_BinaryHash, "glbin"), std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+
+        if (!inputStream)
+            return false;
+
+        auto fileSize = static_cast<uint64_t>(inputStream.tellg());
+        inputStream.seekg(0);
+
+        // Magic, version, binary format and the binary size
+        std::array<uint32_t, 4> header = {};
+        inputStream.read(reinterpret_cast<char*>(header.data()), sizeof(header));
+
+        // The size comes from the file, a truncated or corrupted entry is a cache miss
+        bool isValid = inputStream
+            && header[0] == s_BinaryCacheMagic
+            && header[1] == s_BinaryCacheVersion
+            && header[3] > 0
+            && fileSize == sizeof(header) + static_cast<uint64_t>(header[3]);
+
+        if (!isValid)
+            return false;
+
+        std::vector<uint8_t> binary(header[3]);
+        inputStream.read(reinterpret_cast<char*>(binary.data()), static_cast<std::streamsize>(binary.size()));
+
+        if (!inputStream)
+            return false;
+
+        auto& statistics = GetStatistics();
+
+        m_Handle = glCreateProgram();
+
+        if (m_Handle == 0)
+            throw std::runtime_error("Unable to create shader program!");
+
+        glProgramParameteri(m_Handle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        glProgramBinary(m_Handle, header[2], binary.data(), static_cast<GLsizei>(binary.size()));
+
+        int status;
+        glGetProgramiv(m_Handle, GL_LINK_STATUS, &status);
+
+        // The driver may still refuse the binary, the program is compiled from the source then
+        if (status == GL_FALSE) {
+            ZIBEN_CORE_WARN("Shader: the cached binary of {0} is rejected by the driver", m_Filepath);
+
+            glDeleteProgram(m_Handle);
+            m_Handle = 0;
+
+            ++statistics.RejectedCount;
+
+            return false;
+        }
+
+        m_IsLinked = true;
+
+        Reflect();
+
+        ++statistics.CachedCount;
+        statistics.CacheMilliseconds += Internal::GetMillisecondsSince(begin);
+
+        return true;
+    }
+
+    void Shader::SaveBinary() const {
+        ZIBEN_PROFILE_FUNCTION();
+
+        int length = 0;
+        glGetProgramiv(m_Handle, GL_PROGRAM_BINARY_LENGTH, &length);
+
+        if (length <= 0)
+            return;
+
+        std::vector<uint8_t> binary(static_cast<std::size_t>(length));
+        GLenum               format;
+
+        glGetProgramBinary(m_Handle, length, &length, &format, binary.data());
+
+        std::array<uint32_t, 4> header = { s_BinaryCacheMagic, s_BinaryCacheVersion, format, static_cast<uint32_t>(length) };
+
+        AssetManager::WriteCache(AssetManager::GetCachePath(m_BinaryHash, "glbin"), [&](const std::string& filepath) {
+            std::ofstream outputStream(filepath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+            outputStream.write(reinterpret_cast<const char*>(header.data()), sizeof(header));
+            outputStream.write(reinterpret_cast<const char*>(binary.data()), static_cast<std::streamsize>(header[3]));
+
+            return outputStream.good();
+        });
+    }
+
     bool ShaderLibrary::IsExists(const std::string& name) const {
         return m_Shaders.contains(name);
     }
@@ -328,11 +729,14 @@ namespace Ziben {
     }
 
     Ref<Shader> ShaderLibrary::Load(const std::string& filepath) {
-        return m_Shaders[Internal::GetFileName(filepath)] = Shader::Create(filepath);
+        return Load(Internal::GetFileName(filepath), filepath);
     }
 
     Ref<Shader> ShaderLibrary::Load(const std::string& name, const std::string& filepath) {
-        return m_Shaders[name] = Shader::Create(filepath);
+        if (auto it = m_Shaders.find(name); it != m_Shaders.end() && it->second->GetFilepath() == filepath)
+            return it->second;
+
+        return m_Shaders[name] = AssetManager::LoadShader(filepath);
     }
 
 } // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,279 @@
+#include "ShaderReloader.hpp"
+
+namespace Ziben {
+
+    namespace Internal {
+
+        static std::string GetInfoLog(HandleType handle, bool isProgram) {
+            int logLength = 0;
+
+            if (isProgram)
+                glGetProgramiv(handle, GL_INFO_LOG_LENGTH, &logLength);
+            else
+                glGetShaderiv(handle, GL_INFO_LOG_LENGTH, &logLength);
+
+            std::string log(static_cast<std::size_t>(std::max(logLength, 0)), '\0');
+
+            if (logLength > 0) {
+                int written = 0;
+
+                if (isProgram)
+                    glGetProgramInfoLog(handle, logLength, &written, log.data());
+                else
+                    glGetShaderInfoLog(handle, logLength, &written, log.data());
+
+                log.resize(static_cast<std::size_t>(written));
+            }
+
+            return log;
+        }
+
+    } // namespace Internal
+
+    void ShaderReloader::Init() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data = GetData();
+
+        // The driver picks the number of its compiler threads
+        data.IsParallel = GLEW_KHR_parallel_shader_compile;
+
+        if (data.IsParallel)
+            glMaxShaderCompilerThreadsKHR(0xffffffff);
+
+        data.IsRunning = true;
+        data.Worker    = std::thread(RunWorker);
+
+        GetStatistics().IsParallel = data.IsParallel;
+    }
+
+    void ShaderReloader::Shutdown() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data = GetData();
+
+        {
+            std::lock_guard lock(data.Mutex);
+
+            data.IsRunning  = false;
+            data.ReadQueue  = {};
+            data.ReadyQueue = {};
+        }
+
+        data.Condition.notify_all();
+
+        if (data.Worker.joinable())
+            data.Worker.join();
+
+        for (auto& build : data.Builds) {
+            for (HandleType stage : build.Stages)
+                glDeleteShader(stage);
+
+            glDeleteProgram(build.Program);
+        }
+
+        data.Builds.clear();
+        data.Shaders.clear();
+    }
+
+    void ShaderReloader::Watch(const Ref<Shader>& shader) {
+        auto& data    = GetData();
+        auto& shaders = data.Shaders[shader->GetFilepath()];
+
+        shaders.push_back(shader);
+        data.Watcher.Watch(shader->GetFilepath());
+    }
+
+    void ShaderReloader::Update() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data       = GetData();
+        auto& statistics = GetStatistics();
+
+        auto changedFiles = data.Watcher.Poll();
+
+        if (!changedFiles.empty()) {
+            {
+                std::lock_guard lock(data.Mutex);
+
+                for (auto& filepath : changedFiles)
+                    data.ReadQueue.push({ std::move(filepath), {}, {}, false, std::chrono::steady_clock::now() });
+            }
+
+            data.Condition.notify_one();
+        }
+
+        std::vector<Request> requests;
+
+        {
+            std::lock_guard lock(data.Mutex);
+
+            for (; !data.ReadyQueue.empty(); data.ReadyQueue.pop())
+                requests.push_back(std::move(data.ReadyQueue.front()));
+        }
+
+        for (const auto& request : requests) {
+            auto it = data.Shaders.find(request.Filepath);
+
+            if (it == data.Shaders.end())
+                continue;
+
+            auto& shaders = it->second;
+
+            std::erase_if(shaders, [](const auto& shader) { return shader.expired(); });
+
+            // Every holder of the file is gone
+            if (shaders.empty()) {
+                data.Watcher.Unwatch(request.Filepath);
+                data.Shaders.erase(it);
+
+                continue;
+            }
+
+            if (!request.IsValid) {
+                ZIBEN_CORE_ERROR("ShaderReloader: {0} has malformed #type directives, the old program is kept", request.Filepath);
+                ++statistics.FailedCount;
+
+                continue;
+            }
+
+            for (const auto& shader : shaders)
+                StartBuild(request, shader.lock());
+        }
+
+        std::erase_if(data.Builds, FinishBuild);
+
+        statistics.WatchedCount = static_cast<uint32_t>(data.Shaders.size());
+        statistics.PendingCount = static_cast<uint32_t>(data.Builds.size());
+    }
+
+    ShaderReloader::Statistics& ShaderReloader::GetStatistics() {
+        static Statistics statistics;
+        return statistics;
+    }
+
+    ShaderReloader::Data& ShaderReloader::GetData() {
+        static Data data;
+        return data;
+    }
+
+    void ShaderReloader::RunWorker() {
+        auto& data = GetData();
+
+        while (true) {
+            Request request;
+
+            {
+                std::unique_lock lock(data.Mutex);
+                data.Condition.wait(lock, [&data] { return !data.IsRunning || !data.ReadQueue.empty(); });
+
+                if (!data.IsRunning)
+                    return;
+
+                request = std::move(data.ReadQueue.front());
+                data.ReadQueue.pop();
+            }
+
+            {
+                ZIBEN_PROFILE_SCOPE("ShaderReloader::RunWorker: Shader::PreProcess");
+
+                std::ifstream inputStream(request.Filepath, std::ios_base::in | std::ios_base::binary);
+
+                request.Source.assign(std::istreambuf_iterator<char>(inputStream), std::istreambuf_iterator<char>());
+                request.IsValid = inputStream.good() || inputStream.eof();
+
+                if (request.IsValid)
+                    request.IsValid = Shader::PreProcess(request.Source, request.Sources);
+            }
+
+            std::lock_guard lock(data.Mutex);
+            data.ReadyQueue.push(std::move(request));
+        }
+    }
+
+    void ShaderReloader::StartBuild(const Request& request, const Ref<Shader>& shader) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        Build build;
+
+        build.Target   = shader;
+        build.Filepath = request.Filepath;
+        build.Source   = request.Source;
+        build.Program  = glCreateProgram();
+        build.Begin    = request.Begin;
+
+        glProgramParameteri(build.Program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+        for (const auto& [type, source] : request.Sources) {
+            HandleType  stage   = glCreateShader(static_cast<GLenum>(type));
+            const char* cSource = source.c_str();
+
+            glShaderSource(stage, 1, &cSource, nullptr);
+            glCompileShader(stage);
+            glAttachShader(build.Program, stage);
+
+            build.Stages.push_back(stage);
+        }
+
+        // With KHR_parallel_shader_compile neither call blocks, the status is polled in the next frames
+        glLinkProgram(build.Program);
+
+        GetData().Builds.push_back(std::move(build));
+    }
+
+    bool ShaderReloader::FinishBuild(Build& build) {
+        if (GetData().IsParallel) {
+            int isCompleted = GL_FALSE;
+            glGetProgramiv(build.Program, GL_COMPLETION_STATUS_KHR, &isCompleted);
+
+            if (isCompleted == GL_FALSE)
+                return false;
+        }
+
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& statistics = GetStatistics();
+        auto  shader     = build.Target.lock();
+
+        int status = GL_FALSE;
+        glGetProgramiv(build.Program, GL_LINK_STATUS, &status);
+
+        if (shader && status == GL_FALSE) {
+            std::string log;
+
+            for (HandleType stage : build.Stages) {
+                int compileStatus = GL_FALSE;
+                glGetShaderiv(stage, GL_COMPILE_STATUS, &compileStatus);
+
+                if (compileStatus == GL_FALSE)
+                    log += Internal::GetInfoLog(stage, false);
+            }
+
+            if (log.empty())
+                log = Internal::GetInfoLog(build.Program, true);
+
+            ZIBEN_CORE_ERROR("ShaderReloader: {0} failed to build, the old program is kept\n{1}", build.Filepath, log);
+            ++statistics.FailedCount;
+        }
+
+        for (HandleType stage : build.Stages) {
+            glDetachShader(build.Program, stage);
+            glDeleteShader(stage);
+        }
+
+        if (!shader || status == GL_FALSE) {
+            glDeleteProgram(build.Program);
+            return true;
+        }
+
+        shader->Swap(build.Program, build.Source);
+
+        ++statistics.ReloadedCount;
+        statistics.LastReloadMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - build.Begin).count();
+
+        ZIBEN_CORE_INFO("ShaderReloader: {0} is reloaded in {1:.1f} ms", build.Filepath, statistics.LastReloadMilliseconds);
+
+        return true;
+    }
+
+} // namespace Ziben
\ No newline at end of file
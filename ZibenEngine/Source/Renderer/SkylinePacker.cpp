@@ -0,0 +1,111 @@
+#include "SkylinePacker.hpp"
+
+namespace Ziben {
+
+    SkylinePacker::SkylinePacker(uint32_t width, uint32_t height)
+        : m_Width(width)
+        , m_Height(height)
+        , m_UsedArea(0) {
+
+        Clear();
+    }
+
+    float SkylinePacker::GetOccupancy() const {
+        return static_cast<float>(static_cast<double>(m_UsedArea) / (static_cast<double>(m_Width) * m_Height));
+    }
+
+    bool SkylinePacker::Pack(uint32_t width, uint32_t height, glm::uvec2& position) {
+        if (width == 0 || height == 0)
+            return false;
+
+        std::size_t bestIndex = m_Skyline.size();
+        uint32_t    bestTop   = std::numeric_limits<uint32_t>::max();
+        uint32_t    bestWidth = std::numeric_limits<uint32_t>::max();
+        uint32_t    bestY     = 0;
+
+        // Lowest top edge wins, the narrower segment breaks ties so wide gaps stay open
+        for (std::size_t i = 0; i < m_Skyline.size(); ++i) {
+            uint32_t y;
+
+            if (!Fit(i, width, height, y))
+                continue;
+
+            if (y + height < bestTop || (y + height == bestTop && m_Skyline[i].Width < bestWidth)) {
+                bestIndex = i;
+                bestTop   = y + height;
+                bestWidth = m_Skyline[i].Width;
+                bestY     = y;
+            }
+        }
+
+        if (bestIndex == m_Skyline.size())
+            return false;
+
+        position = glm::uvec2(m_Skyline[bestIndex].X, bestY);
+
+        // The new segment covers the ones below it, the partially covered one is cut
+        m_Skyline.insert(m_Skyline.begin() + static_cast<std::ptrdiff_t>(bestIndex), Segment{ position.x, bestTop, width });
+
+        for (std::size_t i = bestIndex + 1; i < m_Skyline.size();) {
+            const auto& previous = m_Skyline[i - 1];
+            auto&       segment  = m_Skyline[i];
+            uint32_t    right    = previous.X + previous.Width;
+
+            if (segment.X >= right)
+                break;
+
+            uint32_t shrink = right - segment.X;
+
+            if (shrink < segment.Width) {
+                segment.X     += shrink;
+                segment.Width -= shrink;
+
+                break;
+            }
+
+            m_Skyline.erase(m_Skyline.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+
+        // Neighbours of the same height become one segment
+        for (std::size_t i = 0; i + 1 < m_Skyline.size();) {
+            if (m_Skyline[i].Y == m_Skyline[i + 1].Y) {
+                m_Skyline[i].Width += m_Skyline[i + 1].Width;
+                m_Skyline.erase(m_Skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            } else {
+                ++i;
+            }
+        }
+
+        m_UsedArea += static_cast<uint64_t>(width) * height;
+
+        return true;
+    }
+
+    void SkylinePacker::Clear() {
+        m_UsedArea = 0;
+
+        m_Skyline.clear();
+        m_Skyline.push_back({ 0, 0, m_Width });
+    }
+
+    bool SkylinePacker::Fit(std::size_t segmentIndex, uint32_t width, uint32_t height, uint32_t& y) const {
+        if (m_Skyline[segmentIndex].X + width > m_Width)
+            return false;
+
+        uint32_t remainingWidth = width;
+
+        y = 0;
+
+        for (std::size_t i = segmentIndex; remainingWidth > 0; ++i) {
+            y = std::max(y, m_Skyline[i].Y);
+
+            if (y + height > m_Height)
+                return false;
+
+            remainingWidth -= std::min(remainingWidth, m_Skyline[i].Width);
+        }
+
+        return true;
+    }
+
+} // namespace Ziben
\ No newline at end of file
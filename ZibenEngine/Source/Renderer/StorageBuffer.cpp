@@ -0,0 +1,30 @@
+#include "StorageBuffer.hpp"
+
+#include "RenderState.hpp"
+
+namespace Ziben {
+
+    Ref<StorageBuffer> StorageBuffer::Create(std::size_t size, BufferUsage usage) {
+        return CreateRef<StorageBuffer>(size, usage);
+    }
+
+    void StorageBuffer::Bind(const Ref<StorageBuffer>& storageBuffer, uint32_t binding) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        RenderState::BindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, storageBuffer->GetHandle());
+    }
+
+    void StorageBuffer::Unbind(uint32_t binding) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        RenderState::BindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
+    }
+
+    StorageBuffer::StorageBuffer(std::size_t size, BufferUsage usage)
+        : m_Buffer(nullptr, size, BufferStorage::Immutable, usage) {}
+
+    void StorageBuffer::SetData(const void* data, std::size_t size, std::size_t offset) const {
+        m_Buffer.SetData(data, size, offset);
+    }
+
+} // namespace Ziben
\ No newline at end of file
@@ -17,6 +17,22 @@ namespace Ziben {
         return CreateRef<SubTexture2D>(texture, min, max);
     }
 
+    Ref<SubTexture2D> SubTexture2D::CreateFromCoords(
+        const Ref<SubTexture2D>& sheet,
+        const glm::vec2&         position,
+        const glm::vec2&         cellSize,
+        const glm::vec2&         spriteSize
+    ) {
+        // Cells are counted from the corner of the region in the texels of its texture
+        glm::vec2 textureSize = glm::vec2(sheet->m_Texture->GetWidth(), sheet->m_Texture->GetHeight());
+        glm::vec2 origin      = sheet->m_TexCoords[0];
+
+        glm::vec2 min = origin + position                * cellSize / textureSize;
+        glm::vec2 max = origin + (position + spriteSize) * cellSize / textureSize;
+
+        return CreateRef<SubTexture2D>(sheet->m_Texture, min, max);
+    }
+
     SubTexture2D::SubTexture2D(const Ref<Texture2D>& texture, const glm::vec2& min, const glm::vec2& max)
         : m_Texture(texture)
         , m_TexCoords({
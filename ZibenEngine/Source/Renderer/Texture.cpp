@@ -2,14 +2,34 @@
 
 #include <stb_image.h>
 
+#include "TextureCompressor.hpp"
+#include "RenderState.hpp"
+
 namespace Ziben {
 
+    namespace Internal {
+
+        static std::size_t GetMipChainSize(uint32_t width, uint32_t height, uint32_t levelCount, std::size_t texelSize) {
+            std::size_t size = 0;
+
+            for (uint32_t level = 0; level < levelCount; ++level)
+                size += static_cast<std::size_t>(std::max(width >> level, 1u)) * std::max(height >> level, 1u) * texelSize;
+
+            return size;
+        }
+
+    } // namespace Internal
+
     Ref<Texture2D> Texture2D::Create(const std::string& filepath) {
         return CreateRef<Texture2D>(filepath);
     }
 
-    Ref<Texture2D> Texture2D::Create(uint32_t width, uint32_t height) {
-        return CreateRef<Texture2D>(width, height);
+    Ref<Texture2D> Texture2D::Create(uint32_t width, uint32_t height, TextureFormat format, uint32_t levelCount) {
+        return CreateRef<Texture2D>(width, height, format, levelCount);
+    }
+
+    Ref<Texture2D> Texture2D::Create(const CompressedImage& image) {
+        return CreateRef<Texture2D>(image);
     }
 
     void Texture::Bind(const Ref<Texture>& texture, uint32_t slot) {
@@ -19,22 +39,89 @@ namespace Ziben {
     void Texture2D::Bind(const Ref<Texture2D>& texture2D, uint32_t slot) {
         ZIBEN_PROFILE_FUNCTION();
 
-        glBindTextureUnit(slot, texture2D->m_Handle);
+        RenderState::BindTextureUnit(slot, texture2D->m_Handle);
     }
 
     void Texture2D::Unbind() {
         ZIBEN_PROFILE_FUNCTION();
 
-        glBindTextureUnit(0, 0);
+        RenderState::BindTextureUnit(0, 0);
+    }
+
+    uint32_t Texture2D::GetMipLevelCount(uint32_t width, uint32_t height) {
+        return static_cast<uint32_t>(std::bit_width(std::max({ width, height, 1u })));
+    }
+
+    bool Texture2D::LoadPixels(const std::string& filepath, std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        int imageWidth;
+        int imageHeight;
+        int channels;
+
+        stbi_set_flip_vertically_on_load(true);
+
+        stbi_uc* data = stbi_load(filepath.c_str(), &imageWidth, &imageHeight, &channels, 4);
+
+        if (!data)
+            return false;
+
+        width  = static_cast<uint32_t>(imageWidth);
+        height = static_cast<uint32_t>(imageHeight);
+        pixels.assign(data, data + static_cast<std::size_t>(width) * height * 4);
+
+        stbi_image_free(data);
+
+        return true;
+    }
+
+    bool Texture2D::DecodePixels(const uint8_t* data, std::size_t size, std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        int imageWidth;
+        int imageHeight;
+        int channels;
+
+        stbi_set_flip_vertically_on_load(true);
+
+        stbi_uc* image = stbi_load_from_memory(data, static_cast<int>(size), &imageWidth, &imageHeight, &channels, 4);
+
+        if (!image)
+            return false;
+
+        width  = static_cast<uint32_t>(imageWidth);
+        height = static_cast<uint32_t>(imageHeight);
+        pixels.assign(image, image + static_cast<std::size_t>(width) * height * 4);
+
+        stbi_image_free(image);
+
+        return true;
     }
 
     Texture2D::Texture2D(const std::string& filepath)
         : m_Handle(0)
+        , m_LevelCount(1)
         , m_InternalFormat(0)
-        , m_DataFormat(0) {
+        , m_DataFormat(0)
+        , m_DataType(GL_UNSIGNED_BYTE)
+        , m_MemorySize(0)
+        , m_BindlessHandle(0) {
 
         ZIBEN_PROFILE_FUNCTION();
 
+        // Pre-compressed data already has its mip chain
+        if (std::filesystem::path(filepath).extension() == ".ktx2") {
+            CompressedImage image;
+
+            // A broken file shows up as a white texture instead of taking the program down
+            if (TextureCompressor::ReadKtx2(filepath, image))
+                StoreCompressed(image);
+            else
+                StoreWhite();
+
+            return;
+        }
+
         int      width;
         int      height;
         int      channels;
@@ -49,8 +136,9 @@ namespace Ziben {
 
         assert(data);
 
-        m_Width  = width;
-        m_Height = height;
+        m_Width      = width;
+        m_Height     = height;
+        m_LevelCount = GetMipLevelCount(m_Width, m_Height);
 
         if (channels == 4) {
             m_InternalFormat = GL_RGBA8;
@@ -62,20 +150,22 @@ namespace Ziben {
 
         assert(m_InternalFormat && m_DataFormat);
 
+        // Drivers pad RGB8 texels to 4 bytes
+        m_MemorySize = Internal::GetMipChainSize(m_Width, m_Height, m_LevelCount, 4);
+
         glCreateTextures(GL_TEXTURE_2D, 1, &m_Handle);
 
         glTextureStorage2D(
             m_Handle,
-            1,
+            static_cast<GLsizei>(m_LevelCount),
             m_InternalFormat,
             static_cast<GLsizei>(m_Width),
             static_cast<GLsizei>(m_Height)
         );
 
-        glTextureParameteri(m_Handle, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTextureParameteri(m_Handle, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTextureParameteri(m_Handle, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTextureParameteri(m_Handle, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        SetFilter();
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
         glTextureSubImage2D(
             m_Handle,                          // Target
@@ -89,33 +179,81 @@ namespace Ziben {
             data                               // pixels
         );
 
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+        GenerateMipmaps();
+
         stbi_image_free(data);
     }
 
-    Texture2D::Texture2D(uint32_t width, uint32_t height)
+    Texture2D::Texture2D(uint32_t width, uint32_t height, TextureFormat format, uint32_t levelCount)
         : m_Handle(0)
         , m_Width(width)
         , m_Height(height)
+        , m_LevelCount(std::max(levelCount, 1u))
         , m_InternalFormat(GL_RGBA8)
-        , m_DataFormat(GL_RGBA) {
+        , m_DataFormat(GL_RGBA)
+        , m_DataType(GL_UNSIGNED_BYTE)
+        , m_MemorySize(0)
+        , m_BindlessHandle(0) {
 
         ZIBEN_PROFILE_FUNCTION();
 
+        assert(!TextureCompressor::IsCompressed(format));
+
+        if (format == TextureFormat::R16UI) {
+            m_InternalFormat = GL_R16UI;
+            m_DataFormat     = GL_RED_INTEGER;
+            m_DataType       = GL_UNSIGNED_SHORT;
+        }
+
+        m_MemorySize = Internal::GetMipChainSize(m_Width, m_Height, m_LevelCount, format == TextureFormat::R16UI ? 2 : 4);
+
         glCreateTextures(GL_TEXTURE_2D, 1, &m_Handle);
-        glTextureStorage2D(m_Handle, 1, m_InternalFormat, static_cast<GLsizei>(m_Width), static_cast<GLsizei>(m_Height));
+        glTextureStorage2D(
+            m_Handle,
+            static_cast<GLsizei>(m_LevelCount),
+            m_InternalFormat,
+            static_cast<GLsizei>(m_Width),
+            static_cast<GLsizei>(m_Height)
+        );
 
-        glTextureParameteri(m_Handle, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTextureParameteri(m_Handle, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTextureParameteri(m_Handle, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTextureParameteri(m_Handle, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        SetFilter();
+    }
+
+    Texture2D::Texture2D(const CompressedImage& image)
+        : m_Handle(0)
+        , m_LevelCount(1)
+        , m_InternalFormat(0)
+        , m_DataFormat(0)
+        , m_DataType(GL_UNSIGNED_BYTE)
+        , m_MemorySize(0)
+        , m_BindlessHandle(0) {
+
+        ZIBEN_PROFILE_FUNCTION();
 
+        StoreCompressed(image);
     }
 
     Texture2D::~Texture2D() {
         ZIBEN_PROFILE_FUNCTION();
 
-        if (m_Handle != 0)
+        if (m_BindlessHandle != 0)
+            glMakeTextureHandleNonResidentARB(m_BindlessHandle);
+
+        if (m_Handle != 0) {
+            RenderState::OnTextureDeleted(m_Handle);
             glDeleteTextures(1, &m_Handle);
+        }
+    }
+
+    uint64_t Texture2D::GetBindlessHandle() const {
+        if (m_BindlessHandle == 0) {
+            m_BindlessHandle = glGetTextureHandleARB(m_Handle);
+            glMakeTextureHandleResidentARB(m_BindlessHandle);
+        }
+
+        return m_BindlessHandle;
     }
 
     void Texture2D::SetData(void* data, uint32_t size) {
@@ -129,9 +267,117 @@ namespace Ziben {
             static_cast<GLsizei>(m_Width),     // Width
             static_cast<GLsizei>(m_Height),    // Height
             m_DataFormat,                      // GL format
-            GL_UNSIGNED_BYTE,                  // GL type
+            m_DataType,                        // GL type
+            data                               // pixels
+        );
+    }
+
+    void Texture2D::SetData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t rowLength) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        assert(x + width <= m_Width && y + height <= m_Height);
+
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(rowLength));
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        glTextureSubImage2D(
+            m_Handle,                          // Target
+            0,                                 // Level
+            static_cast<GLint>(x),             // Offset x
+            static_cast<GLint>(y),             // Offset y
+            static_cast<GLsizei>(width),       // Width
+            static_cast<GLsizei>(height),      // Height
+            m_DataFormat,                      // GL format
+            m_DataType,                        // GL type
             data                               // pixels
         );
+
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+
+    void Texture2D::GenerateMipmaps() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        assert(m_DataFormat != 0);
+
+        if (m_LevelCount > 1)
+            glGenerateTextureMipmap(m_Handle);
+    }
+
+    void Texture2D::StoreCompressed(const CompressedImage& image) {
+        assert(TextureCompressor::IsCompressed(image.Format) && !image.Levels.empty());
+
+        m_Width          = image.Width;
+        m_Height         = image.Height;
+        m_LevelCount     = static_cast<uint32_t>(image.Levels.size());
+        m_InternalFormat = TextureCompressor::GetInternalFormat(image.Format);
+        m_MemorySize     = 0;
+
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_Handle);
+        glTextureStorage2D(
+            m_Handle,
+            static_cast<GLsizei>(m_LevelCount),
+            m_InternalFormat,
+            static_cast<GLsizei>(m_Width),
+            static_cast<GLsizei>(m_Height)
+        );
+
+        SetFilter();
+
+        for (uint32_t level = 0; level < m_LevelCount; ++level) {
+            const auto& data = image.Levels[level];
+
+            glCompressedTextureSubImage2D(
+                m_Handle,                                              // Target
+                static_cast<GLint>(level),                             // Level
+                0,                                                     // Offset x
+                0,                                                     // Offset y
+                static_cast<GLsizei>(std::max(m_Width >> level, 1u)),  // Width
+                static_cast<GLsizei>(std::max(m_Height >> level, 1u)), // Height
+                m_InternalFormat,                                      // GL format
+                static_cast<GLsizei>(data.size()),                     // Size
+                data.data()                                            // Blocks
+            );
+
+            m_MemorySize += data.size();
+        }
+    }
+
+    void Texture2D::StoreWhite() {
+        static constexpr uint32_t s_WhiteTexel = 0xffffffff;
+
+        m_Width          = 1;
+        m_Height         = 1;
+        m_LevelCount     = 1;
+        m_InternalFormat = GL_RGBA8;
+        m_DataFormat     = GL_RGBA;
+        m_MemorySize     = sizeof(s_WhiteTexel);
+
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_Handle);
+        glTextureStorage2D(m_Handle, 1, m_InternalFormat, 1, 1);
+
+        SetFilter();
+
+        glTextureSubImage2D(m_Handle, 0, 0, 0, 1, 1, m_DataFormat, GL_UNSIGNED_BYTE, &s_WhiteTexel);
+    }
+
+    void Texture2D::SetFilter() {
+        // Integer textures can't be filtered
+        if (m_DataFormat == GL_RED_INTEGER) {
+            glTextureParameteri(m_Handle, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTextureParameteri(m_Handle, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glTextureParameteri(m_Handle, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTextureParameteri(m_Handle, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+            return;
+        }
+
+        // Minified sprites read the smaller levels instead of skipping over the full resolution one
+        glTextureParameteri(m_Handle, GL_TEXTURE_MIN_FILTER, m_LevelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTextureParameteri(m_Handle, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(m_Handle, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(m_Handle, GL_TEXTURE_WRAP_T, GL_REPEAT);
     }
 
     bool Texture2D::operator !=(const Texture2D& other) const {
@@ -142,4 +388,110 @@ namespace Ziben {
         return m_Handle == other.m_Handle;
     }
 
+    Ref<Texture2DArray> Texture2DArray::Create(uint32_t width, uint32_t height, uint32_t layerCount) {
+        return CreateRef<Texture2DArray>(width, height, layerCount);
+    }
+
+    void Texture2DArray::Bind(const Ref<Texture2DArray>& texture2DArray, uint32_t slot) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        RenderState::BindTextureUnit(slot, texture2DArray->m_Handle);
+    }
+
+    Texture2DArray::Texture2DArray(uint32_t width, uint32_t height, uint32_t layerCount)
+        : m_Handle(0)
+        , m_Width(width)
+        , m_Height(height)
+        , m_LayerCount(layerCount) {
+
+        ZIBEN_PROFILE_FUNCTION();
+
+        glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_Handle);
+        glTextureStorage3D(
+            m_Handle,
+            1,
+            GL_RGBA8,
+            static_cast<GLsizei>(m_Width),
+            static_cast<GLsizei>(m_Height),
+            static_cast<GLsizei>(m_LayerCount)
+        );
+
+        glTextureParameteri(m_Handle, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(m_Handle, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(m_Handle, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(m_Handle, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    }
+
+    Texture2DArray::~Texture2DArray() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        if (m_Handle != 0) {
+            RenderState::OnTextureDeleted(m_Handle);
+            glDeleteTextures(1, &m_Handle);
+        }
+    }
+
+    void Texture2DArray::SetData(void* data, uint32_t size) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        assert(size == m_Width * m_Height * m_LayerCount * 4);
+
+        glTextureSubImage3D(
+            m_Handle,                          // Target
+            0,                                 // Level
+            0,                                 // Offset x
+            0,                                 // Offset y
+            0,                                 // Offset z
+            static_cast<GLsizei>(m_Width),     // Width
+            static_cast<GLsizei>(m_Height),    // Height
+            static_cast<GLsizei>(m_LayerCount), // Depth
+            GL_RGBA,                           // GL format
+            GL_UNSIGNED_BYTE,                  // GL type
+            data                               // pixels
+        );
+    }
+
+    void Texture2DArray::SetLayerData(uint32_t layer, const void* data) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        assert(layer < m_LayerCount);
+
+        glTextureSubImage3D(
+            m_Handle,                          // Target
+            0,                                 // Level
+            0,                                 // Offset x
+            0,                                 // Offset y
+            static_cast<GLint>(layer),         // Offset z
+            static_cast<GLsizei>(m_Width),     // Width
+            static_cast<GLsizei>(m_Height),    // Height
+            1,                                 // Depth
+            GL_RGBA,                           // GL format
+            GL_UNSIGNED_BYTE,                  // GL type
+            data                               // pixels
+        );
+    }
+
+    bool Texture2DArray::LoadLayer(uint32_t layer, const std::string& filepath) {
+        std::vector<uint8_t> pixels;
+        uint32_t             width;
+        uint32_t             height;
+
+        if (!Texture2D::LoadPixels(filepath, pixels, width, height) || width != m_Width || height != m_Height) {
+            ZIBEN_CORE_ERROR("Texture2DArray: can't load {0} into a {1}x{2} layer", filepath, m_Width, m_Height);
+            return false;
+        }
+
+        SetLayerData(layer, pixels.data());
+
+        return true;
+    }
+
+    bool Texture2DArray::operator !=(const Texture2DArray& other) const {
+        return m_Handle != other.m_Handle;
+    }
+
+    bool Texture2DArray::operator ==(const Texture2DArray& other) const {
+        return m_Handle == other.m_Handle;
+    }
+
 } // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,186 @@
+#include "TextureAtlas.hpp"
+
+#include "AssetManager.hpp"
+
+namespace Ziben {
+
+    namespace Internal {
+
+        // Copies the image into the middle of the padded one and extrudes its edges into the padding
+        static void ExtrudeImage(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t padding, std::vector<uint8_t>& result) {
+            uint32_t paddedWidth  = width + 2 * padding;
+            uint32_t paddedHeight = height + 2 * padding;
+
+            result.resize(static_cast<std::size_t>(paddedWidth) * paddedHeight * 4);
+
+            for (uint32_t y = 0; y < paddedHeight; ++y) {
+                uint32_t sourceY = std::clamp(y, padding, padding + height - 1) - padding;
+
+                for (uint32_t x = 0; x < paddedWidth; ++x) {
+                    uint32_t sourceX = std::clamp(x, padding, padding + width - 1) - padding;
+
+                    std::memcpy(
+                        &result[(static_cast<std::size_t>(y) * paddedWidth + x) * 4],
+                        &pixels[(static_cast<std::size_t>(sourceY) * width + sourceX) * 4],
+                        4
+                    );
+                }
+            }
+        }
+
+    } // namespace Internal
+
+    Ref<TextureAtlas> TextureAtlas::Create(uint32_t pageSize, uint32_t padding) {
+        return CreateRef<TextureAtlas>(pageSize, padding);
+    }
+
+    TextureAtlas::TextureAtlas(uint32_t pageSize, uint32_t padding)
+        : m_PageSize(pageSize)
+        , m_Padding(padding)
+        , m_ImageArea(0) {}
+
+    TextureAtlas::Statistics TextureAtlas::GetStatistics() const {
+        Statistics statistics;
+        uint64_t   pageArea = 0;
+
+        for (const auto& page : m_Pages)
+            pageArea += static_cast<uint64_t>(page.Packer.GetWidth()) * page.Packer.GetHeight();
+
+        statistics.PageCount   = static_cast<uint32_t>(m_Pages.size());
+        statistics.RegionCount = static_cast<uint32_t>(m_Regions.size());
+        statistics.Efficiency  = pageArea > 0 ? static_cast<float>(static_cast<double>(m_ImageArea) / static_cast<double>(pageArea)) : 0.0f;
+
+        return statistics;
+    }
+
+    Ref<SubTexture2D> TextureAtlas::Get(const std::string& name) const {
+        auto it = m_Regions.find(name);
+
+        return it != m_Regions.end() ? it->second : nullptr;
+    }
+
+    Ref<SubTexture2D> TextureAtlas::Add(const std::string& filepath) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        if (auto region = Get(filepath))
+            return region;
+
+        std::vector<uint8_t> pixels;
+        uint32_t             width;
+        uint32_t             height;
+
+        if (!AssetManager::LoadPixels(filepath, pixels, width, height)) {
+            ZIBEN_CORE_ERROR("TextureAtlas: can't load the image {0}", filepath);
+            return nullptr;
+        }
+
+        return Pack(filepath, pixels.data(), width, height);
+    }
+
+    Ref<SubTexture2D> TextureAtlas::Add(const std::string& name, const uint8_t* pixels, uint32_t width, uint32_t height) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        if (auto region = Get(name))
+            return region;
+
+        return Pack(name, pixels, width, height);
+    }
+
+    std::vector<Ref<SubTexture2D>> TextureAtlas::Build(const std::vector<std::string>& filepaths) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        struct Image {
+            std::size_t          Index;
+            std::vector<uint8_t> Pixels;
+            uint32_t             Width  = 0;
+            uint32_t             Height = 0;
+        };
+
+        std::vector<Ref<SubTexture2D>> regions(filepaths.size());
+        std::vector<Image>             images;
+
+        images.reserve(filepaths.size());
+
+        for (std::size_t i = 0; i < filepaths.size(); ++i) {
+            if ((regions[i] = Get(filepaths[i])))
+                continue;
+
+            Image image{ i };
+
+            if (AssetManager::LoadPixels(filepaths[i], image.Pixels, image.Width, image.Height))
+                images.push_back(std::move(image));
+            else
+                ZIBEN_CORE_ERROR("TextureAtlas: can't load the image {0}", filepaths[i]);
+        }
+
+        // Skyline packing wastes the least space when the large images go first
+        std::sort(images.begin(), images.end(), [](const Image& lhs, const Image& rhs) {
+            return std::max(lhs.Width, lhs.Height) != std::max(rhs.Width, rhs.Height)
+                ? std::max(lhs.Width, lhs.Height) > std::max(rhs.Width, rhs.Height)
+                : lhs.Height > rhs.Height;
+        });
+
+        for (const auto& image : images)
+            regions[image.Index] = Pack(filepaths[image.Index], image.Pixels.data(), image.Width, image.Height);
+
+        auto statistics = GetStatistics();
+
+        ZIBEN_CORE_INFO(
+            "TextureAtlas: {0} images in {1} pages, {2:.1f}% of the page area is used",
+            statistics.RegionCount,
+            statistics.PageCount,
+            statistics.Efficiency * 100.0f
+        );
+
+        return regions;
+    }
+
+    void TextureAtlas::Clear() {
+        m_Pages.clear();
+        m_Regions.clear();
+
+        m_ImageArea = 0;
+    }
+
+    Ref<SubTexture2D> TextureAtlas::Pack(const std::string& name, const uint8_t* pixels, uint32_t width, uint32_t height) {
+        if (width == 0 || height == 0) {
+            ZIBEN_CORE_ERROR("TextureAtlas: image {0} is empty", name);
+            return nullptr;
+        }
+
+        uint32_t   paddedWidth  = width + 2 * m_Padding;
+        uint32_t   paddedHeight = height + 2 * m_Padding;
+        Page*      page         = nullptr;
+        glm::uvec2 position;
+
+        for (auto& candidate : m_Pages) {
+            if (candidate.Packer.Pack(paddedWidth, paddedHeight, position)) {
+                page = &candidate;
+                break;
+            }
+        }
+
+        // Images larger than a page get a page of their own size
+        if (!page) {
+            uint32_t pageWidth  = std::max(m_PageSize, paddedWidth);
+            uint32_t pageHeight = std::max(m_PageSize, paddedHeight);
+
+            page = &m_Pages.emplace_back(Page{ Texture2D::Create(pageWidth, pageHeight), SkylinePacker(pageWidth, pageHeight) });
+            page->Packer.Pack(paddedWidth, paddedHeight, position);
+        }
+
+        Internal::ExtrudeImage(pixels, width, height, m_Padding, m_PaddedPixels);
+        page->Texture->SetData(m_PaddedPixels.data(), position.x, position.y, paddedWidth, paddedHeight, paddedWidth);
+
+        auto pageWidth  = static_cast<float>(page->Texture->GetWidth());
+        auto pageHeight = static_cast<float>(page->Texture->GetHeight());
+
+        glm::vec2 min = { static_cast<float>(position.x + m_Padding) / pageWidth, static_cast<float>(position.y + m_Padding) / pageHeight };
+        glm::vec2 max = { static_cast<float>(position.x + m_Padding + width) / pageWidth, static_cast<float>(position.y + m_Padding + height) / pageHeight };
+
+        m_ImageArea += static_cast<uint64_t>(width) * height;
+
+        return m_Regions[name] = CreateRef<SubTexture2D>(page->Texture, min, max);
+    }
+
+} // namespace Ziben
\ No newline at end of file
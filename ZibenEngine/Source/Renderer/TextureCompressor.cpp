@@ -0,0 +1,416 @@
+#include "TextureCompressor.hpp"
+
+#include "AssetManager.hpp"
+#include "RenderState.hpp"
+
+namespace Ziben {
+
+    namespace Internal {
+
+        // KTX2 header, level index and data format descriptor values of the Khronos specifications
+        static constexpr std::array<uint8_t, 12> s_Ktx2Identifier = {
+            0xab, 0x4b, 0x54, 0x58, 0x20, 0x32, 0x30, 0xbb, 0x0d, 0x0a, 0x1a, 0x0a
+        };
+
+        static constexpr std::size_t s_Ktx2HeaderSize     = 80;
+        static constexpr std::size_t s_Ktx2LevelEntrySize = 24;
+
+        struct Ktx2Format {
+            TextureFormat Format;
+            uint32_t      VkFormat;
+            uint32_t      SrgbVkFormat;
+            uint8_t       ColorModel;
+            const char*   Name;
+        };
+
+        static constexpr std::array<Ktx2Format, 3> s_Ktx2Formats = {
+            Ktx2Format{ TextureFormat::BC1, 133, 134, 128, "bc1" },
+            Ktx2Format{ TextureFormat::BC3, 137, 138, 130, "bc3" },
+            Ktx2Format{ TextureFormat::BC7, 145, 146, 135, "bc7" }
+        };
+
+        static const Ktx2Format* FindFormat(TextureFormat format) {
+            auto it = std::find_if(s_Ktx2Formats.begin(), s_Ktx2Formats.end(), [format](const auto& item) {
+                return item.Format == format;
+            });
+
+            return it != s_Ktx2Formats.end() ? &*it : nullptr;
+        }
+
+        // sRGB data is read as linear, the renderer doesn't use sRGB targets
+        static const Ktx2Format* FindFormat(uint32_t vkFormat) {
+            auto it = std::find_if(s_Ktx2Formats.begin(), s_Ktx2Formats.end(), [vkFormat](const auto& item) {
+                return item.VkFormat == vkFormat || item.SrgbVkFormat == vkFormat;
+            });
+
+            return it != s_Ktx2Formats.end() ? &*it : nullptr;
+        }
+
+        static inline std::size_t GetLevelSize(TextureFormat format, uint32_t width, uint32_t height, uint32_t level) {
+            std::size_t blockCountX = (std::max(width >> level, 1u) + 3) / 4;
+            std::size_t blockCountY = (std::max(height >> level, 1u) + 3) / 4;
+
+            return blockCountX * blockCountY * TextureCompressor::GetBlockSize(format);
+        }
+
+        template <typename T>
+        static inline T Read(const std::vector<uint8_t>& data, std::size_t offset) {
+            T value;
+            std::memcpy(&value, data.data() + offset, sizeof(T));
+
+            return value;
+        }
+
+        template <typename T>
+        static inline void Write(std::vector<uint8_t>& data, std::size_t offset, T value) {
+            std::memcpy(data.data() + offset, &value, sizeof(T));
+        }
+
+        static std::vector<uint32_t> BuildDataFormatDescriptor(const Ktx2Format& format) {
+            uint32_t blockSize = TextureCompressor::GetBlockSize(format.Format);
+
+            // BC3 describes the alpha and the color halves of the block separately
+            std::vector<std::pair<uint32_t, uint32_t>> samples; // Bit offset, channel
+
+            if (format.Format == TextureFormat::BC3)
+                samples = { { 0, 15 }, { 64, 0 } };
+            else
+                samples = { { 0, 0 } };
+
+            uint32_t sampleBitLength = format.Format == TextureFormat::BC3 ? 64 : blockSize * 8;
+            uint32_t blockByteSize   = 24 + 16 * static_cast<uint32_t>(samples.size());
+
+            std::vector<uint32_t> descriptor = {
+                4 + blockByteSize,                              // Total size
+                0,                                              // Vendor, descriptor type
+                2 | (blockByteSize << 16),                      // Version, block size
+                format.ColorModel | (1u << 8) | (1u << 16),     // Model, BT709 primaries, linear transfer, no flags
+                3 | (3 << 8),                                   // Texel block dimensions minus one
+                blockSize,                                      // Bytes of plane 0
+                0                                               // Bytes of planes 4..7
+            };
+
+            for (const auto& [bitOffset, channel] : samples) {
+                descriptor.push_back(bitOffset | ((sampleBitLength - 1) << 16) | (channel << 24));
+                descriptor.push_back(0);
+                descriptor.push_back(0);
+                descriptor.push_back(0xffffffff);
+            }
+
+            return descriptor;
+        }
+
+    } // namespace Internal
+
+    Ref<Texture2D> TextureCompressor::Load(const std::string& filepath, TextureFormat format) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        assert(IsCompressed(format));
+
+        AssetManager::Hash hash;
+
+        if (!AssetManager::HashFile(filepath, hash))
+            return nullptr;
+
+        // An edited image gets another hash, so an existing entry is never stale
+        CompressedImage image;
+        std::string     cachePath = AssetManager::GetCachePath(hash, std::string(Internal::FindFormat(format)->Name) + ".ktx2");
+
+        if (std::filesystem::exists(cachePath) && ReadKtx2(cachePath, image) && image.Format == format)
+            return Texture2D::Create(image);
+
+        std::vector<uint8_t>              pixels;
+        std::vector<std::vector<uint8_t>> levels;
+        uint32_t                          width;
+        uint32_t                          height;
+
+        if (!AssetManager::LoadPixels(filepath, pixels, width, height)) {
+            ZIBEN_CORE_ERROR("TextureCompressor: can't decode {0}", filepath);
+            return nullptr;
+        }
+
+        GenerateMipChain(pixels, width, height, levels);
+
+        if (!Compress(levels, width, height, format, image)) {
+            ZIBEN_CORE_WARN("TextureCompressor: the driver can't encode {0}, {1} is loaded uncompressed", Internal::FindFormat(format)->Name, filepath);
+            return Texture2D::Create(filepath);
+        }
+
+        if (!AssetManager::WriteCache(cachePath, [&image](const std::string& path) { return WriteKtx2(path, image); }))
+            ZIBEN_CORE_WARN("TextureCompressor: can't write the cache {0}", cachePath);
+
+        auto texture = Texture2D::Create(image);
+
+        std::size_t uncompressedSize = std::accumulate(levels.begin(), levels.end(), std::size_t(0), [](std::size_t size, const auto& level) {
+            return size + level.size();
+        });
+
+        ZIBEN_CORE_INFO(
+            "TextureCompressor: {0} is cached as {1}, {2} KB instead of {3} KB",
+            filepath,
+            cachePath,
+            texture->GetMemorySize() / 1024,
+            uncompressedSize / 1024
+        );
+
+        return texture;
+    }
+
+    void TextureCompressor::GenerateMipChain(
+        const std::vector<uint8_t>&        pixels,
+        uint32_t                           width,
+        uint32_t                           height,
+        std::vector<std::vector<uint8_t>>& levels
+    ) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        assert(pixels.size() == static_cast<std::size_t>(width) * height * 4);
+
+        uint32_t levelCount = Texture2D::GetMipLevelCount(width, height);
+
+        levels.clear();
+        levels.reserve(levelCount);
+        levels.push_back(pixels);
+
+        for (uint32_t level = 1; level < levelCount; ++level) {
+            const auto& source = levels[level - 1];
+
+            uint32_t sourceWidth  = std::max(width >> (level - 1), 1u);
+            uint32_t sourceHeight = std::max(height >> (level - 1), 1u);
+            uint32_t levelWidth   = std::max(width >> level, 1u);
+            uint32_t levelHeight  = std::max(height >> level, 1u);
+
+            std::vector<uint8_t> destination(static_cast<std::size_t>(levelWidth) * levelHeight * 4);
+
+            for (uint32_t y = 0; y < levelHeight; ++y) {
+                for (uint32_t x = 0; x < levelWidth; ++x) {
+                    std::array<const uint8_t*, 4> texels = {
+                        &source[(static_cast<std::size_t>(std::min(2 * y + 0, sourceHeight - 1)) * sourceWidth + std::min(2 * x + 0, sourceWidth - 1)) * 4],
+                        &source[(static_cast<std::size_t>(std::min(2 * y + 0, sourceHeight - 1)) * sourceWidth + std::min(2 * x + 1, sourceWidth - 1)) * 4],
+                        &source[(static_cast<std::size_t>(std::min(2 * y + 1, sourceHeight - 1)) * sourceWidth + std::min(2 * x + 0, sourceWidth - 1)) * 4],
+                        &source[(static_cast<std::size_t>(std::min(2 * y + 1, sourceHeight - 1)) * sourceWidth + std::min(2 * x + 1, sourceWidth - 1)) * 4]
+                    };
+
+                    uint8_t* texel = &destination[(static_cast<std::size_t>(y) * levelWidth + x) * 4];
+                    uint32_t alpha = 0;
+
+                    for (const uint8_t* sourceTexel : texels)
+                        alpha += sourceTexel[3];
+
+                    for (uint32_t channel = 0; channel < 3; ++channel) {
+                        uint32_t sum = 0;
+
+                        for (const uint8_t* sourceTexel : texels)
+                            sum += alpha > 0 ? sourceTexel[channel] * sourceTexel[3] : sourceTexel[channel];
+
+                        texel[channel] = static_cast<uint8_t>(alpha > 0 ? (sum + alpha / 2) / alpha : (sum + 2) / 4);
+                    }
+
+                    texel[3] = static_cast<uint8_t>((alpha + 2) / 4);
+                }
+            }
+
+            levels.push_back(std::move(destination));
+        }
+    }
+
+    bool TextureCompressor::Compress(
+        const std::vector<std::vector<uint8_t>>& levels,
+        uint32_t                                 width,
+        uint32_t                                 height,
+        TextureFormat                            format,
+        CompressedImage&                         image
+    ) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        assert(IsCompressed(format) && !levels.empty());
+
+        image.Format = format;
+        image.Width  = width;
+        image.Height = height;
+        image.Levels.assign(levels.size(), {});
+
+        // Uncompressed data passed with a compressed internal format is encoded by the driver.
+        // Immutable storage doesn't allow that, so a mutable texture is used for the conversion
+        HandleType handle       = 0;
+        bool       isCompressed = true;
+
+        glCreateTextures(GL_TEXTURE_2D, 1, &handle);
+        RenderState::BindTextureUnit(0, handle);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        for (uint32_t level = 0; level < levels.size() && isCompressed; ++level) {
+            glTexImage2D(
+                GL_TEXTURE_2D,                                         // Target
+                static_cast<GLint>(level),                             // Level
+                static_cast<GLint>(GetInternalFormat(format)),         // Internal format
+                static_cast<GLsizei>(std::max(width >> level, 1u)),    // Width
+                static_cast<GLsizei>(std::max(height >> level, 1u)),   // Height
+                0,                                                     // Border
+                GL_RGBA,                                               // GL format
+                GL_UNSIGNED_BYTE,                                      // GL type
+                levels[level].data()                                   // pixels
+            );
+
+            GLint isLevelCompressed = GL_FALSE;
+            GLint size              = 0;
+
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, static_cast<GLint>(level), GL_TEXTURE_COMPRESSED, &isLevelCompressed);
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, static_cast<GLint>(level), GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size);
+
+            isCompressed = isLevelCompressed == GL_TRUE && static_cast<std::size_t>(size) == Internal::GetLevelSize(format, width, height, level);
+
+            if (isCompressed) {
+                image.Levels[level].resize(static_cast<std::size_t>(size));
+                glGetCompressedTexImage(GL_TEXTURE_2D, static_cast<GLint>(level), image.Levels[level].data());
+            }
+        }
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        RenderState::BindTextureUnit(0, 0);
+        RenderState::OnTextureDeleted(handle);
+        glDeleteTextures(1, &handle);
+
+        if (!isCompressed)
+            image.Levels.clear();
+
+        return isCompressed;
+    }
+
+    bool TextureCompressor::ReadKtx2(const std::string& filepath, CompressedImage& image) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        std::ifstream inputStream(filepath, std::ios_base::in | std::ios_base::binary);
+
+        if (!inputStream) {
+            ZIBEN_CORE_ERROR("TextureCompressor: can't open the file by provided path: {0}", filepath);
+            return false;
+        }
+
+        std::vector<uint8_t> data((std::istreambuf_iterator<char>(inputStream)), std::istreambuf_iterator<char>());
+
+        if (data.size() < Internal::s_Ktx2HeaderSize || !std::equal(Internal::s_Ktx2Identifier.begin(), Internal::s_Ktx2Identifier.end(), data.begin())) {
+            ZIBEN_CORE_ERROR("TextureCompressor: {0} isn't a KTX2 file", filepath);
+            return false;
+        }
+
+        const auto* format           = Internal::FindFormat(Internal::Read<uint32_t>(data, 12));
+        uint32_t    width            = Internal::Read<uint32_t>(data, 20);
+        uint32_t    height           = Internal::Read<uint32_t>(data, 24);
+        uint32_t    depth            = Internal::Read<uint32_t>(data, 28);
+        uint32_t    layerCount       = Internal::Read<uint32_t>(data, 32);
+        uint32_t    faceCount        = Internal::Read<uint32_t>(data, 36);
+        uint32_t    levelCount       = std::max(Internal::Read<uint32_t>(data, 40), 1u);
+        uint32_t    supercompression = Internal::Read<uint32_t>(data, 44);
+
+        if (!format || width == 0 || height == 0 || depth > 0 || layerCount > 1 || faceCount != 1 || supercompression != 0) {
+            ZIBEN_CORE_ERROR("TextureCompressor: {0} isn't a plain BC1, BC3 or BC7 2D texture", filepath);
+            return false;
+        }
+
+        if (levelCount > Texture2D::GetMipLevelCount(width, height) || data.size() < Internal::s_Ktx2HeaderSize + levelCount * Internal::s_Ktx2LevelEntrySize) {
+            ZIBEN_CORE_ERROR("TextureCompressor: {0} has a broken level index", filepath);
+            return false;
+        }
+
+        image.Format = format->Format;
+        image.Width  = width;
+        image.Height = height;
+        image.Levels.assign(levelCount, {});
+
+        for (uint32_t level = 0; level < levelCount; ++level) {
+            std::size_t entry  = Internal::s_Ktx2HeaderSize + level * Internal::s_Ktx2LevelEntrySize;
+            uint64_t    offset = Internal::Read<uint64_t>(data, entry + 0);
+            uint64_t    size   = Internal::Read<uint64_t>(data, entry + 8);
+
+            if (size != Internal::GetLevelSize(image.Format, width, height, level) || offset > data.size() || size > data.size() - offset) {
+                ZIBEN_CORE_ERROR("TextureCompressor: level {0} of {1} is out of the file", level, filepath);
+                image.Levels.clear();
+
+                return false;
+            }
+
+            image.Levels[level].assign(data.begin() + static_cast<std::ptrdiff_t>(offset), data.begin() + static_cast<std::ptrdiff_t>(offset + size));
+        }
+
+        return true;
+    }
+
+    bool TextureCompressor::WriteKtx2(const std::string& filepath, const CompressedImage& image) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        const auto* format = Internal::FindFormat(image.Format);
+
+        assert(format && !image.Levels.empty());
+
+        auto        descriptor     = Internal::BuildDataFormatDescriptor(*format);
+        auto        levelCount     = static_cast<uint32_t>(image.Levels.size());
+        std::size_t descriptorBase = Internal::s_Ktx2HeaderSize + levelCount * Internal::s_Ktx2LevelEntrySize;
+        std::size_t descriptorSize = descriptor.size() * sizeof(uint32_t);
+        std::size_t alignment      = GetBlockSize(image.Format);
+
+        // Levels are stored from the smallest one, each aligned to the block size
+        std::vector<std::size_t> offsets(levelCount);
+        std::size_t              size = descriptorBase + descriptorSize;
+
+        for (uint32_t level = levelCount; level-- > 0;) {
+            size           = (size + alignment - 1) / alignment * alignment;
+            offsets[level] = size;
+            size          += image.Levels[level].size();
+        }
+
+        std::vector<uint8_t> data(size, 0);
+
+        std::copy(Internal::s_Ktx2Identifier.begin(), Internal::s_Ktx2Identifier.end(), data.begin());
+
+        Internal::Write<uint32_t>(data, 12, format->VkFormat);
+        Internal::Write<uint32_t>(data, 16, 1);                                            // Type size
+        Internal::Write<uint32_t>(data, 20, image.Width);
+        Internal::Write<uint32_t>(data, 24, image.Height);
+        Internal::Write<uint32_t>(data, 28, 0);                                            // Depth
+        Internal::Write<uint32_t>(data, 32, 0);                                            // Layer count
+        Internal::Write<uint32_t>(data, 36, 1);                                            // Face count
+        Internal::Write<uint32_t>(data, 40, levelCount);
+        Internal::Write<uint32_t>(data, 44, 0);                                            // Supercompression
+        Internal::Write<uint32_t>(data, 48, static_cast<uint32_t>(descriptorBase));
+        Internal::Write<uint32_t>(data, 52, static_cast<uint32_t>(descriptorSize));
+
+        for (uint32_t level = 0; level < levelCount; ++level) {
+            std::size_t entry = Internal::s_Ktx2HeaderSize + level * Internal::s_Ktx2LevelEntrySize;
+
+            Internal::Write<uint64_t>(data, entry + 0,  offsets[level]);
+            Internal::Write<uint64_t>(data, entry + 8,  image.Levels[level].size());
+            Internal::Write<uint64_t>(data, entry + 16, image.Levels[level].size());
+
+            std::copy(image.Levels[level].begin(), image.Levels[level].end(), data.begin() + static_cast<std::ptrdiff_t>(offsets[level]));
+        }
+
+        std::memcpy(data.data() + descriptorBase, descriptor.data(), descriptorSize);
+
+        std::ofstream outputStream(filepath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        outputStream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+        return outputStream.good();
+    }
+
+    bool TextureCompressor::IsCompressed(TextureFormat format) {
+        return Internal::FindFormat(format) != nullptr;
+    }
+
+    uint32_t TextureCompressor::GetInternalFormat(TextureFormat format) {
+        switch (format) {
+            case TextureFormat::BC1: return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+            case TextureFormat::BC3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+            case TextureFormat::BC7: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+            default:                 break;
+        }
+
+        assert(false);
+        return 0;
+    }
+
+    uint32_t TextureCompressor::GetBlockSize(TextureFormat format) {
+        return format == TextureFormat::BC1 ? 8 : 16;
+    }
+
+} // namespace Ziben
\ No newline at end of file
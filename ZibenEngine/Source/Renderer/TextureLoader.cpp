@@ -0,0 +1,341 @@
+#include "TextureLoader.hpp"
+
+#include "AssetManager.hpp"
+
+namespace Ziben {
+
+    AsyncTexture2D::AsyncTexture2D(std::string filepath)
+        : m_Filepath(std::move(filepath))
+        , m_State(State::Decoding)
+        , m_Hash(0)
+        , m_Width(0)
+        , m_Height(0)
+        , m_UploadedRows(0) {}
+
+    const Ref<Texture2D>& AsyncTexture2D::GetTexture() const {
+        return m_State == State::Ready ? m_Texture : TextureLoader::GetPlaceholder();
+    }
+
+    void TextureLoader::Init(uint32_t workerCount) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data = GetData();
+
+        // Placeholder
+        uint32_t placeholderData = 0xffffffff;
+
+        data.Placeholder = Texture2D::Create(1, 1);
+        data.Placeholder->SetData(&placeholderData, sizeof(placeholderData));
+
+        // Staging buffers stay mapped, the fences guard the regions the GPU may still read
+        for (auto& stagingBuffer : data.StagingBuffers)
+            stagingBuffer.Buffer = GpuBuffer::Create(s_StagingBufferSize, BufferStorage::Persistent);
+
+        // Workers, one core is left to the main thread
+        if (workerCount == 0)
+            workerCount = std::clamp(std::thread::hardware_concurrency(), 2u, s_MaxWorkerCount + 1) - 1;
+
+        data.IsRunning = true;
+
+        for (uint32_t i = 0; i < workerCount; ++i)
+            data.Workers.emplace_back(RunWorker);
+
+        ZIBEN_CORE_INFO("TextureLoader: {0} decode workers", workerCount);
+    }
+
+    void TextureLoader::Shutdown() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data = GetData();
+
+        {
+            std::lock_guard lock(data.Mutex);
+
+            data.IsRunning    = false;
+            data.DecodeQueue  = {};
+            data.DecodedQueue = {};
+        }
+
+        data.Condition.notify_all();
+
+        for (auto& worker : data.Workers)
+            worker.join();
+
+        data.Workers.clear();
+
+        for (auto& stagingBuffer : data.StagingBuffers) {
+            if (stagingBuffer.Fence)
+                glDeleteSync(stagingBuffer.Fence);
+
+            stagingBuffer = {};
+        }
+
+        data.Textures.clear();
+        data.UploadQueue = {};
+        data.Placeholder = nullptr;
+    }
+
+    Ref<AsyncTexture2D> TextureLoader::Load(const std::string& filepath) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data = GetData();
+
+        if (auto it = data.Textures.find(filepath); it != data.Textures.end()) {
+            if (auto texture = it->second.lock())
+                return texture;
+        }
+
+        auto texture = CreateRef<AsyncTexture2D>(filepath);
+
+        data.Textures[filepath] = texture;
+
+        // The path was loaded through the AssetManager or by a request that was dropped since
+        if (auto loadedTexture = AssetManager::FindTexture(filepath)) {
+            texture->m_Texture = loadedTexture;
+            texture->m_State   = AsyncTexture2D::State::Ready;
+
+            return texture;
+        }
+
+        if (GetStatistics().PendingCount++ == 0) {
+            data.BatchBegin        = std::chrono::steady_clock::now();
+            data.BatchTextureCount = 0;
+            data.BatchBytes        = 0;
+        }
+
+        {
+            std::lock_guard lock(data.Mutex);
+            data.DecodeQueue.push(texture);
+        }
+
+        data.Condition.notify_one();
+
+        return texture;
+    }
+
+    void TextureLoader::Update(std::size_t uploadBudget) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto& data       = GetData();
+        auto& statistics = GetStatistics();
+
+        statistics.FrameUploadedBytes = 0;
+
+        if (statistics.PendingCount == 0)
+            return;
+
+        std::vector<Ref<AsyncTexture2D>> decodedTextures;
+
+        {
+            std::lock_guard lock(data.Mutex);
+
+            for (; !data.DecodedQueue.empty(); data.DecodedQueue.pop())
+                decodedTextures.push_back(std::move(data.DecodedQueue.front()));
+        }
+
+        for (auto& texture : decodedTextures) {
+            if (texture->m_Pixels.empty()) {
+                ZIBEN_CORE_ERROR("TextureLoader: can't decode {0}", texture->m_Filepath);
+
+                texture->m_State = AsyncTexture2D::State::Failed;
+
+                ++statistics.FailedCount;
+                --statistics.PendingCount;
+
+                continue;
+            }
+
+            // The same image under another path
+            if (auto loadedTexture = AssetManager::FindTexture(texture->m_Hash)) {
+                FinishTexture(*texture, loadedTexture);
+                continue;
+            }
+
+            texture->m_State = AsyncTexture2D::State::Uploading;
+            data.UploadQueue.push(std::move(texture));
+        }
+
+        if (!data.UploadQueue.empty()) {
+            std::size_t uploadedSize = UploadRows(uploadBudget);
+
+            statistics.FrameUploadedBytes  = uploadedSize;
+            statistics.UploadedBytes      += uploadedSize;
+            data.BatchBytes               += uploadedSize;
+        }
+
+        if (statistics.PendingCount == 0)
+            FinishBatch();
+    }
+
+    const Ref<Texture2D>& TextureLoader::GetPlaceholder() {
+        return GetData().Placeholder;
+    }
+
+    TextureLoader::Statistics& TextureLoader::GetStatistics() {
+        static Statistics statistics;
+        return statistics;
+    }
+
+    TextureLoader::Data& TextureLoader::GetData() {
+        static Data data;
+        return data;
+    }
+
+    void TextureLoader::RunWorker() {
+        auto& data = GetData();
+
+        while (true) {
+            Ref<AsyncTexture2D> texture;
+
+            {
+                std::unique_lock lock(data.Mutex);
+                data.Condition.wait(lock, [&data] { return !data.IsRunning || !data.DecodeQueue.empty(); });
+
+                if (!data.IsRunning)
+                    return;
+
+                texture = std::move(data.DecodeQueue.front());
+                data.DecodeQueue.pop();
+            }
+
+            {
+                ZIBEN_PROFILE_SCOPE("TextureLoader::RunWorker: AssetManager::LoadPixels");
+
+                // Failed textures are reported by Update with empty pixels
+                if (!AssetManager::LoadPixels(texture->m_Filepath, texture->m_Pixels, texture->m_Width, texture->m_Height, texture->m_Hash))
+                    texture->m_Pixels.clear();
+            }
+
+            std::lock_guard lock(data.Mutex);
+            data.DecodedQueue.push(std::move(texture));
+        }
+    }
+
+    std::size_t TextureLoader::UploadRows(std::size_t uploadBudget) {
+        auto& data          = GetData();
+        auto& statistics    = GetStatistics();
+        auto& stagingBuffer = data.StagingBuffers[data.StagingBufferIndex];
+
+        // The buffer was filled s_StagingBufferCount frames ago, the GPU rarely lags that far behind
+        if (stagingBuffer.Fence) {
+            if (glClientWaitSync(stagingBuffer.Fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+                ++statistics.StagingStalls;
+                return 0;
+            }
+
+            glDeleteSync(stagingBuffer.Fence);
+            stagingBuffer.Fence = nullptr;
+        }
+
+        std::size_t budget = std::min(uploadBudget, s_StagingBufferSize);
+        std::size_t offset = 0;
+
+        GpuBuffer::Bind(stagingBuffer.Buffer, GL_PIXEL_UNPACK_BUFFER);
+
+        while (!data.UploadQueue.empty()) {
+            auto& texture = data.UploadQueue.front();
+
+            // Nobody holds the texture anymore
+            if (texture.use_count() == 1) {
+                --statistics.PendingCount;
+                data.UploadQueue.pop();
+
+                continue;
+            }
+
+            std::size_t rowSize  = static_cast<std::size_t>(texture->m_Width) * 4;
+            std::size_t rowCount = std::min<std::size_t>((budget - offset) / rowSize, texture->m_Height - texture->m_UploadedRows);
+
+            // At least one row per frame, so a tiny budget still makes progress
+            if (rowCount == 0 && offset == 0 && rowSize <= s_StagingBufferSize)
+                rowCount = 1;
+
+            if (rowCount == 0)
+                break;
+
+            if (!texture->m_Texture)
+                texture->m_Texture = Texture2D::Create(
+                    texture->m_Width,
+                    texture->m_Height,
+                    TextureFormat::RGBA8,
+                    Texture2D::GetMipLevelCount(texture->m_Width, texture->m_Height)
+                );
+
+            std::size_t size = rowCount * rowSize;
+
+            std::memcpy(stagingBuffer.Buffer->GetMappedData() + offset, texture->m_Pixels.data() + texture->m_UploadedRows * rowSize, size);
+
+            // With a bound unpack buffer the data pointer is an offset into the buffer
+            texture->m_Texture->SetData(
+                reinterpret_cast<const void*>(offset),
+                0,
+                texture->m_UploadedRows,
+                texture->m_Width,
+                static_cast<uint32_t>(rowCount),
+                texture->m_Width
+            );
+
+            offset                  += size;
+            texture->m_UploadedRows += static_cast<uint32_t>(rowCount);
+
+            if (texture->m_UploadedRows < texture->m_Height)
+                continue;
+
+            texture->m_Texture->GenerateMipmaps();
+
+            // LoadTexture may have created the same image while the rows were uploaded
+            auto loadedTexture = AssetManager::FindTexture(texture->m_Hash);
+            FinishTexture(*texture, loadedTexture ? loadedTexture : texture->m_Texture);
+
+            ++data.BatchTextureCount;
+
+            data.UploadQueue.pop();
+        }
+
+        GpuBuffer::Unbind(GL_PIXEL_UNPACK_BUFFER);
+
+        if (offset > 0) {
+            stagingBuffer.Fence     = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            data.StagingBufferIndex = (data.StagingBufferIndex + 1) % s_StagingBufferCount;
+        }
+
+        return offset;
+    }
+
+    void TextureLoader::FinishTexture(AsyncTexture2D& texture, Ref<Texture2D> loadedTexture) {
+        auto& statistics = GetStatistics();
+
+        AssetManager::RegisterTexture(texture.m_Filepath, texture.m_Hash, loadedTexture);
+
+        texture.m_Texture = std::move(loadedTexture);
+        texture.m_Pixels  = {};
+        texture.m_State   = AsyncTexture2D::State::Ready;
+
+        ++statistics.LoadedCount;
+        --statistics.PendingCount;
+    }
+
+    void TextureLoader::FinishBatch() {
+        auto& data       = GetData();
+        auto& statistics = GetStatistics();
+
+        float milliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - data.BatchBegin).count();
+        float megabytes    = static_cast<float>(data.BatchBytes) / (1024.0f * 1024.0f);
+
+        statistics.BatchTextureCount = data.BatchTextureCount;
+        statistics.BatchBytes        = data.BatchBytes;
+        statistics.BatchMilliseconds = milliseconds;
+        statistics.BatchThroughput   = milliseconds > 0.0f ? megabytes / (milliseconds / 1000.0f) : 0.0f;
+
+        ZIBEN_CORE_INFO(
+            "TextureLoader: {0} textures, {1:.2f} MB in {2:.1f} ms ({3:.1f} MB/s)",
+            statistics.BatchTextureCount,
+            megabytes,
+            statistics.BatchMilliseconds,
+            statistics.BatchThroughput
+        );
+
+        std::erase_if(data.Textures, [](const auto& item) { return item.second.expired(); });
+    }
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,30 @@
+#include "UniformBuffer.hpp"
+
+#include "RenderState.hpp"
+
+namespace Ziben {
+
+    Ref<UniformBuffer> UniformBuffer::Create(std::size_t size, BufferUsage usage) {
+        return CreateRef<UniformBuffer>(size, usage);
+    }
+
+    void UniformBuffer::Bind(const Ref<UniformBuffer>& uniformBuffer, uint32_t binding) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        RenderState::BindBufferBase(GL_UNIFORM_BUFFER, binding, uniformBuffer->GetHandle());
+    }
+
+    void UniformBuffer::Unbind(uint32_t binding) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        RenderState::BindBufferBase(GL_UNIFORM_BUFFER, binding, 0);
+    }
+
+    UniformBuffer::UniformBuffer(std::size_t size, BufferUsage usage)
+        : m_Buffer(nullptr, size, BufferStorage::Immutable, usage) {}
+
+    void UniformBuffer::SetData(const void* data, std::size_t size, std::size_t offset) const {
+        m_Buffer.SetData(data, size, offset);
+    }
+
+} // namespace Ziben
\ No newline at end of file
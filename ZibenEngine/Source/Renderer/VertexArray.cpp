@@ -1,5 +1,7 @@
 #include "VertexArray.hpp"
 
+#include "RenderState.hpp"
+
 namespace Ziben {
 
     Ref<VertexArray> VertexArray::Create() {
@@ -9,66 +11,58 @@ namespace Ziben {
     void VertexArray::Bind(const Ref<VertexArray>& vertexArray) {
         ZIBEN_PROFILE_FUNCTION();
 
-        glBindVertexArray(vertexArray->m_Handle);
+        RenderState::BindVertexArray(vertexArray->m_Handle);
     }
 
     void VertexArray::Unbind() {
         ZIBEN_PROFILE_FUNCTION();
 
-        glBindVertexArray(0);
+        RenderState::BindVertexArray(0);
     }
 
     VertexArray::VertexArray()
         : m_Handle(0)
-        , m_VertexBufferIndex(0)
+        , m_AttributeIndex(0)
         , m_IndexBuffer(nullptr) {
 
         ZIBEN_PROFILE_FUNCTION();
 
-        glGenVertexArrays(1, &m_Handle);
+        glCreateVertexArrays(1, &m_Handle);
     }
 
     VertexArray::~VertexArray() {
         ZIBEN_PROFILE_FUNCTION();
 
+        RenderState::OnVertexArrayDeleted(m_Handle);
         glDeleteVertexArrays(1, &m_Handle);
     }
 
     void VertexArray::PushVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) {
-        // Bind Current VertexArray
-        glBindVertexArray(m_Handle);
+        const auto& layout  = vertexBuffer->GetLayout();
+        auto        binding = static_cast<uint32_t>(m_VertexBuffers.size());
 
-        // Bind VertexBuffer
-        VertexBuffer::Bind(vertexBuffer);
+        // Each vertex buffer gets its own binding, the attributes only refer to it
+        glVertexArrayVertexBuffer(m_Handle, binding, vertexBuffer->GetHandle(), 0, static_cast<GLsizei>(layout.GetStride()));
+        glVertexArrayBindingDivisor(m_Handle, binding, layout.GetDivisor());
 
         m_VertexBuffers.push_back(vertexBuffer);
 
-        for (const auto& element : vertexBuffer->GetLayout()) {
-//            switch
-//            glEnableVertexAttribArray(m_VertexBufferIndex);
-//            glVertexAttribPointer(
-//                m_VertexBufferIndex++,
-//                ShaderData::GetCount(element.Type),
-//                ShaderData::ToNativeType(element.Type),
-//                element.IsNormalized,
-//                static_cast<GLsizei>(vertexBuffer->GetLayout().GetStride()),
-//                (const void*)element.Offset
-//            );
-
+        for (const auto& element : layout) {
             switch (element.Type) {
                 case ShaderData::Type::Float:
                 case ShaderData::Type::Float2:
                 case ShaderData::Type::Float3:
                 case ShaderData::Type::Float4: {
-                    glEnableVertexAttribArray(m_VertexBufferIndex);
-                    glVertexAttribPointer(
-                        m_VertexBufferIndex++,
+                    glEnableVertexArrayAttrib(m_Handle, m_AttributeIndex);
+                    glVertexArrayAttribFormat(
+                        m_Handle,
+                        m_AttributeIndex,
                         ShaderData::GetCount(element.Type),
                         ShaderData::ToNativeType(element.Type),
                         element.IsNormalized,
-                        static_cast<GLsizei>(vertexBuffer->GetLayout().GetStride()),
-                        reinterpret_cast<const void *>(element.Offset)
+                        static_cast<GLuint>(element.Offset)
                     );
+                    glVertexArrayAttribBinding(m_Handle, m_AttributeIndex++, binding);
 
                     break;
                 }
@@ -78,33 +72,35 @@ namespace Ziben {
                 case ShaderData::Type::Int3:
                 case ShaderData::Type::Int4:
                 case ShaderData::Type::Bool: {
-                    glEnableVertexAttribArray(m_VertexBufferIndex);
-                    glVertexAttribIPointer(
-                        m_VertexBufferIndex++,
+                    glEnableVertexArrayAttrib(m_Handle, m_AttributeIndex);
+                    glVertexArrayAttribIFormat(
+                        m_Handle,
+                        m_AttributeIndex,
                         ShaderData::GetCount(element.Type),
                         ShaderData::ToNativeType(element.Type),
-                        static_cast<GLsizei>(vertexBuffer->GetLayout().GetStride()),
-                        reinterpret_cast<const void *>(element.Offset)
+                        static_cast<GLuint>(element.Offset)
                     );
+                    glVertexArrayAttribBinding(m_Handle, m_AttributeIndex++, binding);
 
                     break;
                 }
 
+                // A matrix takes an attribute per column
                 case ShaderData::Type::Mat3:
                 case ShaderData::Type::Mat4: {
-                    int count = ShaderData::GetCount(element.Type);
-
-                    for (int i = 0; i < count; ++i) {
-                        glVertexAttribPointer(
-                            m_VertexBufferIndex++,
-                            count,
+                    int columnCount = element.Type == ShaderData::Type::Mat3 ? 3 : 4;
+
+                    for (int i = 0; i < columnCount; ++i) {
+                        glEnableVertexArrayAttrib(m_Handle, m_AttributeIndex);
+                        glVertexArrayAttribFormat(
+                            m_Handle,
+                            m_AttributeIndex,
+                            columnCount,
                             ShaderData::ToNativeType(element.Type),
                             element.IsNormalized,
-                            static_cast<GLsizei>(vertexBuffer->GetLayout().GetStride()),
-                            reinterpret_cast<const void *>(element.Offset + sizeof(float) * count * i)
+                            static_cast<GLuint>(element.Offset + sizeof(float) * columnCount * i)
                         );
-
-                        glVertexAttribDivisor(m_VertexBufferIndex, 1);
+                        glVertexArrayAttribBinding(m_Handle, m_AttributeIndex++, binding);
                     }
 
                     break;
@@ -116,11 +112,7 @@ namespace Ziben {
     }
 
     void VertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) {
-        // Bind Current VertexArray
-        glBindVertexArray(m_Handle);
-
-        // Bind IndexBuffer
-        IndexBuffer::Bind(indexBuffer);
+        glVertexArrayElementBuffer(m_Handle, indexBuffer->GetHandle());
 
         m_IndexBuffer = indexBuffer;
     }
@@ -1,5 +1,7 @@
 #include "VertexBuffer.hpp"
 
+#include "RenderState.hpp"
+
 namespace Ziben {
 
     Ref<VertexBuffer> VertexBuffer::Create(std::size_t size) {
@@ -13,52 +15,27 @@ namespace Ziben {
     void VertexBuffer::Bind(const Ref<VertexBuffer>& vertexBuffer) {
         ZIBEN_PROFILE_FUNCTION();
 
-        glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer->m_Handle);
+        RenderState::BindBuffer(GL_ARRAY_BUFFER, vertexBuffer->GetHandle());
     }
 
     void VertexBuffer::Unbind() {
         ZIBEN_PROFILE_FUNCTION();
 
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        RenderState::BindBuffer(GL_ARRAY_BUFFER, 0);
     }
 
     VertexBuffer::VertexBuffer(std::size_t size)
-        : m_Handle(0)
-        , m_Size(size)
-        , m_Usage(BufferUsage::Dynamic) {
-
-        ZIBEN_PROFILE_FUNCTION();
-
-        glGenBuffers(1, &m_Handle);
-        glBindBuffer(GL_ARRAY_BUFFER, m_Handle);
-        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_Size), nullptr, static_cast<GLenum>(m_Usage));
-    }
+        : m_Buffer(nullptr, size, BufferStorage::Immutable, BufferUsage::Dynamic) {}
 
     VertexBuffer::VertexBuffer(const void* data, std::size_t size, BufferUsage usage)
-        : m_Handle(0)
-        , m_Size(size)
-        , m_Usage(usage) {
-
-        ZIBEN_PROFILE_FUNCTION();
-
-        glGenBuffers(1, &m_Handle);
-        glBindBuffer(GL_ARRAY_BUFFER, m_Handle);
-        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_Size), data, static_cast<GLenum>(m_Usage));
-    }
-
-    VertexBuffer::~VertexBuffer() {
-        ZIBEN_PROFILE_FUNCTION();
-
-        glDeleteBuffers(1, &m_Handle);
-    }
+        : m_Buffer(data, size, BufferStorage::Immutable, usage) {}
 
     void VertexBuffer::SetLayout(const VertexBufferLayout& layout) {
         m_Layout = layout;
     }
 
-    void VertexBuffer::SetData(const void* data, std::size_t size) const {
-        glBindBuffer(GL_ARRAY_BUFFER, m_Handle);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(size), data);
+    void VertexBuffer::SetData(const void* data, std::size_t size, std::size_t offset) const {
+        m_Buffer.SetData(data, size, offset);
     }
 
 } // namespace Ziben
\ No newline at end of file
@@ -3,11 +3,13 @@
 namespace Ziben {
 
     VertexBufferLayout::VertexBufferLayout()
-        : m_Stride(0) {}
+        : m_Stride(0)
+        , m_Divisor(0) {}
 
-    VertexBufferLayout::VertexBufferLayout(std::initializer_list<Element> elements)
+    VertexBufferLayout::VertexBufferLayout(std::initializer_list<Element> elements, uint32_t divisor)
         : m_Elements(elements)
-        , m_Stride(0) {
+        , m_Stride(0)
+        , m_Divisor(divisor) {
 
         for (auto& element : m_Elements) {
             element.Offset  = m_Stride;
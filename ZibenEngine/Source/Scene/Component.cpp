@@ -5,70 +5,256 @@
 
 namespace Ziben {
 
+    namespace Internal {
+
+        struct ScriptBinding {
+            const char*                              Name;
+            NativeScriptComponent::InstantiateScript Instantiate;
+            NativeScriptComponent::DestroyScript     Destroy;
+        };
+
+        static std::unordered_map<std::string_view, ScriptBinding>& GetScriptBindings() {
+            static std::unordered_map<std::string_view, ScriptBinding> bindings;
+            return bindings;
+        }
+
+    } // namespace Internal
+
     TransformComponent::TransformComponent(const glm::vec3& translation)
         : m_Translation(translation)
         , m_Rotation(0.0f)
-        , m_Scale(1.0f) {}
+        , m_Scale(1.0f)
+        , m_Transform(1.0f)
+        , m_IsTransformDirty(true) {}
 
-    glm::mat4 TransformComponent::GetTransform() const {
-        glm::mat4 translation = glm::translate(glm::mat4(1.0f), m_Translation);
-        glm::mat4 rotation    = glm::toMat4(glm::quat(m_Rotation));
-        glm::mat4 scale       = glm::scale(glm::mat4(1.0f), m_Scale);
+    const glm::mat4& TransformComponent::GetTransform() const {
+        if (m_IsTransformDirty) {
+            glm::mat4 translation = glm::translate(glm::mat4(1.0f), m_Translation);
+            glm::mat4 rotation    = glm::toMat4(glm::quat(m_Rotation));
+            glm::mat4 scale       = glm::scale(glm::mat4(1.0f), m_Scale);
 
-        return translation * rotation * scale;
+            m_Transform        = translation * rotation * scale;
+            m_IsTransformDirty = false;
+        }
+
+        return m_Transform;
     }
 
     void TransformComponent::SetX(float x) {
-        m_Translation.x = x;
+        m_Translation.x    = x;
+        m_IsTransformDirty = true;
     }
 
     void TransformComponent::SetY(float y) {
-        m_Translation.y = y;
+        m_Translation.y    = y;
+        m_IsTransformDirty = true;
     }
 
     void TransformComponent::SetZ(float z) {
-        m_Translation.z = z;
+        m_Translation.z    = z;
+        m_IsTransformDirty = true;
     }
 
     void TransformComponent::SetTranslation(const glm::vec3& translation) {
-        m_Translation = translation;
+        m_Translation      = translation;
+        m_IsTransformDirty = true;
     }
 
     void TransformComponent::SetRotationX(float rotationX) {
-        m_Rotation.x = rotationX;
+        m_Rotation.x       = rotationX;
+        m_IsTransformDirty = true;
     }
 
     void TransformComponent::SetRotationY(float rotationY) {
-        m_Rotation.y = rotationY;
+        m_Rotation.y       = rotationY;
+        m_IsTransformDirty = true;
     }
 
     void TransformComponent::SetRotationZ(float rotationZ) {
-        m_Rotation.z = rotationZ;
+        m_Rotation.z       = rotationZ;
+        m_IsTransformDirty = true;
     }
 
     void TransformComponent::SetRotation(const glm::vec3& rotation) {
-        m_Rotation = rotation;
+        m_Rotation         = rotation;
+        m_IsTransformDirty = true;
     }
 
     void TransformComponent::SetScaleX(float scaleX) {
-        m_Scale.x = scaleX;
+        m_Scale.x          = scaleX;
+        m_IsTransformDirty = true;
     }
 
     void TransformComponent::SetScaleY(float scaleY) {
-        m_Scale.y = scaleY;
+        m_Scale.y          = scaleY;
+        m_IsTransformDirty = true;
     }
 
     void TransformComponent::SetScaleZ(float scaleZ) {
-        m_Scale.z = scaleZ;
+        m_Scale.z          = scaleZ;
+        m_IsTransformDirty = true;
     }
 
     void TransformComponent::SetScale(const glm::vec3& scale) {
-        m_Scale = scale;
+        m_Scale            = scale;
+        m_IsTransformDirty = true;
+    }
+
+    TilemapComponent::TilemapComponent(uint32_t width, uint32_t height)
+        : m_Width(0)
+        , m_Height(0) {
+        Resize(width, height);
+    }
+
+    glm::mat4 TilemapComponent::GetQuadTransform() const {
+        glm::vec3 size = glm::vec3(m_Width, m_Height, 1.0f);
+        return glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.5f * size.x, 0.5f * size.y, 0.0f)), size);
+    }
+
+    void TilemapComponent::Resize(uint32_t width, uint32_t height) {
+        width  = std::min(width, MaxSize);
+        height = std::min(height, MaxSize);
+
+        if (width == m_Width && height == m_Height)
+            return;
+
+        std::vector<TileType> tiles(static_cast<std::size_t>(width) * height, EmptyTile);
+
+        uint32_t copyWidth  = std::min(width, m_Width);
+        uint32_t copyHeight = std::min(height, m_Height);
+
+        for (uint32_t y = 0; y < copyHeight; ++y) {
+            auto source = m_Tiles.begin() + static_cast<std::size_t>(y) * m_Width;
+            std::copy(source, source + copyWidth, tiles.begin() + static_cast<std::size_t>(y) * width);
+        }
+
+        // Revisions keep growing across resizes, so none of the chunks can match a stale upload
+        uint32_t revision = 1;
+
+        for (uint32_t chunkRevision : m_ChunkRevisions)
+            revision = std::max(revision, chunkRevision + 1);
+
+        m_Width  = width;
+        m_Height = height;
+        m_Tiles  = std::move(tiles);
+
+        m_ChunkRevisions.assign(static_cast<std::size_t>(GetChunkCountX()) * GetChunkCountY(), revision);
+    }
+
+    void TilemapComponent::SetTile(uint32_t x, uint32_t y, TileType tile) {
+        assert(x < m_Width && y < m_Height);
+
+        TileType& current = m_Tiles[static_cast<std::size_t>(y) * m_Width + x];
+
+        if (current == tile)
+            return;
+
+        current = tile;
+        ++m_ChunkRevisions[(y / ChunkSize) * GetChunkCountX() + x / ChunkSize];
+    }
+
+    void TilemapComponent::Fill(uint32_t x, uint32_t y, uint32_t width, uint32_t height, TileType tile) {
+        if (x >= m_Width || y >= m_Height)
+            return;
+
+        width  = std::min(width, m_Width - x);
+        height = std::min(height, m_Height - y);
+
+        for (uint32_t row = y; row < y + height; ++row) {
+            auto begin = m_Tiles.begin() + static_cast<std::size_t>(row) * m_Width + x;
+            std::fill(begin, begin + width, tile);
+        }
+
+        MarkChunks(x, y, width, height);
+    }
+
+    void TilemapComponent::SetTiles(std::size_t offset, std::size_t count, TileType tile) {
+        if (offset >= m_Tiles.size())
+            return;
+
+        count = std::min(count, m_Tiles.size() - offset);
+        std::fill_n(m_Tiles.begin() + offset, count, tile);
+
+        MarkChunks(offset, count);
+    }
+
+    void TilemapComponent::SetTiles(std::size_t offset, const TileType* tiles, std::size_t count) {
+        if (offset >= m_Tiles.size())
+            return;
+
+        count = std::min(count, m_Tiles.size() - offset);
+        std::copy_n(tiles, count, m_Tiles.begin() + offset);
+
+        MarkChunks(offset, count);
+    }
+
+    void TilemapComponent::MarkChunks(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+        if (width == 0 || height == 0)
+            return;
+
+        uint32_t chunkCountX = GetChunkCountX();
+
+        for (uint32_t chunkY = y / ChunkSize; chunkY <= (y + height - 1) / ChunkSize; ++chunkY) {
+            for (uint32_t chunkX = x / ChunkSize; chunkX <= (x + width - 1) / ChunkSize; ++chunkX)
+                ++m_ChunkRevisions[chunkY * chunkCountX + chunkX];
+        }
+    }
+
+    void TilemapComponent::MarkChunks(std::size_t offset, std::size_t count) {
+        if (count == 0)
+            return;
+
+        auto firstRow = static_cast<uint32_t>(offset / m_Width);
+        auto lastRow  = static_cast<uint32_t>((offset + count - 1) / m_Width);
+
+        // A range that wraps around a row touches the whole width of the rows in between
+        if (firstRow == lastRow)
+            MarkChunks(static_cast<uint32_t>(offset % m_Width), firstRow, static_cast<uint32_t>(count), 1);
+        else
+            MarkChunks(0, firstRow, m_Width, lastRow - firstRow + 1);
     }
 
     NativeScriptComponent::NativeScriptComponent()
         : m_Instance(nullptr)
         , m_InstantiateScript(nullptr)
-        , m_DestroyScript(nullptr) {}
+        , m_DestroyScript(nullptr)
+        , m_ScriptName(nullptr) {}
+
+    bool NativeScriptComponent::Bind(std::string_view scriptName) {
+        const auto& bindings = Internal::GetScriptBindings();
+        auto        it       = bindings.find(scriptName);
+
+        if (it == bindings.end())
+            return false;
+
+        m_InstantiateScript = it->second.Instantiate;
+        m_DestroyScript     = it->second.Destroy;
+        m_ScriptName        = it->second.Name;
+
+        return true;
+    }
+
+    const char* NativeScriptComponent::RegisterBinding(
+        std::string_view  scriptName,
+        InstantiateScript instantiateScript,
+        DestroyScript     destroyScript
+    ) {
+        auto& bindings = Internal::GetScriptBindings();
+
+        if (auto it = bindings.find(scriptName); it != bindings.end()) {
+            if (it->second.Instantiate != instantiateScript)
+                ZIBEN_CORE_WARN("NativeScriptComponent: {0} is already bound to another script", scriptName);
+
+            return it->second.Name;
+        }
+
+        // The bindings and the components point into the names, so they are kept for the whole run
+        static std::unordered_set<std::string> names;
+
+        const auto& name = *names.emplace(scriptName).first;
+        bindings.try_emplace(name, Internal::ScriptBinding{ name.c_str(), instantiateScript, destroyScript });
+
+        return name.c_str();
+    }
 
 } // namespace Ziben
\ No newline at end of file
@@ -27,7 +27,7 @@ namespace Ziben {
     }
 
     void SceneCamera::SetPerspectiveFar(float far) {
-        m_OrthographicProps.Far = far;
+        m_PerspectiveProps.Far = far;
         RecalculateProjection();
     }
 
@@ -1,5 +1,7 @@
 #include "Entity.hpp"
 
+#include "Component.hpp"
+
 namespace Ziben {
 
     const Entity Entity::Null = Entity();
@@ -8,6 +10,10 @@ namespace Ziben {
         : m_Handle(handle)
         , m_Scene(scene) {}
 
+    UUID Entity::GetUUID() const {
+        return GetComponent<IDComponent>().ID;
+    }
+
     bool Entity::operator !=(const Entity& other) const {
         return std::tie(m_Handle, m_Scene) != std::tie(other.m_Handle, other.m_Scene);
     }
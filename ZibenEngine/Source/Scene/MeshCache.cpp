@@ -0,0 +1,128 @@
+#include "MeshCache.hpp"
+
+#include "Component.hpp"
+
+namespace Ziben {
+
+    void MeshCache::Remove(entt::entity handle) {
+        m_Entries.erase(handle);
+    }
+
+    MeshCache::Entry& MeshCache::Resolve(const entt::registry& registry, entt::entity handle) {
+        static const std::string s_DefaultShaderPath;
+
+        const auto& mesh     = registry.get<MeshComponent>(handle);
+        const auto* material = registry.try_get<MaterialComponent>(handle);
+
+        auto& entry = m_Entries[handle];
+
+        // A missing mesh is reported once per path
+        if (entry.MeshPath != mesh.MeshPath) {
+            entry.MeshPath = mesh.MeshPath;
+            entry.Geometry = AssetManager::LoadMesh(entry.MeshPath);
+            entry.LodIndex = 0;
+        }
+
+        if (!entry.Geometry)
+            return entry;
+
+        if (const auto& shaderPath = material ? material->ShaderPath : s_DefaultShaderPath; entry.ShaderPath != shaderPath) {
+            entry.ShaderPath     = shaderPath;
+            entry.MaterialShader = !shaderPath.empty() ? AssetManager::LoadShader(shaderPath) : nullptr;
+        }
+
+        return entry;
+    }
+
+    void MeshCache::Render(const entt::registry& registry, const Frustum& frustum, const glm::mat4& viewProjectionMatrix) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        static constexpr std::size_t s_BatchSize = AABBBatch::Capacity;
+
+        struct Candidate {
+            const glm::mat4* Transform;
+            Entry*           Resolved;
+            const glm::vec4* Color;
+            entt::entity     Handle;
+        };
+
+        static const glm::vec4 s_DefaultColor = glm::vec4(1.0f);
+
+        AABBBatch                          bounds;
+        std::array<Candidate, s_BatchSize> candidates;
+        std::array<uint8_t, s_BatchSize>   isVisible;
+        std::size_t                        count = 0;
+
+        auto& statistics = MeshQueue::GetStatistics();
+
+        // Same batched culling as for the sprites
+        auto submit = [&] {
+            frustum.Cull(bounds, count, isVisible.data());
+
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto& candidate = candidates[i];
+
+                if (!isVisible[i]) {
+                    ++statistics.CulledCount;
+                    continue;
+                }
+
+                auto& entry = *candidate.Resolved;
+
+                // The bounding sphere of the world bounds, only the visible entities change their level
+                glm::vec3 center = glm::vec3(bounds.CenterX[i], bounds.CenterY[i], bounds.CenterZ[i]);
+                float     radius = glm::length(glm::vec3(bounds.ExtentX[i], bounds.ExtentY[i], bounds.ExtentZ[i]));
+
+                entry.LodIndex = entry.Geometry->SelectLod(Mesh::GetScreenSize(viewProjectionMatrix, center, radius), entry.LodIndex);
+
+                MeshQueue::Submit(
+                    entry.MaterialShader ? entry.MaterialShader : MeshQueue::GetDefaultShader(),
+                    entry.Geometry->GetLod(entry.LodIndex).Id,
+                    *candidate.Transform,
+                    *candidate.Color,
+                    static_cast<int>(candidate.Handle)
+                );
+            }
+
+            count = 0;
+        };
+
+        auto view = registry.view<TransformComponent, MeshComponent>();
+
+        for (entt::entity handle : view) {
+            const auto& [transform, mesh] = view.get<TransformComponent, MeshComponent>(handle);
+            const auto* material          = registry.try_get<MaterialComponent>(handle);
+
+            auto& entry = Resolve(registry, handle);
+
+            if (!entry.Geometry)
+                continue;
+
+            AABB      worldBounds = entry.Geometry->GetBounds().Transform(transform.GetTransform());
+            glm::vec3 center      = worldBounds.GetCenter();
+            glm::vec3 extents     = worldBounds.GetExtents();
+
+            bounds.CenterX[count] = center.x;
+            bounds.CenterY[count] = center.y;
+            bounds.CenterZ[count] = center.z;
+            bounds.ExtentX[count] = extents.x;
+            bounds.ExtentY[count] = extents.y;
+            bounds.ExtentZ[count] = extents.z;
+
+            candidates[count] = { &transform.GetTransform(), &entry, material ? &material->Color : &s_DefaultColor, handle };
+
+            if (++count == s_BatchSize)
+                submit();
+        }
+
+        if (count > 0)
+            submit();
+
+        MeshQueue::Flush();
+    }
+
+    void MeshCache::Clear() {
+        m_Entries.clear();
+    }
+
+} // namespace Ziben
\ No newline at end of file
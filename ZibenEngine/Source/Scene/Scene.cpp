@@ -7,6 +7,99 @@
 
 namespace Ziben {
 
+    namespace Internal {
+
+        template <typename Component>
+        static void CopyComponentPool(const entt::registry& source, entt::registry& destination) {
+            auto view = source.view<const Component>();
+
+            std::vector<entt::entity> handles;
+            std::vector<Component>    components;
+
+            handles.reserve(view.size());
+            components.reserve(view.size());
+
+            // Single component view walks the packed pool, so both arrays are filled sequentially
+            view.each([&](entt::entity handle, const Component& component) {
+                handles.push_back(handle);
+                components.push_back(component);
+            });
+
+            destination.insert<Component>(handles.begin(), handles.end(), components.begin());
+        }
+
+        template <typename... Components>
+        static void CopyComponentPools(const entt::registry& source, entt::registry& destination) {
+            (CopyComponentPool<Components>(source, destination), ...);
+        }
+
+    } // namespace Internal
+
+    Ref<Scene> Scene::Copy(const Ref<Scene>& other) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto  begin       = std::chrono::steady_clock::now();
+        auto  scene       = CreateRef<Scene>(other->m_Name);
+        auto& source      = other->m_Registry;
+        auto& destination = scene->m_Registry;
+
+        scene->m_ViewportWidth        = other->m_ViewportWidth;
+        scene->m_ViewportHeight       = other->m_ViewportHeight;
+        scene->m_SaveState.IsTracking = false;
+
+        // Handles are recreated as is, so the pools can be copied without remapping
+        source.each([&](entt::entity handle) {
+            destination.create(handle);
+        });
+
+        // Bulk inserts would still mark every entity once per component, the index and the sprite chunks are marked once below
+        destination.on_construct<TransformComponent>().disconnect<&Scene::OnSpriteChanged>(scene.get());
+        destination.on_construct<SpriteRendererComponent>().disconnect<&Scene::OnSpriteChanged>(scene.get());
+        destination.on_construct<TilemapComponent>().disconnect<&Scene::OnBoundsChanged>(scene.get());
+        destination.on_construct<MeshComponent>().disconnect<&Scene::OnBoundsChanged>(scene.get());
+
+        Internal::CopyComponentPools<
+            IDComponent,
+            TagComponent,
+            TransformComponent,
+            SpriteRendererComponent,
+            TilemapComponent,
+            MeshComponent,
+            MaterialComponent,
+            CameraComponent,
+            NativeScriptComponent
+        >(source, destination);
+
+        destination.on_construct<TransformComponent>().connect<&Scene::OnSpriteChanged>(scene.get());
+        destination.on_construct<SpriteRendererComponent>().connect<&Scene::OnSpriteChanged>(scene.get());
+        destination.on_construct<TilemapComponent>().connect<&Scene::OnBoundsChanged>(scene.get());
+        destination.on_construct<MeshComponent>().connect<&Scene::OnBoundsChanged>(scene.get());
+
+        // Everything the index holds has a transform
+        for (entt::entity handle : destination.view<TransformComponent>())
+            scene->OnSpriteChanged(destination, handle);
+
+        // Script instances belong to the source scene
+        destination.view<NativeScriptComponent>().each([](NativeScriptComponent& component) {
+            component.m_Instance = nullptr;
+        });
+
+        scene->m_EntityMap            = other->m_EntityMap;
+        scene->m_SaveState.IsTracking = true;
+
+        auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        ZIBEN_CORE_INFO(
+            "Copied scene {0}: {1} entities in {2:.3f} ms ({3:.0f} entities/s)",
+            scene->m_Name,
+            scene->m_EntityMap.size(),
+            seconds * 1000.0,
+            seconds > 0.0 ? static_cast<double>(scene->m_EntityMap.size()) / seconds : 0.0
+        );
+
+        return scene;
+    }
+
     template <typename Component>
     void Scene::OnComponentPushed(entt::registry& registry, entt::entity handle) {
         assert(false);
@@ -17,12 +110,87 @@ namespace Ziben {
         registry.get<CameraComponent>(handle).Camera.SetViewportSize(m_ViewportWidth, m_ViewportHeight);
     }
 
+    template <typename Component>
+    void Scene::OnComponentChanged(entt::registry& registry, entt::entity handle) {
+        if (!m_SaveState.IsTracking)
+            return;
+
+        // IDComponent may already be gone while the entity is being destroyed
+        if (const auto* idComponent = registry.try_get<IDComponent>(handle))
+            m_SaveState.DirtyEntities.insert(idComponent->ID);
+    }
+
+    template <typename... Components>
+    void Scene::TrackComponentChanges() {
+        (m_Registry.on_construct<Components>().template connect<&Scene::OnComponentChanged<Components>>(this), ...);
+        (m_Registry.on_update<Components>().template connect<&Scene::OnComponentChanged<Components>>(this), ...);
+        (m_Registry.on_destroy<Components>().template connect<&Scene::OnComponentChanged<Components>>(this), ...);
+    }
+
+    void Scene::OnSpriteChanged(entt::registry& registry, entt::entity handle) {
+        m_SpatialIndex.MarkMoved(handle);
+
+        // Sprites that stopped being static leave their chunk on the next update
+        if (const auto* sprite = registry.try_get<SpriteRendererComponent>(handle); sprite && (sprite->IsStatic || m_StaticSpriteCache.Contains(handle)))
+            m_StaticSpriteCache.MarkDirty(handle);
+    }
+
+    void Scene::OnSpriteRemoved(entt::registry& registry, entt::entity handle) {
+        // The entity may still be indexed for its tilemap or mesh, Update drops it otherwise
+        m_SpatialIndex.MarkMoved(handle);
+        m_StaticSpriteCache.Remove(handle);
+    }
+
+    void Scene::OnBoundsChanged(entt::registry& registry, entt::entity handle) {
+        m_SpatialIndex.MarkMoved(handle);
+    }
+
+    void Scene::OnTilemapRemoved(entt::registry& registry, entt::entity handle) {
+        m_SpatialIndex.MarkMoved(handle);
+        m_TilemapCache.Remove(handle);
+    }
+
+    void Scene::OnMeshRemoved(entt::registry& registry, entt::entity handle) {
+        m_SpatialIndex.MarkMoved(handle);
+        m_MeshCache.Remove(handle);
+    }
+
     Scene::Scene(std::string name)
         : m_Name(std::move(name))
         , m_ViewportWidth(0)
         , m_ViewportHeight(0) {
 
         m_Registry.on_construct<CameraComponent>().connect<&Scene::OnComponentPushed<CameraComponent>>(this);
+
+        // Transforms and sprites are changed through patch, so update signals are enough
+        // to keep the spatial index and the static sprite chunks in sync
+        m_Registry.on_construct<TransformComponent>().connect<&Scene::OnSpriteChanged>(this);
+        m_Registry.on_update<TransformComponent>().connect<&Scene::OnSpriteChanged>(this);
+        m_Registry.on_construct<SpriteRendererComponent>().connect<&Scene::OnSpriteChanged>(this);
+        m_Registry.on_update<SpriteRendererComponent>().connect<&Scene::OnSpriteChanged>(this);
+        m_Registry.on_destroy<TransformComponent>().connect<&Scene::OnSpriteRemoved>(this);
+        m_Registry.on_destroy<SpriteRendererComponent>().connect<&Scene::OnSpriteRemoved>(this);
+
+        // Tilemaps track their own edits through chunk revisions, the signals only keep their bounds indexed
+        m_Registry.on_construct<TilemapComponent>().connect<&Scene::OnBoundsChanged>(this);
+        m_Registry.on_update<TilemapComponent>().connect<&Scene::OnBoundsChanged>(this);
+        m_Registry.on_destroy<TilemapComponent>().connect<&Scene::OnTilemapRemoved>(this);
+
+        // Meshes and materials are resolved again whenever their paths differ from the cached ones
+        m_Registry.on_construct<MeshComponent>().connect<&Scene::OnBoundsChanged>(this);
+        m_Registry.on_update<MeshComponent>().connect<&Scene::OnBoundsChanged>(this);
+        m_Registry.on_destroy<MeshComponent>().connect<&Scene::OnMeshRemoved>(this);
+
+        TrackComponentChanges<
+            IDComponent,
+            TagComponent,
+            TransformComponent,
+            SpriteRendererComponent,
+            TilemapComponent,
+            MeshComponent,
+            MaterialComponent,
+            CameraComponent
+        >();
     }
 
     void Scene::OnUpdateEditor(const TimeStep& ts, EditorCamera& camera) {
@@ -32,13 +200,8 @@ namespace Ziben {
     void Scene::OnRenderEditor(EditorCamera& camera) {
         Renderer2D::BeginScene(camera);
         {
-            auto view = m_Registry.view<TransformComponent, SpriteRendererComponent>();
-
-            for (entt::entity handle : view) {
-                const auto& [tc, src] = view.get<TransformComponent, SpriteRendererComponent>(handle);
-
-                Renderer2D::DrawSprite(tc.GetTransform(), src, static_cast<int>(handle));
-            }
+            RenderMeshes();
+            RenderSprites();
         }
         Renderer2D::EndScene();
     }
@@ -52,7 +215,40 @@ namespace Ziben {
                 component.m_Instance->OnCreate();
             }
 
+            const auto* transform = m_Registry.try_get<TransformComponent>(handle);
+
+            if (!transform) {
+                component.m_Instance->OnUpdate(ts);
+                return;
+            }
+
+            auto translation = transform->GetTranslation();
+            auto rotation    = transform->GetRotation();
+            auto scale       = transform->GetScale();
+
             component.m_Instance->OnUpdate(ts);
+
+            // The script may have created entities and moved the pool, or removed the transform which is handled by on_destroy
+            transform = m_Registry.try_get<TransformComponent>(handle);
+
+            // Scripts may move their entity without patching the transform, an unchanged one keeps its static chunk
+            bool isMoved = transform && (
+                transform->GetTranslation() != translation
+                || transform->GetRotation() != rotation
+                || transform->GetScale() != scale
+            );
+
+            if (isMoved)
+                OnSpriteChanged(m_Registry, handle);
+        });
+    }
+
+    void Scene::OnRuntimeStop() {
+        m_Registry.view<NativeScriptComponent>().each([](NativeScriptComponent& component) {
+            if (component.m_Instance) {
+                component.m_Instance->OnDestroy();
+                component.m_DestroyScript(&component);
+            }
         });
     }
 
@@ -78,13 +274,8 @@ namespace Ziben {
         if (primaryCamera) {
             Renderer2D::BeginScene(*primaryCamera, primaryCameraTransform);
             {
-                auto view = m_Registry.view<TransformComponent, SpriteRendererComponent>();
-
-                for (entt::entity handle : view) {
-                    const auto& [tc, src] = view.get<TransformComponent, SpriteRendererComponent>(handle);
-
-                    Renderer2D::DrawSprite(tc.GetTransform(), src, static_cast<int>(handle));
-                }
+                RenderMeshes();
+                RenderSprites();
             }
             Renderer2D::EndScene();
         }
@@ -103,16 +294,38 @@ namespace Ziben {
     }
 
     Entity Scene::CreateEntity(const std::string& tag) {
+        return CreateEntityWithUUID(UUID(), tag);
+    }
+
+    Entity Scene::CreateEntityWithUUID(UUID uuid, const std::string& tag) {
+        assert(!m_EntityMap.contains(uuid));
+
         Entity entity(m_Registry.create(), this);
 
+        entity.PushComponent<IDComponent>(uuid);
         entity.PushComponent<TagComponent>(tag);
         entity.PushComponent<TransformComponent>();
 
+        m_EntityMap.emplace(uuid, (entt::entity)entity);
+        m_SaveState.DestroyedEntities.erase(uuid);
+
         return entity;
     }
 
     void Scene::DestroyEntity(const Entity& entity) {
+        UUID uuid = m_Registry.get<IDComponent>((entt::entity)entity).ID;
+
         m_Registry.destroy((entt::entity)entity);
+
+        m_EntityMap.erase(uuid);
+        m_SaveState.DirtyEntities.erase(uuid);
+        m_SaveState.DestroyedEntities.insert(uuid);
+    }
+
+    Entity Scene::GetEntityByUUID(UUID uuid) {
+        auto it = m_EntityMap.find(uuid);
+
+        return it != m_EntityMap.end() ? Entity(it->second, this) : Entity::Null;
     }
 
     Entity Scene::GetPrimaryCameraEntity() {
@@ -123,4 +336,212 @@ namespace Ziben {
         return Entity::Null;
     }
 
+    std::vector<Entity> Scene::QueryRegion(const AABB& region) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        std::vector<Entity> entities;
+
+        m_SpatialIndex.Update(m_Registry, m_MeshCache);
+
+        for (const auto& tree : m_SpatialIndex.GetTrees()) {
+            tree.QueryRegion(region, [&](uint32_t userData) {
+                entt::entity handle = SpatialIndex::GetHandle(userData);
+                AABB         bounds;
+
+                // Leaves store fat bounds, the exact ones are checked here
+                if (SpatialIndex::GetBounds(m_Registry, m_MeshCache, handle, bounds) && bounds.Overlaps(region))
+                    entities.emplace_back(handle, this);
+            });
+        }
+
+        return entities;
+    }
+
+    std::vector<Entity> Scene::QueryFrustum(const Frustum& frustum) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        std::vector<Entity> entities;
+
+        m_SpatialIndex.Update(m_Registry, m_MeshCache);
+
+        for (const auto& tree : m_SpatialIndex.GetTrees()) {
+            tree.QueryFrustum(frustum, [&](uint32_t userData) {
+                entt::entity handle = SpatialIndex::GetHandle(userData);
+                AABB         bounds;
+
+                if (SpatialIndex::GetBounds(m_Registry, m_MeshCache, handle, bounds) && frustum.Intersects(bounds.GetCenter(), bounds.GetExtents()))
+                    entities.emplace_back(handle, this);
+            });
+        }
+
+        return entities;
+    }
+
+    Entity Scene::Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        entt::entity hitHandle   = entt::null;
+        float        hitDistance = maxDistance;
+
+        glm::vec3 inverseDirection = 1.0f / direction;
+
+        auto raycastQuad = [&](const glm::mat4& transform, float maxHitDistance) {
+            glm::mat4 inverse = glm::inverse(transform);
+
+            // The quad lies in the z = 0 plane of its local space, the ray parameter stays the same there
+            glm::vec3 localOrigin    = inverse * glm::vec4(origin, 1.0f);
+            glm::vec3 localDirection = inverse * glm::vec4(direction, 0.0f);
+
+            if (std::abs(localDirection.z) < std::numeric_limits<float>::epsilon())
+                return -1.0f;
+
+            float     distance = -localOrigin.z / localDirection.z;
+            glm::vec3 point    = localOrigin + distance * localDirection;
+
+            if (!(distance >= 0.0f && distance < maxHitDistance) || std::abs(point.x) > 0.5f || std::abs(point.y) > 0.5f)
+                return -1.0f;
+
+            return distance;
+        };
+
+        // Sprites and tilemaps are hit exactly, meshes by their bounds
+        auto raycastEntity = [&](uint32_t userData, float maxHitDistance) {
+            entt::entity handle    = SpatialIndex::GetHandle(userData);
+            const auto&  transform = m_Registry.get<TransformComponent>(handle).GetTransform();
+            float        distance  = -1.0f;
+
+            auto hit = [&](float hitDistance) {
+                if (hitDistance >= 0.0f && hitDistance < maxHitDistance && (distance < 0.0f || hitDistance < distance))
+                    distance = hitDistance;
+            };
+
+            if (m_Registry.all_of<SpriteRendererComponent>(handle))
+                hit(raycastQuad(transform, maxHitDistance));
+
+            if (const auto* tilemap = m_Registry.try_get<TilemapComponent>(handle); tilemap && tilemap->GetWidth() > 0 && tilemap->GetHeight() > 0)
+                hit(raycastQuad(transform * tilemap->GetQuadTransform(), maxHitDistance));
+
+            if (m_Registry.all_of<MeshComponent>(handle))
+                if (const auto* mesh = m_MeshCache.GetMesh(m_Registry, handle))
+                    hit(mesh->GetBounds().Transform(transform).Raycast(origin, inverseDirection, maxHitDistance));
+
+            if (distance >= 0.0f) {
+                hitHandle   = handle;
+                hitDistance = distance;
+            }
+
+            return distance;
+        };
+
+        m_SpatialIndex.Update(m_Registry, m_MeshCache);
+
+        // The closest hit of the previous tree limits the next one
+        for (const auto& tree : m_SpatialIndex.GetTrees())
+            tree.QueryRay(origin, direction, hitDistance, raycastEntity);
+
+        return hitHandle != entt::null ? Entity(hitHandle, this) : Entity::Null;
+    }
+
+    Entity Scene::GetNearestEntity(const glm::vec3& point, float maxDistance) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        Entity nearestEntity          = Entity::Null;
+        float  nearestDistanceSquared = maxDistance * maxDistance;
+
+        m_SpatialIndex.Update(m_Registry, m_MeshCache);
+
+        for (const auto& tree : m_SpatialIndex.GetTrees()) {
+            int32_t proxy = tree.QueryNearest(point, nearestDistanceSquared, [&](uint32_t userData) {
+                entt::entity handle          = SpatialIndex::GetHandle(userData);
+                AABB         bounds;
+                float        distanceSquared = SpatialIndex::GetBounds(m_Registry, m_MeshCache, handle, bounds) ? bounds.GetDistanceSquared(point) : std::numeric_limits<float>::max();
+
+                if (distanceSquared <= nearestDistanceSquared)
+                    nearestDistanceSquared = distanceSquared;
+
+                return distanceSquared;
+            });
+
+            if (proxy != AABBTree::NullNode)
+                nearestEntity = Entity(SpatialIndex::GetHandle(tree.GetUserData(proxy)), this);
+        }
+
+        return nearestEntity;
+    }
+
+    void Scene::RenderSprites() {
+        ZIBEN_PROFILE_FUNCTION();
+
+        static constexpr std::size_t s_BatchSize = AABBBatch::Capacity;
+
+        std::array<glm::mat4, s_BatchSize>                      transforms;
+        std::array<const SpriteRendererComponent*, s_BatchSize> sprites;
+        std::array<entt::entity, s_BatchSize>                   handles;
+        std::array<uint8_t, s_BatchSize>                        isVisible;
+        std::size_t                                             count          = 0;
+        std::size_t                                             candidateCount = 0;
+
+        // Sprites are culled in batches, only the visible ones reach the vertex buffer
+        auto submit = [&] {
+            if (Renderer2D::CullQuads(transforms.data(), count, isVisible.data()) > 0)
+                for (std::size_t i = 0; i < count; ++i)
+                    if (isVisible[i])
+                        Renderer2D::DrawSprite(transforms[i], *sprites[i], static_cast<int>(handles[i]));
+
+            count = 0;
+        };
+
+        // Tilemaps and static sprites are drawn from their retained GPU data. They go before the dynamic
+        // sprites, so translucent sprites blend in this order and not by their depth
+        m_TilemapCache.Render(m_Registry);
+
+        m_StaticSpriteCache.Update(m_Registry);
+        m_StaticSpriteCache.Render(Renderer2D::GetCameraFrustum());
+
+        m_SpatialIndex.Update(m_Registry, m_MeshCache);
+
+        const auto& dynamicTree = m_SpatialIndex.GetTree(SpatialIndex::Layer::Dynamic);
+
+        // The tree rejects whole subtrees, the batches are tested exactly
+        dynamicTree.QueryFrustum(Renderer2D::GetCameraFrustum(), [&](uint32_t userData) {
+            entt::entity handle   = SpatialIndex::GetHandle(userData);
+            const auto& [tc, src] = m_Registry.get<TransformComponent, SpriteRendererComponent>(handle);
+
+            transforms[count] = tc.GetTransform();
+            sprites[count]    = &src;
+            handles[count]    = handle;
+
+            ++candidateCount;
+
+            if (++count == s_BatchSize)
+                submit();
+        });
+
+        if (count > 0)
+            submit();
+
+        // Dynamic sprites rejected by the tree never reach CullQuads
+        auto& statistics  = Renderer2D::GetStatistics();
+        auto  prunedCount = static_cast<uint32_t>(dynamicTree.GetLeafCount() - candidateCount);
+
+        statistics.SubmittedQuadCount += prunedCount;
+        statistics.CulledQuadCount    += prunedCount;
+    }
+
+    void Scene::RenderMeshes() {
+        m_MeshCache.Render(m_Registry, Renderer2D::GetCameraFrustum(), Renderer2D::GetCameraViewProjectionMatrix());
+    }
+
+    bool Scene::HasUnsavedChanges() const {
+        return !m_SaveState.DirtyEntities.empty() || !m_SaveState.DestroyedEntities.empty();
+    }
+
+    void Scene::ResetSaveState(const std::string& filepath, std::size_t appendedRecordCount) {
+        m_SaveState.Filepath            = filepath;
+        m_SaveState.AppendedRecordCount = appendedRecordCount;
+
+        m_SaveState.DirtyEntities.clear();
+        m_SaveState.DestroyedEntities.clear();
+    }
+
 } // namespace Ziben
\ No newline at end of file
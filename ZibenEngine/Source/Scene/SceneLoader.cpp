@@ -0,0 +1,121 @@
+#include "SceneLoader.hpp"
+
+#include "SceneSerializer.hpp"
+#include "Component.hpp"
+
+namespace Ziben {
+
+    SceneLoader::SceneLoader()
+        : m_Progress(0.0f) {}
+
+    SceneLoader::~SceneLoader() {
+        // The file is still parsed to the end, the deserializer has no way to stop midway
+        if (m_Future.valid())
+            m_Future.wait();
+    }
+
+    bool SceneLoader::Load(const std::string& filepath, const ProgressCallback& progressCallback) {
+        if (IsLoading()) {
+            ZIBEN_CORE_WARN("SceneLoader: {0} is still loading, {1} is skipped", m_Filepath, filepath);
+            return false;
+        }
+
+        m_Filepath = filepath;
+        m_Progress = 0.0f;
+
+        m_Future = std::async(std::launch::async, [this, filepath, progressCallback]() -> Ref<Scene> {
+            ZIBEN_PROFILE_SCOPE("SceneLoader::Load");
+
+            auto            scene = CreateRef<Scene>("New");
+            SceneSerializer serializer(scene);
+
+            bool isLoaded = serializer.Deserialize(filepath, [&](float progress) {
+                m_Progress = progress;
+
+                if (progressCallback)
+                    progressCallback(progress);
+            });
+
+            return isLoaded ? scene : nullptr;
+        });
+
+        return true;
+    }
+
+    void SceneLoader::PushUploadTask(UploadTask task) {
+        std::lock_guard lock(m_UploadMutex);
+        m_UploadTasks.push(std::move(task));
+    }
+
+    Ref<Scene> SceneLoader::Poll(std::chrono::microseconds uploadBudget) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        // Uploads queued while parsing don't have to wait for the whole file
+        bool isUploaded = RunUploadTasks(uploadBudget);
+
+        if (m_Future.valid()) {
+            if (m_Future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                return nullptr;
+
+            m_Scene = m_Future.get();
+
+            if (!m_Scene) {
+                ZIBEN_CORE_ERROR("SceneLoader: failed to load {0}", m_Filepath);
+
+                std::lock_guard lock(m_UploadMutex);
+                m_UploadTasks = {};
+
+                return nullptr;
+            }
+
+            PushSceneUploadTasks();
+            isUploaded = RunUploadTasks(uploadBudget);
+        }
+
+        if (!m_Scene || !isUploaded)
+            return nullptr;
+
+        ZIBEN_CORE_INFO("SceneLoader: {0} is loaded", m_Filepath);
+
+        return std::exchange(m_Scene, nullptr);
+    }
+
+    void SceneLoader::PushSceneUploadTasks() {
+        // The scene owns the caches, the tasks are dropped with the queue if loading fails
+        Scene* scene = m_Scene.get();
+
+        for (entt::entity handle : scene->m_Registry.view<MeshComponent>())
+            PushUploadTask([scene, handle] { scene->m_MeshCache.Prepare(scene->m_Registry, handle); });
+
+        for (entt::entity handle : scene->m_Registry.view<TilemapComponent>())
+            PushUploadTask([scene, handle] { scene->m_TilemapCache.Prepare(scene->m_Registry, handle); });
+    }
+
+    bool SceneLoader::RunUploadTasks(std::chrono::microseconds uploadBudget) {
+        auto begin = std::chrono::steady_clock::now();
+
+        // At least one task is run per call, so the queue drains even with a tiny budget
+        while (true) {
+            UploadTask task;
+
+            {
+                std::lock_guard lock(m_UploadMutex);
+
+                if (m_UploadTasks.empty())
+                    return true;
+
+                task = std::move(m_UploadTasks.front());
+                m_UploadTasks.pop();
+            }
+
+            task();
+
+            if (std::chrono::steady_clock::now() - begin >= uploadBudget)
+                break;
+        }
+
+        std::lock_guard lock(m_UploadMutex);
+        return m_UploadTasks.empty();
+    }
+
+} // namespace Ziben
\ No newline at end of file
@@ -1,9 +1,23 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <array>
+#include <unordered_map>
+#include <unordered_set>
 #include <stack>
 
 #include <utility>
 #include <stdexcept>
-#include <functional>
\ No newline at end of file
+#include <functional>
+#include <fstream>
+#include <filesystem>
+#include <charconv>
+#include <cstring>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <atomic>
+#include <queue>
+#include <limits>
\ No newline at end of file
@@ -1,309 +1,915 @@
 #include "SceneSerializer.hpp"
 
-#include <yaml-cpp/yaml.h>
-
 #include "Component.hpp"
+#include "SceneStream.hpp"
+#include "SnapshotArchive.hpp"
+
+namespace Ziben {
 
-namespace YAML {
+    namespace Internal {
 
-    template <>
-    struct convert<glm::vec3> {
-        static Node encode(const glm::vec3& vec3) {
-            Node node;
+        using Clock = std::chrono::steady_clock;
 
-            node.push_back(vec3.x);
-            node.push_back(vec3.y);
-            node.push_back(vec3.z);
+        static void LogThroughput(const char* operation, std::size_t entityCount, Clock::time_point begin) {
+            auto seconds = std::chrono::duration<double>(Clock::now() - begin).count();
 
-            return node;
+            ZIBEN_CORE_INFO(
+                "{0} {1} entities in {2:.3f} ms ({3:.0f} entities/s)",
+                operation,
+                entityCount,
+                seconds * 1000.0,
+                seconds > 0.0 ? static_cast<double>(entityCount) / seconds : 0.0
+            );
         }
 
-        static bool decode(const Node& node, glm::vec3& vec3) {
-            if (!node.IsSequence() || node.size() != 3)
+        // Every entity used to be written with this id before entities got their own UUIDs
+        static constexpr uint64_t s_LegacyEntityID = 12391723912837;
+
+        static constexpr std::size_t s_ProgressRecordInterval = 64;
+
+        static bool EndsWithNewLine(const std::string& filepath) {
+            std::ifstream file(filepath, std::ios_base::in | std::ios_base::binary);
+
+            if (!file || !file.seekg(-1, std::ios_base::end))
                 return false;
 
-            vec3.x = node[0].as<float>();
-            vec3.y = node[1].as<float>();
-            vec3.z = node[2].as<float>();
+            return file.get() == '\n';
+        }
 
-            return true;
+        static void WarnInvalidValue(std::string_view component, std::string_view key, std::string_view value) {
+            ZIBEN_CORE_WARN("Deserializing: invalid value '{0}' for {1}.{2}", value, component, key);
         }
-    };
 
-    template <>
-    struct convert<glm::vec4> {
-        static Node encode(const glm::vec4& vec4) {
-            Node node;
+        static void DeserializeTransformComponent(Entity& entity, std::string_view key, std::string_view value) {
+            auto&     component = entity.GetOrPushComponent<TransformComponent>();
+            glm::vec3 vec3;
 
-            node.push_back(vec4.x);
-            node.push_back(vec4.y);
-            node.push_back(vec4.z);
-            node.push_back(vec4.w);
+            if (!SceneReader::ParseVec3(value, vec3))
+                return WarnInvalidValue("TransformComponent", key, value);
 
-            return node;
+            if (key == "Translation")
+                component.SetTranslation(vec3);
+            else if (key == "Rotation")
+                component.SetRotation(vec3);
+            else if (key == "Scale")
+                component.SetScale(vec3);
+        }
+
+        static void DeserializeCameraComponent(
+            Entity&          entity,
+            std::string_view section,
+            std::string_view key,
+            std::string_view value
+        ) {
+            auto& component = entity.GetOrPushComponent<CameraComponent>();
+            auto& camera    = component.Camera;
+            bool  boolean   = false;
+            int   integer   = 0;
+            float number    = 0.0f;
+
+            if (section.empty()) {
+                if (!SceneReader::ParseBool(value, boolean))
+                    return WarnInvalidValue("CameraComponent", key, value);
+
+                if (key == "IsPrimary")
+                    component.IsPrimary = boolean;
+                else if (key == "HasFixedAspectRatio")
+                    component.HasFixedAspectRatio = boolean;
+
+                return;
+            }
+
+            if (key == "ProjectionType") {
+                if (!SceneReader::ParseInt(value, integer))
+                    return WarnInvalidValue("CameraComponent", key, value);
+
+                return camera.SetProjectionType(static_cast<SceneCamera::ProjectionType>(integer));
+            }
+
+            if (!SceneReader::ParseFloat(value, number))
+                return WarnInvalidValue("CameraComponent", key, value);
+
+            if (section == "PerspectiveProps") {
+                if (key == "Fov")
+                    camera.SetPerspectiveFov(number);
+                else if (key == "Near")
+                    camera.SetPerspectiveNear(number);
+                else if (key == "Far")
+                    camera.SetPerspectiveFar(number);
+            } else if (section == "OrthographicProps") {
+                if (key == "Size")
+                    camera.SetOrthographicSize(number);
+                else if (key == "Near")
+                    camera.SetOrthographicNear(number);
+                else if (key == "Far")
+                    camera.SetOrthographicFar(number);
+            }
         }
 
-        static bool decode(const Node& node, glm::vec4& vec4) {
-            if (!node.IsSequence() || node.size() != 4)
+        static void DeserializeSpriteRendererComponent(Entity& entity, std::string_view key, std::string_view value) {
+            auto& component = entity.GetOrPushComponent<SpriteRendererComponent>();
+
+            if (key == "Color" && !SceneReader::ParseVec4(value, component.Color))
+                WarnInvalidValue("SpriteRendererComponent", key, value);
+            else if (key == "IsStatic" && !SceneReader::ParseBool(value, component.IsStatic))
+                WarnInvalidValue("SpriteRendererComponent", key, value);
+        }
+
+        static void DeserializeMeshComponent(Entity& entity, std::string_view key, std::string_view value) {
+            auto& component = entity.GetOrPushComponent<MeshComponent>();
+
+            if (key == "MeshPath")
+                component.MeshPath = SceneReader::ParseString(value);
+        }
+
+        static void DeserializeMaterialComponent(Entity& entity, std::string_view key, std::string_view value) {
+            auto& component = entity.GetOrPushComponent<MaterialComponent>();
+
+            if (key == "ShaderPath")
+                component.ShaderPath = SceneReader::ParseString(value);
+            else if (key == "Color" && !SceneReader::ParseVec4(value, component.Color))
+                WarnInvalidValue("MaterialComponent", key, value);
+        }
+
+        // Tiles are written as run length encoded lines of up to s_TilesPerLine tiles:
+        // "<offset> <tile> <count>x<tile> ...", lines without any tile are skipped
+        static constexpr std::size_t s_TilesPerLine = 64 * 1024;
+
+        static void SerializeTiles(SceneWriter& out, const TilemapComponent& component) {
+            const auto& tiles = component.GetTiles();
+            std::string line;
+
+            for (std::size_t offset = 0; offset < tiles.size(); offset += s_TilesPerLine) {
+                auto begin = tiles.begin() + static_cast<std::ptrdiff_t>(offset);
+                auto end   = tiles.begin() + static_cast<std::ptrdiff_t>(std::min(tiles.size(), offset + s_TilesPerLine));
+
+                if (std::all_of(begin, end, [](TilemapComponent::TileType tile) { return tile == TilemapComponent::EmptyTile; }))
+                    continue;
+
+                line = std::to_string(offset);
+
+                for (auto it = begin; it != end;) {
+                    auto runEnd = std::find_if(it, end, [&](TilemapComponent::TileType tile) { return tile != *it; });
+                    auto count  = runEnd - it;
+
+                    line.push_back(' ');
+
+                    if (count > 1) {
+                        line += std::to_string(count);
+                        line.push_back('x');
+                    }
+
+                    line += std::to_string(*it);
+                    it    = runEnd;
+                }
+
+                out.Write("Tiles", line);
+            }
+        }
+
+        static bool DeserializeTiles(TilemapComponent& component, std::string_view value) {
+            const char* current = value.data();
+            const char* end     = value.data() + value.size();
+
+            auto skipSpaces = [&] {
+                while (current != end && *current == ' ')
+                    ++current;
+            };
+
+            auto parse = [&](auto& result) {
+                auto [next, error] = std::from_chars(current, end, result);
+                current            = next;
+
+                return error == std::errc();
+            };
+
+            std::size_t offset = 0;
+
+            skipSpaces();
+
+            if (!parse(offset))
                 return false;
 
-            vec4.x = node[0].as<float>();
-            vec4.y = node[1].as<float>();
-            vec4.z = node[2].as<float>();
-            vec4.w = node[3].as<float>();
+            for (skipSpaces(); current != end; skipSpaces()) {
+                std::size_t count = 1;
+                std::size_t tile  = 0;
+
+                if (!parse(tile))
+                    return false;
+
+                // Run of the same tile, the number was the count
+                if (current != end && *current == 'x') {
+                    ++current;
+                    count = tile;
+
+                    if (!parse(tile))
+                        return false;
+                }
+
+                if (tile > std::numeric_limits<TilemapComponent::TileType>::max() || offset + count > component.GetTiles().size())
+                    return false;
+
+                component.SetTiles(offset, count, static_cast<TilemapComponent::TileType>(tile));
+                offset += count;
+            }
 
             return true;
         }
-    };
 
-} // namespace YAML
+        static void DeserializeTilemapComponent(Entity& entity, std::string_view key, std::string_view value) {
+            auto& component = entity.GetOrPushComponent<TilemapComponent>();
+            int   integer   = 0;
+
+            if (key == "Width" || key == "Height") {
+                if (!SceneReader::ParseInt(value, integer) || integer < 0 || integer > static_cast<int>(TilemapComponent::MaxSize))
+                    return WarnInvalidValue("TilemapComponent", key, value);
+
+                if (key == "Width")
+                    component.Resize(static_cast<uint32_t>(integer), component.GetHeight());
+                else
+                    component.Resize(component.GetWidth(), static_cast<uint32_t>(integer));
+            } else if (key == "TilesetPath") {
+                component.TilesetPath = SceneReader::ParseString(value);
+            } else if (key == "TilesetCellSize" && !SceneReader::ParseVec2(value, component.TilesetCellSize)) {
+                WarnInvalidValue("TilemapComponent", key, value);
+            } else if (key == "Color" && !SceneReader::ParseVec4(value, component.Color)) {
+                WarnInvalidValue("TilemapComponent", key, value);
+            } else if (key == "Tiles" && !DeserializeTiles(component, value)) {
+                WarnInvalidValue("TilemapComponent", key, value.substr(0, 32));
+            }
+        }
 
-namespace Ziben {
+        // Runtime snapshot, stored in native byte order
 
-    YAML::Emitter& operator <<(YAML::Emitter& out, const glm::vec3& vec3) {
-        out << YAML::Flow;
-        out << YAML::BeginSeq;
-        {
-            out << vec3.x;
-            out << vec3.y;
-            out << vec3.z;
+        static constexpr uint32_t s_SnapshotMagic   = 0x504E535A; // ZSNP
+        static constexpr uint32_t s_SnapshotVersion = 4;
+
+        struct ScriptState {
+            entt::entity   Handle;
+            SnapshotReader State;
+        };
+
+        template <TriviallyCopyableConcept Component>
+        static void WriteComponent(SnapshotWriter& out, const Component& component) {
+            out.Write(component);
         }
-        out << YAML::EndSeq;
 
-        return out;
-    }
+        static void WriteComponent(SnapshotWriter& out, const TagComponent& component) {
+            out.Write(std::string_view(component.Tag));
+        }
 
-    YAML::Emitter& operator <<(YAML::Emitter& out, const glm::vec4& vec4) {
-        out << YAML::Flow;
-        out << YAML::BeginSeq;
-        {
-            out << vec4.x;
-            out << vec4.y;
-            out << vec4.z;
-            out << vec4.w;
+        static void WriteComponent(SnapshotWriter& out, const CameraComponent& component) {
+            out.Write(component.Camera.GetProjectionType());
+            out.Write(component.Camera.GetPerspectiveProps());
+            out.Write(component.Camera.GetOrthographicProps());
+            out.Write(component.IsPrimary);
+            out.Write(component.HasFixedAspectRatio);
         }
-        out << YAML::EndSeq;
 
-        return out;
-    }
+        static void WriteComponent(SnapshotWriter& out, const TilemapComponent& component) {
+            out.Write(component.GetWidth());
+            out.Write(component.GetHeight());
+            out.Write(std::string_view(component.TilesetPath));
+            out.Write(component.TilesetCellSize);
+            out.Write(component.Color);
+            out.WriteBytes(component.GetTiles().data(), component.GetTiles().size() * sizeof(TilemapComponent::TileType));
+        }
+
+        static void WriteComponent(SnapshotWriter& out, const MeshComponent& component) {
+            out.Write(std::string_view(component.MeshPath));
+        }
+
+        static void WriteComponent(SnapshotWriter& out, const MaterialComponent& component) {
+            out.Write(std::string_view(component.ShaderPath));
+            out.Write(component.Color);
+        }
+
+        static void WriteComponent(SnapshotWriter& out, const NativeScriptComponent& component) {
+            out.Write(std::string_view(component.m_ScriptName ? component.m_ScriptName : ""));
+            out.Write(component.m_Instance != nullptr);
+
+            if (!component.m_Instance)
+                return;
+
+            // Script state is size prefixed, so the state of a script that isn't bound anymore can be skipped
+            auto offset = out.GetSize();
+
+            out.Write(uint32_t(0));
+            component.m_Instance->OnSerialize(out);
+            out.Patch(offset, static_cast<uint32_t>(out.GetSize() - offset - sizeof(uint32_t)));
+        }
+
+        template <TriviallyCopyableConcept Component>
+        static void ReadComponent(SnapshotReader& in, Component& component) {
+            in.Read(component);
+        }
+
+        static void ReadComponent(SnapshotReader& in, TagComponent& component) {
+            in.Read(component.Tag);
+        }
+
+        static void ReadComponent(SnapshotReader& in, CameraComponent& component) {
+            component.Camera.SetProjectionType(in.Read<SceneCamera::ProjectionType>());
+            component.Camera.SetPerspective(in.Read<SceneCamera::PerspectiveProps>());
+            component.Camera.SetOrthographic(in.Read<SceneCamera::OrthographicProps>());
+
+            in.Read(component.IsPrimary);
+            in.Read(component.HasFixedAspectRatio);
+        }
+
+        static void ReadComponent(SnapshotReader& in, TilemapComponent& component) {
+            auto width  = in.Read<uint32_t>();
+            auto height = in.Read<uint32_t>();
+
+            in.Read(component.TilesetPath);
+            in.Read(component.TilesetCellSize);
+            in.Read(component.Color);
+
+            // The tiles of an oversized tilemap are still skipped whole, otherwise the following records are misread
+            if (width > TilemapComponent::MaxSize || height > TilemapComponent::MaxSize) {
+                ZIBEN_CORE_WARN("Snapshot: tilemap {0}x{1} exceeds the max size, its tiles are dropped", width, height);
+                in.Skip(static_cast<std::size_t>(width) * height * sizeof(TilemapComponent::TileType));
+
+                return;
+            }
+
+            std::vector<TilemapComponent::TileType> tiles(static_cast<std::size_t>(width) * height);
+            in.ReadBytes(tiles.data(), tiles.size() * sizeof(TilemapComponent::TileType));
+
+            component.Resize(width, height);
+            component.SetTiles(0, tiles.data(), tiles.size());
+        }
+
+        static void ReadComponent(SnapshotReader& in, MeshComponent& component) {
+            in.Read(component.MeshPath);
+        }
+
+        static void ReadComponent(SnapshotReader& in, MaterialComponent& component) {
+            in.Read(component.ShaderPath);
+            in.Read(component.Color);
+        }
+
+        // Archives in the shape expected by entt::snapshot and entt::snapshot_loader
+        class SnapshotOutputArchive {
+        public:
+            explicit SnapshotOutputArchive(SnapshotWriter& out)
+                : m_Out(out) {}
+
+        public:
+            template <TriviallyCopyableConcept T>
+            void operator ()(const T& value) {
+                m_Out.Write(value);
+            }
+
+            template <typename Component>
+            void operator ()(entt::entity handle, const Component& component) {
+                m_Out.Write(handle);
+                WriteComponent(m_Out, component);
+            }
+
+        private:
+            SnapshotWriter& m_Out;
+
+        }; // class SnapshotOutputArchive
+
+        class SnapshotInputArchive {
+        public:
+            SnapshotInputArchive(SnapshotReader& in, std::vector<ScriptState>& scriptStates)
+                : m_In(in)
+                , m_ScriptStates(scriptStates) {}
+
+        public:
+            template <TriviallyCopyableConcept T>
+            void operator ()(T& value) {
+                m_In.Read(value);
+            }
+
+            template <typename Component>
+            void operator ()(entt::entity& handle, Component& component) {
+                m_In.Read(handle);
+                ReadComponent(m_In, component);
+            }
+
+            // Scripts are instantiated here, their state is restored once all entities are loaded
+            void operator ()(entt::entity& handle, NativeScriptComponent& component) {
+                std::string scriptName;
+
+                m_In.Read(handle);
+                m_In.Read(scriptName);
+
+                // The loader may reuse the same instance for every entity
+                component = NativeScriptComponent();
+
+                if (!scriptName.empty() && !component.Bind(scriptName))
+                    ZIBEN_CORE_WARN("Snapshot: script {0} isn't bound, its component is dropped", scriptName);
+
+                if (!m_In.Read<bool>())
+                    return;
+
+                auto state = m_In.Slice(m_In.Read<uint32_t>());
+
+                if (component.m_InstantiateScript) {
+                    component.m_Instance = component.m_InstantiateScript();
+                    m_ScriptStates.push_back({ handle, state });
+                }
+            }
+
+        private:
+            SnapshotReader&           m_In;
+            std::vector<ScriptState>& m_ScriptStates;
+
+        }; // class SnapshotInputArchive
+
+        template <typename... Components>
+        struct SnapshotComponentList {
+            static void Save(const entt::registry& registry, SnapshotOutputArchive& archive) {
+                entt::snapshot{ registry }.entities(archive).template component<Components...>(archive);
+            }
+
+            static void Load(entt::registry& registry, SnapshotInputArchive& archive) {
+                entt::snapshot_loader{ registry }.entities(archive).template component<Components...>(archive).orphans();
+            }
+        };
+
+        using SnapshotComponents = SnapshotComponentList<
+            IDComponent,
+            TagComponent,
+            TransformComponent,
+            SpriteRendererComponent,
+            TilemapComponent,
+            MeshComponent,
+            MaterialComponent,
+            CameraComponent,
+            NativeScriptComponent
+        >;
+
+    } // namespace Internal
 
     SceneSerializer::SceneSerializer(const Ref<Scene>& context)
         : m_Context(context) {}
 
-    void SceneSerializer::Serialize(const std::string& filepath) {
-        YAML::Emitter out;
+    bool SceneSerializer::Serialize(const std::string& filepath) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto        begin       = Internal::Clock::now();
+        std::size_t entityCount = 0;
+        SceneWriter out(filepath);
+
+        if (!out.IsOpen())
+            return false;
 
-        out << YAML::BeginMap;
+        out.Write("Scene", "Untitled");
+
+        out.BeginSequence("Entities");
         {
-            out << YAML::Key   << "Scene";
-            out << YAML::Value << "Untitled";
+            m_Context->m_Registry.each([&](entt::entity handle) {
+                Entity entity(handle, m_Context.get());
+
+                if (!entity)
+                    return;
+
+                SerializeEntity(out, entity);
+                ++entityCount;
+            });
+        }
+        out.EndSequence();
+
+        // The file is incomplete, nothing can be appended to it
+        if (!out.Flush()) {
+            ZIBEN_CORE_ERROR("SceneSerializer: can't write the scene into {0}", filepath);
+
+            m_Context->m_SaveState.Filepath.clear();
+
+            return false;
+        }
+
+        m_Context->ResetSaveState(filepath);
+
+        Internal::LogThroughput("Serialized", entityCount, begin);
+
+        return true;
+    }
+
+    bool SceneSerializer::SerializeIncremental(const std::string& filepath) {
+        ZIBEN_PROFILE_FUNCTION();
 
-            out << YAML::Key   << "Entities";
-            out << YAML::Value << YAML::BeginSeq;
-            {
-                m_Context->m_Registry.each([&](entt::entity handle) {
-                    Entity entity(handle, m_Context.get());
+        auto& saveState = m_Context->m_SaveState;
 
-                    if (!entity)
-                        return;
+        // Changed entities are appended to the end of the Entities sequence, later records override
+        // earlier ones on load. The file is compacted with a full save once the appended records
+        // outnumber the live entities
+        bool isAppendable = saveState.Filepath == filepath
+            && saveState.AppendedRecordCount < m_Context->m_EntityMap.size()
+            && Internal::EndsWithNewLine(filepath);
 
+        if (!isAppendable)
+            return Serialize(filepath);
+
+        if (!m_Context->HasUnsavedChanges())
+            return true;
+
+        auto        begin       = Internal::Clock::now();
+        std::size_t recordCount = 0;
+        SceneWriter out(filepath, true);
+
+        if (!out.IsOpen())
+            return false;
+
+        out.ResumeSequence();
+        {
+            for (const UUID& uuid : saveState.DestroyedEntities) {
+                out.BeginSequenceItem();
+                {
+                    out.Write("Entity",      static_cast<uint64_t>(uuid));
+                    out.Write("IsDestroyed", true);
+                }
+                out.EndSequenceItem();
+
+                ++recordCount;
+            }
+
+            for (const UUID& uuid : saveState.DirtyEntities) {
+                if (Entity entity = m_Context->GetEntityByUUID(uuid)) {
                     SerializeEntity(out, entity);
-                });
+                    ++recordCount;
+                }
             }
-            out << YAML::EndSeq;
         }
-        out << YAML::EndMap;
+        out.EndSequence();
+
+        // The appended records may be partial, the next save rewrites the file
+        if (!out.Flush()) {
+            ZIBEN_CORE_ERROR("SceneSerializer: can't append the changes to {0}", filepath);
+
+            saveState.Filepath.clear();
+
+            return false;
+        }
+
+        m_Context->ResetSaveState(filepath, saveState.AppendedRecordCount + recordCount);
 
-        std::ofstream outfile(filepath);
-        outfile << out.c_str();
-        outfile.close();
+        Internal::LogThroughput("Appended", recordCount, begin);
+
+        return true;
     }
 
     void SceneSerializer::SerializeRuntime(const std::string& filepath) {
-        // Not implemented
-        assert(false);
-    }
+        ZIBEN_PROFILE_FUNCTION();
 
-    bool SceneSerializer::Deserialize(const std::string& filepath) {
-        std::ifstream     infile(filepath);
-        std::stringstream ss;
+        SnapshotWriter out;
+        SerializeRuntime(out);
 
-        assert(infile);
+        std::ofstream file(filepath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
 
-        ss << infile.rdbuf();
+        if (!file) {
+            ZIBEN_CORE_ERROR("SceneSerializer: can't open the file by provided path: {0}", filepath);
+            return;
+        }
 
-        YAML::Node data = YAML::Load(ss.str());
+        file.write(out.GetBuffer().data(), static_cast<std::streamsize>(out.GetSize()));
+    }
 
-        if (!data["Scene"])
-            return false;
+    void SceneSerializer::SerializeRuntime(SnapshotWriter& out) {
+        ZIBEN_PROFILE_FUNCTION();
 
-        auto sceneName = data["Scene"].as<std::string>();
-        ZIBEN_CORE_INFO("Deserializing scene {0}", sceneName);
+        auto                            begin = Internal::Clock::now();
+        Internal::SnapshotOutputArchive archive(out);
 
-        YAML::Node entities = data["Entities"];
+        out.Write(Internal::s_SnapshotMagic);
+        out.Write(Internal::s_SnapshotVersion);
 
-        if (entities) {
-            for (const auto& entity : entities) {
-                auto        uuid = entity["Entity"].as<uint64_t>();
-                std::string name;
+        Internal::SnapshotComponents::Save(m_Context->m_Registry, archive);
+
+        Internal::LogThroughput("Snapshotted", m_Context->m_EntityMap.size(), begin);
+    }
 
-                if (auto component = entity["TagComponent"])
-                    name = component["Tag"].as<std::string>();
+    bool SceneSerializer::Deserialize(const std::string& filepath, const ProgressCallback& progressCallback) {
+        ZIBEN_PROFILE_FUNCTION();
 
-                ZIBEN_CORE_INFO("Deserializing entity with ID = {0}, name = {1}", uuid, name);
-                Entity deserializedEntity = m_Context->CreateEntity(name);
+        auto        begin = Internal::Clock::now();
+        SceneReader in(filepath);
 
-                if (auto serializedComponent = entity["TransformComponent"]) {
-                    auto& entityComponent = deserializedEntity.GetOrPushComponent<TransformComponent>();
+        if (!in.IsOpen())
+            return false;
+
+        // Names of the currently opened maps, indexed by depth
+        std::array<std::string, 8> path;
+        std::size_t                recordCount  = 0;
+        Entity                     entity;
+        bool                       isItemOpened = false;
+        bool                       hasScene     = false;
+
+        // Creates the entity of the current record, an entity with the same UUID
+        // written by an earlier record is replaced
+        auto createEntity = [&](uint64_t id) {
+            UUID uuid = id != 0 && id != Internal::s_LegacyEntityID ? UUID(id) : UUID();
+
+            if (Entity previous = m_Context->GetEntityByUUID(uuid))
+                m_Context->DestroyEntity(previous);
+
+            entity       = m_Context->CreateEntityWithUUID(uuid);
+            isItemOpened = false;
+        };
+
+        bool isParsed = in.Parse([&](const SceneReader::Event& event) {
+            if (event.Depth >= path.size())
+                return;
+
+            if (event.Type == SceneReader::EventType::BeginMap)
+                path[event.Depth] = event.Key;
+
+            switch (event.Depth) {
+                case 0: {
+                    if (event.Key == "Scene") {
+                        hasScene = true;
+                        ZIBEN_CORE_INFO("Deserializing scene {0}", SceneReader::ParseString(event.Value));
+                    }
 
-                    entityComponent.SetTranslation(serializedComponent["Translation"].as<glm::vec3>());
-                    entityComponent.SetRotation(serializedComponent["Rotation"].as<glm::vec3>());
-                    entityComponent.SetScale(serializedComponent["Scale"].as<glm::vec3>());
+                    break;
                 }
 
-                if (auto serializedComponent = entity["CameraComponent"]) {
-                    auto& component                   = deserializedEntity.GetOrPushComponent<CameraComponent>();
-                    auto  serializedCamera            = serializedComponent["Camera"];
-                    auto  serializedPerspectiveProps  = serializedCamera["PerspectiveProps"];
-                    auto  serializedOrthographicProps = serializedCamera["OrthographicProps"];
-
-                    component.Camera.SetPerspective({
-                        serializedPerspectiveProps["Fov"].as<float>(),
-                        serializedPerspectiveProps["Near"].as<float>(),
-                        serializedPerspectiveProps["Far"].as<float>()
-                    });
-
-                    component.Camera.SetOrthographic({
-                        serializedOrthographicProps["Size"].as<float>(),
-                        serializedOrthographicProps["Near"].as<float>(),
-                        serializedOrthographicProps["Far"].as<float>()
-                    });
-
-                    component.Camera.SetProjectionType(
-                        static_cast<SceneCamera::ProjectionType>(serializedCamera["ProjectionType"].as<int>())
-                    );
-
-                    component.IsPrimary           = serializedComponent["IsPrimary"].as<bool>();
-                    component.HasFixedAspectRatio = serializedComponent["HasFixedAspectRatio"].as<bool>();
+                case 1: {
+                    // Every item of the Entities sequence is a record that starts with the entity id
+                    if (event.Type == SceneReader::EventType::BeginSequenceItem && path[0] == "Entities") {
+                        entity       = Entity::Null;
+                        isItemOpened = true;
+                        ++recordCount;
+
+                        if (progressCallback && recordCount % Internal::s_ProgressRecordInterval == 0)
+                            progressCallback(in.GetProgress());
+                    }
+
+                    break;
                 }
 
-                if (auto serializedComponent = entity["SpriteRendererComponent"]) {
-                    auto& component = deserializedEntity.GetOrPushComponent<SpriteRendererComponent>();
+                case 2: {
+                    if (!isItemOpened && !entity)
+                        break;
+
+                    if (event.Type == SceneReader::EventType::Scalar && event.Key == "Entity") {
+                        uint64_t id = 0;
+
+                        if (!SceneReader::ParseUInt64(event.Value, id))
+                            Internal::WarnInvalidValue("Entity", event.Key, event.Value);
+
+                        createEntity(id);
+                    } else if (event.Type == SceneReader::EventType::Scalar && event.Key == "IsDestroyed") {
+                        if (entity) {
+                            m_Context->DestroyEntity(entity);
+                            entity = Entity::Null;
+                        }
+                    } else if (isItemOpened) {
+                        // Record without an id
+                        createEntity(0);
+                    }
 
-                    component.Color = serializedComponent["Color"].as<glm::vec4>();
+                    break;
+                }
+
+                default: {
+                    if (!entity || event.Type != SceneReader::EventType::Scalar)
+                        break;
+
+                    std::string_view component = path[2];
+
+                    if (event.Depth == 3 && component == "TagComponent" && event.Key == "Tag")
+                        entity.GetComponent<TagComponent>().Tag = SceneReader::ParseString(event.Value);
+                    else if (event.Depth == 3 && component == "TransformComponent")
+                        Internal::DeserializeTransformComponent(entity, event.Key, event.Value);
+                    else if (event.Depth == 3 && component == "SpriteRendererComponent")
+                        Internal::DeserializeSpriteRendererComponent(entity, event.Key, event.Value);
+                    else if (event.Depth == 3 && component == "TilemapComponent")
+                        Internal::DeserializeTilemapComponent(entity, event.Key, event.Value);
+                    else if (event.Depth == 3 && component == "MeshComponent")
+                        Internal::DeserializeMeshComponent(entity, event.Key, event.Value);
+                    else if (event.Depth == 3 && component == "MaterialComponent")
+                        Internal::DeserializeMaterialComponent(entity, event.Key, event.Value);
+                    else if (event.Depth == 3 && component == "CameraComponent")
+                        Internal::DeserializeCameraComponent(entity, {}, event.Key, event.Value);
+                    else if (event.Depth == 4 && component == "CameraComponent" && path[3] == "Camera")
+                        Internal::DeserializeCameraComponent(entity, "Camera", event.Key, event.Value);
+                    else if (event.Depth == 5 && component == "CameraComponent" && path[3] == "Camera")
+                        Internal::DeserializeCameraComponent(entity, path[4], event.Key, event.Value);
+
+                    break;
                 }
             }
-        }
+        });
 
-        return true;
+        m_Context->ResetSaveState(filepath, recordCount - std::min(recordCount, m_Context->m_EntityMap.size()));
+
+        if (progressCallback)
+            progressCallback(1.0f);
+
+        Internal::LogThroughput("Deserialized", recordCount, begin);
+
+        return isParsed && hasScene;
     }
 
     bool SceneSerializer::DeserializeRuntime(const std::string& filepath) {
-        // Not implemented
-        assert(false);
-        return false;
+        ZIBEN_PROFILE_FUNCTION();
+
+        std::ifstream file(filepath, std::ios_base::in | std::ios_base::binary);
+
+        if (!file) {
+            ZIBEN_CORE_ERROR("SceneSerializer: can't open the file by provided path: {0}", filepath);
+            return false;
+        }
+
+        std::error_code   error;
+        std::vector<char> buffer(static_cast<std::size_t>(std::filesystem::file_size(filepath, error)));
+
+        if (error || !file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+            ZIBEN_CORE_ERROR("SceneSerializer: can't read the snapshot {0}", filepath);
+            return false;
+        }
+
+        SnapshotReader in(buffer);
+
+        return DeserializeRuntime(in);
+    }
+
+    bool SceneSerializer::DeserializeRuntime(SnapshotReader& in) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto  begin    = Internal::Clock::now();
+        auto& registry = m_Context->m_Registry;
+
+        if (in.Read<uint32_t>() != Internal::s_SnapshotMagic || in.Read<uint32_t>() != Internal::s_SnapshotVersion) {
+            ZIBEN_CORE_ERROR("SceneSerializer: snapshot has unknown format");
+            return false;
+        }
+
+        // Running scripts are destroyed together with the state they belong to. Instances of a truncated
+        // snapshot are never bound to their entity, so only their memory is freed
+        auto clear = [&] {
+            registry.view<NativeScriptComponent>().each([](NativeScriptComponent& component) {
+                if (component.m_Instance) {
+                    if (component.m_Instance->m_Entity)
+                        component.m_Instance->OnDestroy();
+
+                    component.m_DestroyScript(&component);
+                }
+            });
+
+            registry.clear();
+            m_Context->m_EntityMap.clear();
+            m_Context->m_SpatialIndex.Clear();
+            m_Context->m_StaticSpriteCache.Clear();
+            m_Context->m_TilemapCache.Clear();
+            m_Context->m_MeshCache.Clear();
+        };
+
+        clear();
+
+        std::vector<Internal::ScriptState> scriptStates;
+        Internal::SnapshotInputArchive     archive(in, scriptStates);
+
+        Internal::SnapshotComponents::Load(registry, archive);
+
+        if (!in.IsValid()) {
+            ZIBEN_CORE_ERROR("SceneSerializer: snapshot is truncated");
+            clear();
+
+            return false;
+        }
+
+        registry.view<IDComponent>().each([&](entt::entity handle, const IDComponent& component) {
+            m_Context->m_EntityMap.emplace(component.ID, handle);
+        });
+
+        for (auto& [handle, state] : scriptStates) {
+            auto* instance = registry.get<NativeScriptComponent>(handle).m_Instance;
+
+            instance->m_Entity = Entity(handle, m_Context.get());
+            instance->OnDeserialize(state);
+        }
+
+        // Components of scripts that aren't bound in this build can't be updated
+        std::vector<entt::entity> unboundScripts;
+
+        registry.view<NativeScriptComponent>().each([&](entt::entity handle, const NativeScriptComponent& component) {
+            if (!component.m_InstantiateScript)
+                unboundScripts.push_back(handle);
+        });
+
+        registry.remove<NativeScriptComponent>(unboundScripts.begin(), unboundScripts.end());
+
+        // The restored state doesn't match the scene file anymore, so the next save is a full one
+        m_Context->ResetSaveState({});
+
+        Internal::LogThroughput("Restored", m_Context->m_EntityMap.size(), begin);
+
+        return true;
     }
 
-    void SceneSerializer::SerializeEntity(YAML::Emitter& out, const Entity& entity) {
-        out << YAML::BeginMap;
+    void SceneSerializer::SerializeEntity(SceneWriter& out, const Entity& entity) {
+        out.BeginSequenceItem();
         {
-            out << YAML::Key   << "Entity";
-            out << YAML::Value << "12391723912837";
+            out.Write("Entity", static_cast<uint64_t>(entity.GetUUID()));
 
             if (entity.HasComponent<TagComponent>()) {
-                out << YAML::Key << "TagComponent";
-                out << YAML::BeginMap;
+                out.BeginMap("TagComponent");
                 {
                     auto& component = entity.GetComponent<TagComponent>();
 
-                    out << YAML::Key   << "Tag";
-                    out << YAML::Value << component.Tag;
+                    out.Write("Tag", component.Tag);
                 }
-                out << YAML::EndMap;
+                out.EndMap();
             }
 
             if (entity.HasComponent<TransformComponent>()) {
-                out << YAML::Key << "TransformComponent";
-                out << YAML::BeginMap;
+                out.BeginMap("TransformComponent");
                 {
                     auto& component = entity.GetComponent<TransformComponent>();
 
-                    out << YAML::Key   << "Translation";
-                    out << YAML::Value << component.GetTranslation();
-
-                    out << YAML::Key   << "Rotation";
-                    out << YAML::Value << component.GetRotation();
-
-                    out << YAML::Key   << "Scale";
-                    out << YAML::Value << component.GetScale();
+                    out.Write("Translation", component.GetTranslation());
+                    out.Write("Rotation",    component.GetRotation());
+                    out.Write("Scale",       component.GetScale());
                 }
-                out << YAML::EndMap;
+                out.EndMap();
             }
 
             if (entity.HasComponent<CameraComponent>()) {
-                out << YAML::Key << "CameraComponent";
-                out << YAML::BeginMap;
+                out.BeginMap("CameraComponent");
                 {
                     auto& component = entity.GetComponent<CameraComponent>();
 
-                    out << YAML::Key << "Camera";
-                    out << YAML::BeginMap;
+                    out.BeginMap("Camera");
                     {
-                        out << YAML::Key << "ProjectionType";
-                        out << YAML::Value << static_cast<int>(component.Camera.GetProjectionType());
+                        out.Write("ProjectionType", static_cast<int>(component.Camera.GetProjectionType()));
 
-                        out << YAML::Key << "PerspectiveProps";
-                        out << YAML::BeginMap;
+                        out.BeginMap("PerspectiveProps");
                         {
-                            out << YAML::Key   << "Fov";
-                            out << YAML::Value << component.Camera.GetPerspectiveProps().Fov;
-
-                            out << YAML::Key   << "Near";
-                            out << YAML::Value << component.Camera.GetPerspectiveProps().Near;
-
-                            out << YAML::Key   << "Far";
-                            out << YAML::Value << component.Camera.GetPerspectiveProps().Far;
+                            out.Write("Fov",  component.Camera.GetPerspectiveProps().Fov);
+                            out.Write("Near", component.Camera.GetPerspectiveProps().Near);
+                            out.Write("Far",  component.Camera.GetPerspectiveProps().Far);
                         }
-                        out << YAML::EndMap;
+                        out.EndMap();
 
-                        out << YAML::Key << "OrthographicProps";
-                        out << YAML::BeginMap;
+                        out.BeginMap("OrthographicProps");
                         {
-                            out << YAML::Key   << "Size";
-                            out << YAML::Value << component.Camera.GetOrthographicProps().Size;
-
-                            out << YAML::Key   << "Near";
-                            out << YAML::Value << component.Camera.GetOrthographicProps().Near;
-
-                            out << YAML::Key   << "Far";
-                            out << YAML::Value << component.Camera.GetOrthographicProps().Far;
+                            out.Write("Size", component.Camera.GetOrthographicProps().Size);
+                            out.Write("Near", component.Camera.GetOrthographicProps().Near);
+                            out.Write("Far",  component.Camera.GetOrthographicProps().Far);
                         }
-                        out << YAML::EndMap;
+                        out.EndMap();
                     }
-                    out << YAML::EndMap;
-
-                    out << YAML::Key   << "IsPrimary";
-                    out << YAML::Value << component.IsPrimary;
+                    out.EndMap();
 
-                    out << YAML::Key   << "HasFixedAspectRatio";
-                    out << YAML::Value << component.HasFixedAspectRatio;
+                    out.Write("IsPrimary",           component.IsPrimary);
+                    out.Write("HasFixedAspectRatio", component.HasFixedAspectRatio);
                 }
-                out << YAML::EndMap;
+                out.EndMap();
             }
 
             if (entity.HasComponent<SpriteRendererComponent>()) {
-                out << YAML::Key << "SpriteRendererComponent";
-                out << YAML::BeginMap;
+                out.BeginMap("SpriteRendererComponent");
                 {
                     auto& component = entity.GetComponent<SpriteRendererComponent>();
 
-                    out << YAML::Key   << "Color";
-                    out << YAML::Value << component.Color;
+                    out.Write("Color",    component.Color);
+                    out.Write("IsStatic", component.IsStatic);
+                }
+                out.EndMap();
+            }
+
+            if (entity.HasComponent<TilemapComponent>()) {
+                out.BeginMap("TilemapComponent");
+                {
+                    auto& component = entity.GetComponent<TilemapComponent>();
+
+                    out.Write("Width",           static_cast<int>(component.GetWidth()));
+                    out.Write("Height",          static_cast<int>(component.GetHeight()));
+                    out.Write("TilesetPath",     component.TilesetPath);
+                    out.Write("TilesetCellSize", component.TilesetCellSize);
+                    out.Write("Color",           component.Color);
+
+                    Internal::SerializeTiles(out, component);
+                }
+                out.EndMap();
+            }
+
+            if (entity.HasComponent<MeshComponent>()) {
+                out.BeginMap("MeshComponent");
+                {
+                    out.Write("MeshPath", entity.GetComponent<MeshComponent>().MeshPath);
+                }
+                out.EndMap();
+            }
+
+            if (entity.HasComponent<MaterialComponent>()) {
+                out.BeginMap("MaterialComponent");
+                {
+                    auto& component = entity.GetComponent<MaterialComponent>();
+
+                    out.Write("ShaderPath", component.ShaderPath);
+                    out.Write("Color",      component.Color);
                 }
-                out << YAML::EndMap;
+                out.EndMap();
             }
         }
-        out << YAML::EndMap;
+        out.EndSequenceItem();
     }
 
 } // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,510 @@
+#include "SceneStream.hpp"
+
+namespace Ziben {
+
+    namespace Internal {
+
+        static inline std::string_view Trim(std::string_view value) {
+            auto begin = value.find_first_not_of(" \t\r");
+
+            if (begin == std::string_view::npos)
+                return {};
+
+            auto end = value.find_last_not_of(" \t\r");
+
+            return value.substr(begin, end - begin + 1);
+        }
+
+        static bool IsPlainString(std::string_view value) {
+            if (value.empty() || value.front() == ' ' || value.back() == ' ')
+                return false;
+
+            if (value.front() == '-' || value.front() == '?')
+                return false;
+
+            return value.find_first_of(":#'\"[]{},&*!|>%@`\\\t\r\n") == std::string_view::npos;
+        }
+
+        // Position of the ':' that separates key and value, quoted keys are not supported
+        static std::size_t FindKeySeparator(std::string_view line) {
+            for (std::size_t i = 0; i < line.size(); ++i) {
+                if (line[i] == '"' || line[i] == '\'' || line[i] == '[' || line[i] == '{')
+                    return std::string_view::npos;
+
+                if (line[i] == ':' && (i + 1 == line.size() || line[i + 1] == ' '))
+                    return i;
+            }
+
+            return std::string_view::npos;
+        }
+
+        // Position of the " #" that starts a comment, skipping a leading quoted scalar since it may contain '#'.
+        // A quote only opens a scalar at its start, so the apostrophe in a plain value doesn't count
+        static std::size_t FindComment(std::string_view value) {
+            std::size_t offset = 0;
+
+            if (!value.empty() && (value.front() == '"' || value.front() == '\'')) {
+                for (offset = 1; offset < value.size(); ++offset) {
+                    if (value.front() == '"' && value[offset] == '\\') {
+                        ++offset;
+                        continue;
+                    }
+
+                    // Doubled single quote is an escaped one
+                    if (value.front() == '\'' && value[offset] == '\'' && offset + 1 < value.size() && value[offset + 1] == '\'') {
+                        ++offset;
+                        continue;
+                    }
+
+                    if (value[offset] == value.front())
+                        break;
+                }
+            }
+
+            return offset < value.size() ? value.find(" #", offset) : std::string_view::npos;
+        }
+
+        template <typename T>
+        static bool ParseFlowSequence(std::string_view value, T* result, std::size_t count) {
+            value = Trim(value);
+
+            if (value.size() < 2 || value.front() != '[' || value.back() != ']')
+                return false;
+
+            value = value.substr(1, value.size() - 2);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                auto comma = value.find(',');
+
+                if ((comma == std::string_view::npos) != (i + 1 == count))
+                    return false;
+
+                if (!SceneReader::ParseFloat(value.substr(0, comma), result[i]))
+                    return false;
+
+                if (comma != std::string_view::npos)
+                    value = value.substr(comma + 1);
+            }
+
+            return true;
+        }
+
+    } // namespace Internal
+
+    SceneWriter::SceneWriter(const std::string& filepath, bool isAppend)
+        : m_Buffer(s_BufferSize)
+        , m_Indent(0)
+        , m_IsSequenceItemPending(false)
+        , m_HasError(false) {
+
+        m_OutputStream.rdbuf()->pubsetbuf(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+        m_OutputStream.open(
+            filepath,
+            std::ios_base::out | std::ios_base::binary | (isAppend ? std::ios_base::app : std::ios_base::trunc)
+        );
+
+        if (!m_OutputStream)
+            ZIBEN_CORE_ERROR("SceneWriter: can't open the file by provided path: {0}", filepath);
+    }
+
+    SceneWriter::~SceneWriter() {
+        Flush();
+    }
+
+    void SceneWriter::BeginMap(std::string_view key) {
+        WriteKey(key);
+        m_OutputStream.put('\n');
+
+        ++m_Indent;
+    }
+
+    void SceneWriter::EndMap() {
+        assert(m_Indent > 0);
+        --m_Indent;
+    }
+
+    void SceneWriter::BeginSequence(std::string_view key) {
+        BeginMap(key);
+    }
+
+    void SceneWriter::EndSequence() {
+        EndMap();
+    }
+
+    void SceneWriter::ResumeSequence() {
+        assert(m_Indent == 0);
+        ++m_Indent;
+    }
+
+    void SceneWriter::BeginSequenceItem() {
+        m_IsSequenceItemPending = true;
+        ++m_Indent;
+    }
+
+    void SceneWriter::EndSequenceItem() {
+        assert(m_Indent > 0);
+
+        m_IsSequenceItemPending = false;
+        --m_Indent;
+    }
+
+    void SceneWriter::Write(std::string_view key, std::string_view value) {
+        WriteKey(key);
+        m_OutputStream.put(' ');
+        WriteString(value);
+        m_OutputStream.put('\n');
+    }
+
+    void SceneWriter::Write(std::string_view key, const std::string& value) {
+        Write(key, std::string_view(value));
+    }
+
+    void SceneWriter::Write(std::string_view key, const char* value) {
+        Write(key, std::string_view(value));
+    }
+
+    void SceneWriter::Write(std::string_view key, bool value) {
+        WriteKey(key);
+        m_OutputStream << (value ? " true\n" : " false\n");
+    }
+
+    void SceneWriter::Write(std::string_view key, int value) {
+        std::array<char, 16> buffer = {};
+        auto [end, error]           = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+
+        WriteKey(key);
+        m_OutputStream.put(' ');
+        m_OutputStream.write(buffer.data(), end - buffer.data());
+        m_OutputStream.put('\n');
+    }
+
+    void SceneWriter::Write(std::string_view key, uint64_t value) {
+        std::array<char, 24> buffer = {};
+        auto [end, error]           = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+
+        WriteKey(key);
+        m_OutputStream.put(' ');
+        m_OutputStream.write(buffer.data(), end - buffer.data());
+        m_OutputStream.put('\n');
+    }
+
+    void SceneWriter::Write(std::string_view key, float value) {
+        WriteKey(key);
+        m_OutputStream.put(' ');
+        WriteFloat(value);
+        m_OutputStream.put('\n');
+    }
+
+    void SceneWriter::Write(std::string_view key, const glm::vec2& value) {
+        WriteKey(key);
+        m_OutputStream << " [";
+        WriteFloat(value.x); m_OutputStream << ", ";
+        WriteFloat(value.y);
+        m_OutputStream << "]\n";
+    }
+
+    void SceneWriter::Write(std::string_view key, const glm::vec3& value) {
+        WriteKey(key);
+        m_OutputStream << " [";
+        WriteFloat(value.x); m_OutputStream << ", ";
+        WriteFloat(value.y); m_OutputStream << ", ";
+        WriteFloat(value.z);
+        m_OutputStream << "]\n";
+    }
+
+    void SceneWriter::Write(std::string_view key, const glm::vec4& value) {
+        WriteKey(key);
+        m_OutputStream << " [";
+        WriteFloat(value.x); m_OutputStream << ", ";
+        WriteFloat(value.y); m_OutputStream << ", ";
+        WriteFloat(value.z); m_OutputStream << ", ";
+        WriteFloat(value.w);
+        m_OutputStream << "]\n";
+    }
+
+    bool SceneWriter::Flush() {
+        if (m_OutputStream.is_open())
+            m_OutputStream.flush();
+
+        return IsGood();
+    }
+
+    void SceneWriter::WriteKey(std::string_view key) {
+        static constexpr std::string_view indentation = "                                ";
+
+        static_assert(s_MaxIndent * 2 <= indentation.size());
+
+        if (m_Indent > s_MaxIndent) {
+            if (!m_HasError)
+                ZIBEN_CORE_ERROR("SceneWriter: nesting is deeper than {0} levels", s_MaxIndent);
+
+            m_HasError = true;
+            return;
+        }
+
+        if (m_IsSequenceItemPending) {
+            assert(m_Indent > 0);
+
+            m_OutputStream.write(indentation.data(), (m_Indent - 1) * 2);
+            m_OutputStream.write("- ", 2);
+
+            m_IsSequenceItemPending = false;
+        } else {
+            m_OutputStream.write(indentation.data(), m_Indent * 2);
+        }
+
+        m_OutputStream.write(key.data(), static_cast<std::streamsize>(key.size()));
+        m_OutputStream.put(':');
+    }
+
+    void SceneWriter::WriteString(std::string_view value) {
+        if (Internal::IsPlainString(value)) {
+            m_OutputStream.write(value.data(), static_cast<std::streamsize>(value.size()));
+            return;
+        }
+
+        m_OutputStream.put('"');
+
+        for (char ch : value) {
+            switch (ch) {
+                case '"':  m_OutputStream << "\\\""; break;
+                case '\\': m_OutputStream << "\\\\"; break;
+                case '\n': m_OutputStream << "\\n";  break;
+                case '\t': m_OutputStream << "\\t";  break;
+                case '\r': m_OutputStream << "\\r";  break;
+                default:   m_OutputStream.put(ch);   break;
+            }
+        }
+
+        m_OutputStream.put('"');
+    }
+
+    void SceneWriter::WriteFloat(float value) {
+        std::array<char, 32> buffer = {};
+        auto [end, error]           = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+
+        m_OutputStream.write(buffer.data(), end - buffer.data());
+    }
+
+    SceneReader::SceneReader(const std::string& filepath)
+        : m_Buffer(s_BufferSize)
+        , m_Columns({ 0 })
+        , m_ColumnCount(0)
+        , m_FileSize(0)
+        , m_ReadSize(0) {
+
+        m_InputStream.rdbuf()->pubsetbuf(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+        m_InputStream.open(filepath, std::ios_base::in | std::ios_base::binary);
+
+        if (!m_InputStream) {
+            ZIBEN_CORE_ERROR("SceneReader: can't open the file by provided path: {0}", filepath);
+            return;
+        }
+
+        std::error_code error;
+        m_FileSize = static_cast<std::size_t>(std::filesystem::file_size(filepath, error));
+    }
+
+    float SceneReader::GetProgress() const {
+        if (m_FileSize == 0)
+            return m_InputStream.eof() ? 1.0f : 0.0f;
+
+        return std::min(static_cast<float>(m_ReadSize) / static_cast<float>(m_FileSize), 1.0f);
+    }
+
+    bool SceneReader::Parse(const EventCallback& callback) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        if (!m_InputStream)
+            return false;
+
+        std::string line;
+        line.reserve(256);
+
+        m_ColumnCount = 0;
+        m_ReadSize    = 0;
+
+        while (std::getline(m_InputStream, line)) {
+            std::string_view view = line;
+
+            m_ReadSize += line.size() + 1;
+
+            if (!view.empty() && view.back() == '\r')
+                view.remove_suffix(1);
+
+            auto column = view.find_first_not_of(' ');
+
+            // Empty lines, comments and document markers
+            if (column == std::string_view::npos || view[column] == '#' || view.starts_with("---") || view.starts_with("..."))
+                continue;
+
+            if (view[column] == '\t') {
+                ZIBEN_CORE_ERROR("SceneReader: tabs are not allowed for indentation");
+                return false;
+            }
+
+            view.remove_prefix(column);
+
+            // Block sequence entries, "- - key" is not supported
+            if (view.starts_with("- ") || view == "-") {
+                uint32_t depth;
+
+                if (!GetDepth(static_cast<uint32_t>(column), depth))
+                    return false;
+
+                callback({ EventType::BeginSequenceItem, depth, {}, {} });
+
+                auto offset = view.find_first_not_of(' ', 1);
+
+                if (offset == std::string_view::npos)
+                    continue;
+
+                column += offset;
+                view.remove_prefix(offset);
+            }
+
+            auto separator = Internal::FindKeySeparator(view);
+
+            if (separator == std::string_view::npos) {
+                ZIBEN_CORE_ERROR("SceneReader: unsupported line '{0}'", line);
+                return false;
+            }
+
+            Event event;
+
+            if (!GetDepth(static_cast<uint32_t>(column), event.Depth))
+                return false;
+
+            event.Key   = Internal::Trim(view.substr(0, separator));
+            event.Value = Internal::Trim(view.substr(separator + 1));
+
+            if (auto comment = Internal::FindComment(event.Value); comment != std::string_view::npos)
+                event.Value = Internal::Trim(event.Value.substr(0, comment));
+
+            event.Type = event.Value.empty() ? EventType::BeginMap : EventType::Scalar;
+
+            callback(event);
+        }
+
+        return m_InputStream.eof();
+    }
+
+    bool SceneReader::ParseBool(std::string_view value, bool& result) {
+        value = Internal::Trim(value);
+
+        if (value == "true" || value == "True" || value == "TRUE") {
+            result = true;
+            return true;
+        }
+
+        if (value == "false" || value == "False" || value == "FALSE") {
+            result = false;
+            return true;
+        }
+
+        return false;
+    }
+
+    bool SceneReader::ParseInt(std::string_view value, int& result) {
+        value = Internal::Trim(value);
+
+        auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), result);
+
+        return error == std::errc() && end == value.data() + value.size();
+    }
+
+    bool SceneReader::ParseUInt64(std::string_view value, uint64_t& result) {
+        value = Internal::Trim(value);
+
+        auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), result);
+
+        return error == std::errc() && end == value.data() + value.size();
+    }
+
+    bool SceneReader::ParseFloat(std::string_view value, float& result) {
+        value = Internal::Trim(value);
+
+        if (!value.empty() && value.front() == '+')
+            value.remove_prefix(1);
+
+        auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), result);
+
+        return error == std::errc() && end == value.data() + value.size();
+    }
+
+    bool SceneReader::ParseVec2(std::string_view value, glm::vec2& result) {
+        return Internal::ParseFlowSequence(value, &result.x, 2);
+    }
+
+    bool SceneReader::ParseVec3(std::string_view value, glm::vec3& result) {
+        return Internal::ParseFlowSequence(value, &result.x, 3);
+    }
+
+    bool SceneReader::ParseVec4(std::string_view value, glm::vec4& result) {
+        return Internal::ParseFlowSequence(value, &result.x, 4);
+    }
+
+    std::string SceneReader::ParseString(std::string_view value) {
+        value = Internal::Trim(value);
+
+        if (value.size() < 2)
+            return std::string(value);
+
+        if (value.front() == '\'' && value.back() == '\'') {
+            std::string result;
+            result.reserve(value.size() - 2);
+
+            for (std::size_t i = 1; i + 1 < value.size(); ++i) {
+                result.push_back(value[i]);
+
+                // '' is an escaped single quote
+                if (value[i] == '\'' && value[i + 1] == '\'')
+                    ++i;
+            }
+
+            return result;
+        }
+
+        if (value.front() == '"' && value.back() == '"') {
+            std::string result;
+            result.reserve(value.size() - 2);
+
+            for (std::size_t i = 1; i + 1 < value.size(); ++i) {
+                if (value[i] != '\\' || i + 2 >= value.size()) {
+                    result.push_back(value[i]);
+                    continue;
+                }
+
+                switch (value[++i]) {
+                    case 'n':  result.push_back('\n');     break;
+                    case 't':  result.push_back('\t');     break;
+                    case 'r':  result.push_back('\r');     break;
+                    default:   result.push_back(value[i]); break;
+                }
+            }
+
+            return result;
+        }
+
+        return std::string(value);
+    }
+
+    bool SceneReader::GetDepth(uint32_t column, uint32_t& depth) {
+        while (m_ColumnCount > 0 && m_Columns[m_ColumnCount - 1] > column)
+            --m_ColumnCount;
+
+        if (m_ColumnCount == 0 || m_Columns[m_ColumnCount - 1] < column) {
+            if (m_ColumnCount == s_MaxDepthCount) {
+                ZIBEN_CORE_ERROR("SceneReader: nesting is deeper than {0} levels", s_MaxDepthCount);
+                return false;
+            }
+
+            m_Columns[m_ColumnCount++] = column;
+        }
+
+        depth = m_ColumnCount - 1;
+
+        return true;
+    }
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "SnapshotArchive.hpp"
+
+namespace Ziben {
+
+    void SnapshotWriter::Write(std::string_view value) {
+        Write(static_cast<uint32_t>(value.size()));
+        WriteBytes(value.data(), value.size());
+    }
+
+    void SnapshotWriter::WriteBytes(const void* data, std::size_t size) {
+        const auto* bytes = static_cast<const char*>(data);
+
+        m_Buffer.insert(m_Buffer.end(), bytes, bytes + size);
+    }
+
+    void SnapshotWriter::Clear() {
+        m_Buffer.clear();
+    }
+
+    SnapshotReader::SnapshotReader(const char* data, std::size_t size)
+        : m_Data(data)
+        , m_Size(size)
+        , m_Position(0)
+        , m_IsValid(true) {}
+
+    SnapshotReader::SnapshotReader(const std::vector<char>& buffer)
+        : SnapshotReader(buffer.data(), buffer.size()) {}
+
+    void SnapshotReader::Read(std::string& value) {
+        auto size = Read<uint32_t>();
+
+        if (!m_IsValid || size > m_Size - m_Position) {
+            m_IsValid = false;
+            value.clear();
+
+            return;
+        }
+
+        value.assign(m_Data + m_Position, size);
+        m_Position += size;
+    }
+
+    void SnapshotReader::ReadBytes(void* data, std::size_t size) {
+        if (!m_IsValid || size > m_Size - m_Position) {
+            m_IsValid = false;
+            std::memset(data, 0, size);
+
+            return;
+        }
+
+        std::memcpy(data, m_Data + m_Position, size);
+        m_Position += size;
+    }
+
+    void SnapshotReader::Skip(std::size_t size) {
+        if (!m_IsValid || size > m_Size - m_Position) {
+            m_IsValid = false;
+            return;
+        }
+
+        m_Position += size;
+    }
+
+    SnapshotReader SnapshotReader::Slice(std::size_t size) {
+        if (!m_IsValid || size > m_Size - m_Position) {
+            m_IsValid = false;
+            return SnapshotReader(nullptr, 0);
+        }
+
+        SnapshotReader slice(m_Data + m_Position, size);
+        m_Position += size;
+
+        return slice;
+    }
+
+} // namespace Ziben
\ No newline at end of file
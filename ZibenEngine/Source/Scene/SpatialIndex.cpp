@@ -0,0 +1,98 @@
+#include "SpatialIndex.hpp"
+
+#include "Component.hpp"
+#include "MeshCache.hpp"
+
+namespace Ziben {
+
+    void SpatialIndex::MarkMoved(entt::entity handle) {
+        m_MovedEntities.insert(handle);
+    }
+
+    void SpatialIndex::Remove(entt::entity handle) {
+        m_MovedEntities.erase(handle);
+
+        if (auto it = m_Proxies.find(handle); it != m_Proxies.end()) {
+            GetLayerTree(it->second.TreeLayer).Remove(it->second.Index);
+            m_Proxies.erase(it);
+        }
+    }
+
+    bool SpatialIndex::GetBounds(const entt::registry& registry, MeshCache& meshCache, entt::entity handle, AABB& bounds) {
+        const auto* transform = registry.try_get<TransformComponent>(handle);
+
+        if (!transform)
+            return false;
+
+        bool isEmpty = true;
+
+        auto merge = [&](const AABB& other) {
+            bounds  = isEmpty ? other : AABB::Merge(bounds, other);
+            isEmpty = false;
+        };
+
+        if (registry.all_of<SpriteRendererComponent>(handle))
+            merge(AABB::FromQuad(transform->GetTransform()));
+
+        if (const auto* tilemap = registry.try_get<TilemapComponent>(handle); tilemap && tilemap->GetWidth() > 0 && tilemap->GetHeight() > 0)
+            merge(AABB::FromQuad(transform->GetTransform() * tilemap->GetQuadTransform()));
+
+        if (registry.all_of<MeshComponent>(handle))
+            if (const auto* mesh = meshCache.GetMesh(registry, handle))
+                merge(mesh->GetBounds().Transform(transform->GetTransform()));
+
+        return !isEmpty;
+    }
+
+    std::size_t SpatialIndex::Update(const entt::registry& registry, MeshCache& meshCache) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        std::size_t reinsertedCount = 0;
+
+        for (entt::entity handle : m_MovedEntities) {
+            auto it     = m_Proxies.find(handle);
+            AABB bounds;
+
+            // Cameras and the entities that draw nothing take no part in the queries
+            if (!registry.valid(handle) || !GetBounds(registry, meshCache, handle, bounds)) {
+                if (it != m_Proxies.end()) {
+                    GetLayerTree(it->second.TreeLayer).Remove(it->second.Index);
+                    m_Proxies.erase(it);
+                }
+
+                continue;
+            }
+
+            // Entities with a sprite stay in the sprite trees, the renderer draws them from there
+            const auto* sprite = registry.try_get<SpriteRendererComponent>(handle);
+            Layer       layer  = !sprite ? Layer::Geometry : sprite->IsStatic ? Layer::Static : Layer::Dynamic;
+
+            if (it != m_Proxies.end() && it->second.TreeLayer != layer) {
+                GetLayerTree(it->second.TreeLayer).Remove(it->second.Index);
+                m_Proxies.erase(it);
+
+                it = m_Proxies.end();
+            }
+
+            if (it == m_Proxies.end()) {
+                m_Proxies.emplace(handle, Proxy{ layer, GetLayerTree(layer).Insert(bounds, static_cast<uint32_t>(handle)) });
+                ++reinsertedCount;
+            } else if (GetLayerTree(layer).Move(it->second.Index, bounds)) {
+                ++reinsertedCount;
+            }
+        }
+
+        m_MovedEntities.clear();
+
+        return reinsertedCount;
+    }
+
+    void SpatialIndex::Clear() {
+        for (auto& tree : m_Trees)
+            tree.Clear();
+
+        m_Proxies.clear();
+        m_MovedEntities.clear();
+    }
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "StaticSpriteCache.hpp"
+
+#include "Component.hpp"
+
+namespace Ziben {
+
+    namespace Internal {
+
+        static uint64_t GetCellKey(const glm::mat4& transform) {
+            auto x = static_cast<int32_t>(std::floor(transform[3].x / StaticSpriteCache::CellSize));
+            auto y = static_cast<int32_t>(std::floor(transform[3].y / StaticSpriteCache::CellSize));
+
+            return static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32 | static_cast<uint32_t>(y);
+        }
+
+    } // namespace Internal
+
+    void StaticSpriteCache::MarkDirty(entt::entity handle) {
+        m_PendingEntities.insert(handle);
+    }
+
+    void StaticSpriteCache::Remove(entt::entity handle) {
+        m_PendingEntities.erase(handle);
+
+        auto it = m_Slots.find(handle);
+
+        if (it == m_Slots.end())
+            return;
+
+        auto [chunkIndex, entityIndex] = it->second;
+        auto& chunk                    = m_Chunks[chunkIndex];
+
+        // Swap with the last entity of the chunk, the chunk is rebuilt anyway
+        if (entt::entity last = chunk.Entities.back(); last != handle) {
+            chunk.Entities[entityIndex] = last;
+            m_Slots[last].EntityIndex   = entityIndex;
+        }
+
+        chunk.Entities.pop_back();
+        chunk.IsDirty = true;
+
+        m_Slots.erase(it);
+    }
+
+    void StaticSpriteCache::Update(const entt::registry& registry) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto pendingEntities = std::move(m_PendingEntities);
+        m_PendingEntities.clear();
+
+        for (entt::entity handle : pendingEntities) {
+            const auto* sprite = registry.valid(handle) ? registry.try_get<SpriteRendererComponent>(handle) : nullptr;
+
+            if (!sprite || !sprite->IsStatic || !registry.all_of<TransformComponent>(handle)) {
+                Remove(handle);
+                continue;
+            }
+
+            uint64_t cell = Internal::GetCellKey(registry.get<TransformComponent>(handle).GetTransform());
+
+            if (auto it = m_Slots.find(handle); it != m_Slots.end()) {
+                if (auto& chunk = m_Chunks[it->second.ChunkIndex]; chunk.Cell == cell) {
+                    chunk.IsDirty = true;
+                    continue;
+                }
+
+                // Moved into another cell
+                Remove(handle);
+            }
+
+            Insert(handle, cell);
+        }
+
+        for (uint32_t chunkIndex = 0; chunkIndex < m_Chunks.size(); ++chunkIndex) {
+            auto& chunk = m_Chunks[chunkIndex];
+
+            if (!chunk.IsDirty)
+                continue;
+
+            if (chunk.Entities.empty())
+                ReleaseChunk(chunkIndex);
+            else
+                RebuildChunk(registry, chunk);
+        }
+    }
+
+    void StaticSpriteCache::Render(const Frustum& frustum) const {
+        ZIBEN_PROFILE_FUNCTION();
+
+        for (const auto& chunk : m_Chunks) {
+            if (chunk.QuadCount == 0)
+                continue;
+
+            if (!frustum.Intersects(chunk.Bounds.GetCenter(), chunk.Bounds.GetExtents())) {
+                Renderer2D::GetStatistics().CulledQuadCount += chunk.QuadCount;
+                continue;
+            }
+
+            Renderer2D::DrawQuadVertexArray(chunk.QuadVertexArray, chunk.QuadCount);
+        }
+    }
+
+    void StaticSpriteCache::Clear() {
+        m_Chunks.clear();
+        m_FreeChunks.clear();
+        m_CellChunks.clear();
+        m_Slots.clear();
+        m_PendingEntities.clear();
+    }
+
+    void StaticSpriteCache::Insert(entt::entity handle, uint64_t cell) {
+        auto& chunkIndices = m_CellChunks[cell];
+
+        // Space freed by removed sprites is reused before a new chunk is created
+        auto chunkIndex = std::find_if(chunkIndices.begin(), chunkIndices.end(), [&](uint32_t index) {
+            return m_Chunks[index].Entities.size() < ChunkCapacity;
+        });
+
+        if (chunkIndex == chunkIndices.end()) {
+            uint32_t newChunkIndex = static_cast<uint32_t>(m_Chunks.size());
+
+            if (!m_FreeChunks.empty()) {
+                newChunkIndex = m_FreeChunks.back();
+                m_FreeChunks.pop_back();
+            } else {
+                m_Chunks.emplace_back();
+            }
+
+            m_Chunks[newChunkIndex].Cell = cell;
+            chunkIndex                   = chunkIndices.insert(chunkIndices.end(), newChunkIndex);
+        }
+
+        auto& chunk = m_Chunks[*chunkIndex];
+
+        m_Slots.emplace(handle, Slot{ *chunkIndex, static_cast<uint32_t>(chunk.Entities.size()) });
+
+        chunk.Entities.push_back(handle);
+        chunk.IsDirty = true;
+    }
+
+    void StaticSpriteCache::ReleaseChunk(uint32_t chunkIndex) {
+        auto& chunk = m_Chunks[chunkIndex];
+
+        if (auto it = m_CellChunks.find(chunk.Cell); it != m_CellChunks.end()) {
+            std::erase(it->second, chunkIndex);
+
+            if (it->second.empty())
+                m_CellChunks.erase(it);
+        }
+
+        // The vertex buffers go with the chunk, the free slot starts over without them
+        chunk         = Chunk();
+        chunk.IsDirty = false;
+
+        m_FreeChunks.push_back(chunkIndex);
+    }
+
+    void StaticSpriteCache::RebuildChunk(const entt::registry& registry, Chunk& chunk) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        if (!chunk.QuadVertexBuffer) {
+            chunk.QuadVertexBuffer = VertexBuffer::Create(nullptr, ChunkCapacity * 4 * sizeof(Renderer2D::QuadVertex), BufferUsage::Static);
+            chunk.QuadVertexArray  = Renderer2D::CreateQuadVertexArray(chunk.QuadVertexBuffer);
+        }
+
+        m_Vertices.resize(chunk.Entities.size() * 4);
+
+        for (std::size_t i = 0; i < chunk.Entities.size(); ++i) {
+            entt::entity handle    = chunk.Entities[i];
+            const auto&  transform = registry.get<TransformComponent>(handle).GetTransform();
+            AABB         bounds    = AABB::FromQuad(transform);
+
+            Renderer2D::BuildQuadVertices(transform, registry.get<SpriteRendererComponent>(handle).Color, static_cast<int>(handle), &m_Vertices[i * 4]);
+
+            chunk.Bounds = i == 0 ? bounds : AABB::Merge(chunk.Bounds, bounds);
+        }
+
+        if (!m_Vertices.empty())
+            chunk.QuadVertexBuffer->SetData(m_Vertices.data(), m_Vertices.size() * sizeof(Renderer2D::QuadVertex));
+
+        chunk.QuadCount = static_cast<uint32_t>(chunk.Entities.size());
+        chunk.IsDirty   = false;
+
+        ++Renderer2D::GetStatistics().StaticChunkUploads;
+    }
+
+} // namespace Ziben
\ No newline at end of file
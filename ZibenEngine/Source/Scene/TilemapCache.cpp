@@ -0,0 +1,108 @@
+#include "TilemapCache.hpp"
+
+#include "Ziben/Renderer/Renderer2D.hpp"
+#include "Component.hpp"
+
+namespace Ziben {
+
+    namespace Internal {
+
+        static void UploadChunks(const TilemapComponent& tilemap, std::vector<uint32_t>& revisions, Texture2D& texture) {
+            uint32_t chunkCountX = tilemap.GetChunkCountX();
+            uint32_t chunkCountY = tilemap.GetChunkCountY();
+
+            for (uint32_t chunkY = 0; chunkY < chunkCountY; ++chunkY) {
+                for (uint32_t chunkX = 0; chunkX < chunkCountX; ++chunkX) {
+                    uint32_t& revision = revisions[chunkY * chunkCountX + chunkX];
+
+                    if (revision == tilemap.GetChunkRevision(chunkX, chunkY))
+                        continue;
+
+                    uint32_t x      = chunkX * TilemapComponent::ChunkSize;
+                    uint32_t y      = chunkY * TilemapComponent::ChunkSize;
+                    uint32_t width  = std::min(TilemapComponent::ChunkSize, tilemap.GetWidth() - x);
+                    uint32_t height = std::min(TilemapComponent::ChunkSize, tilemap.GetHeight() - y);
+
+                    texture.SetData(&tilemap.GetTiles()[static_cast<std::size_t>(y) * tilemap.GetWidth() + x], x, y, width, height, tilemap.GetWidth());
+
+                    revision = tilemap.GetChunkRevision(chunkX, chunkY);
+                    ++Renderer2D::GetStatistics().TilemapChunkUploads;
+                }
+            }
+        }
+
+    } // namespace Internal
+
+    void TilemapCache::Remove(entt::entity handle) {
+        m_Entries.erase(handle);
+    }
+
+    const TilemapCache::Entry* TilemapCache::Resolve(const entt::registry& registry, entt::entity handle) {
+        const auto& tilemap = registry.get<TilemapComponent>(handle);
+
+        if (tilemap.GetWidth() == 0 || tilemap.GetHeight() == 0 || tilemap.TilesetPath.empty())
+            return nullptr;
+
+        auto& entry = m_Entries[handle];
+
+        // A missing tileset is reported once per path
+        if (entry.TilesetPath != tilemap.TilesetPath) {
+            entry.TilesetPath = tilemap.TilesetPath;
+            entry.Tileset     = nullptr;
+
+            if (std::filesystem::exists(entry.TilesetPath))
+                entry.Tileset = TextureLoader::Load(entry.TilesetPath);
+            else
+                ZIBEN_CORE_WARN("TilemapCache: tileset {0} doesn't exist", entry.TilesetPath);
+        }
+
+        if (!entry.Tileset)
+            return nullptr;
+
+        if (!entry.Tiles || entry.Tiles->GetWidth() != tilemap.GetWidth() || entry.Tiles->GetHeight() != tilemap.GetHeight()) {
+            entry.Tiles = Texture2D::Create(tilemap.GetWidth(), tilemap.GetHeight(), TextureFormat::R16UI);
+            entry.ChunkRevisions.assign(static_cast<std::size_t>(tilemap.GetChunkCountX()) * tilemap.GetChunkCountY(), 0);
+        }
+
+        Internal::UploadChunks(tilemap, entry.ChunkRevisions, *entry.Tiles);
+
+        return &entry;
+    }
+
+    void TilemapCache::Render(const entt::registry& registry) {
+        ZIBEN_PROFILE_FUNCTION();
+
+        auto view = registry.view<TransformComponent, TilemapComponent>();
+
+        for (entt::entity handle : view) {
+            const auto& [transform, tilemap] = view.get<TransformComponent, TilemapComponent>(handle);
+
+            const auto* entry = Resolve(registry, handle);
+
+            if (!entry)
+                continue;
+
+            // The placeholder is drawn as a single cell until the tileset is loaded
+            const auto& tileset = entry->Tileset->GetTexture();
+
+            glm::vec2 tilesetGrid = glm::max(
+                glm::floor(glm::vec2(tileset->GetWidth(), tileset->GetHeight()) / glm::max(tilemap.TilesetCellSize, glm::vec2(1.0f))),
+                glm::vec2(1.0f)
+            );
+
+            Renderer2D::DrawTilemap(
+                transform.GetTransform() * tilemap.GetQuadTransform(),
+                entry->Tiles,
+                tileset,
+                tilesetGrid,
+                tilemap.Color,
+                static_cast<int>(handle)
+            );
+        }
+    }
+
+    void TilemapCache::Clear() {
+        m_Entries.clear();
+    }
+
+} // namespace Ziben
\ No newline at end of file
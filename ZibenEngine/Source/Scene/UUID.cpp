@@ -0,0 +1,13 @@
+#include "UUID.hpp"
+
+#include "Ziben/Utility/Random.hpp"
+
+namespace Ziben {
+
+    UUID::UUID()
+        : m_Value(Random::GetFromRange<uint64_t>(1, Random::Limit<uint64_t>::max())) {}
+
+    UUID::UUID(uint64_t value)
+        : m_Value(value) {}
+
+} // namespace Ziben
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include "Ziben/System/FileWatcher.hpp"
+
+#ifdef ZIBEN_PLATFORM_LINUX
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+namespace Ziben {
+
+    namespace Internal {
+
+        static inline std::string NormalizePath(const std::filesystem::path& path) {
+            std::error_code error;
+            auto            absolutePath = std::filesystem::absolute(path, error);
+
+            return (error ? path : absolutePath).lexically_normal().generic_string();
+        }
+
+        static inline std::filesystem::file_time_type GetWriteTime(const std::string& filepath) {
+            std::error_code error;
+            auto            writeTime = std::filesystem::last_write_time(filepath, error);
+
+            return error ? std::filesystem::file_time_type::min() : writeTime;
+        }
+
+    } // namespace Internal
+
+    FileWatcher::FileWatcher()
+        : m_Handle(-1)
+        , m_LastPoll(std::chrono::steady_clock::now()) {
+
+#ifdef ZIBEN_PLATFORM_LINUX
+        m_Handle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+    }
+
+    FileWatcher::~FileWatcher() {
+#ifdef ZIBEN_PLATFORM_LINUX
+        if (m_Handle >= 0)
+            close(m_Handle);
+#endif
+    }
+
+    void FileWatcher::Watch(const std::string& filepath) {
+        if (m_Files.contains(filepath))
+            return;
+
+        File file = { Internal::NormalizePath(filepath), Internal::GetWriteTime(filepath) };
+
+#ifdef ZIBEN_PLATFORM_LINUX
+        if (m_Handle >= 0) {
+            // The directory is watched, editors often save into a new file and rename it over the old one
+            auto directory = std::filesystem::path(file.Path).parent_path().generic_string();
+            int  watch     = inotify_add_watch(m_Handle, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+
+            if (watch >= 0)
+                m_Directories[watch] = directory;
+        }
+#endif
+
+        m_Files.emplace(filepath, std::move(file));
+    }
+
+    void FileWatcher::Unwatch(const std::string& filepath) {
+        // Directory watches stay, other files may live there
+        m_Files.erase(filepath);
+    }
+
+    std::vector<std::string> FileWatcher::Poll() {
+        std::vector<std::string> changedFiles;
+
+        if (m_Files.empty())
+            return changedFiles;
+
+#ifdef ZIBEN_PLATFORM_LINUX
+        if (m_Handle >= 0) {
+            std::vector<std::string>                      changedPaths;
+            alignas(inotify_event) std::array<char, 4096> buffer = {};
+            ssize_t                                       size;
+
+            while ((size = read(m_Handle, buffer.data(), buffer.size())) > 0) {
+                for (ssize_t offset = 0; offset < size;) {
+                    const auto* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+
+                    if (event->len > 0 && m_Directories.contains(event->wd))
+                        changedPaths.push_back(m_Directories.at(event->wd) + '/' + event->name);
+
+                    offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+                }
+            }
+
+            for (const auto& [filepath, file] : m_Files) {
+                if (std::find(changedPaths.begin(), changedPaths.end(), file.Path) != changedPaths.end())
+                    changedFiles.push_back(filepath);
+            }
+
+            return changedFiles;
+        }
+#endif
+
+        auto now = std::chrono::steady_clock::now();
+
+        if (now - m_LastPoll < s_PollInterval)
+            return changedFiles;
+
+        m_LastPoll = now;
+
+        for (auto& [filepath, file] : m_Files) {
+            auto writeTime = Internal::GetWriteTime(filepath);
+
+            if (writeTime == file.WriteTime)
+                continue;
+
+            file.WriteTime = writeTime;
+            changedFiles.push_back(filepath);
+        }
+
+        return changedFiles;
+    }
+
+} // namespace Ziben
\ No newline at end of file
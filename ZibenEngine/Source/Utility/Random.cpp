@@ -11,8 +11,9 @@ namespace Ziben {
         return result;
     }
 
+    // One engine per thread, scenes are built on the SceneLoader worker while the main thread creates entities too
     Random::Data& Random::GetData() {
-        static Data data = {
+        static thread_local Data data = {
             std::random_device(),
             {
                 data.RandomDevice(),